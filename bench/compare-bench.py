@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+# SPDX-License-Identifier: MIT
+
+"""Compare two result files of `qutepart_bench --json`, i.e. before and after a change.
+
+Prints one Markdown table row per benchmark and data tag, with the time per iteration of both
+runs and the change. Lower is better.
+"""
+
+import argparse
+import json
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Compare two qutepart_bench --json results')
+    parser.add_argument('before', help='results of the baseline')
+    parser.add_argument('after', help='results of the change')
+    parser.add_argument('--metric', default='WalltimeMilliseconds')
+    return parser.parse_args()
+
+
+def load_results(path, metric):
+    with open(path) as json_file:
+        results = json.load(json_file)['results']
+    return {(result['benchmark'], result['tag']): result['value']
+            for result in results
+            if result['metric'] == metric}
+
+
+def result_name(key):
+    benchmark, tag = key
+    return f'{benchmark}/{tag}' if tag else benchmark
+
+
+def main():
+    args = parse_args()
+    before = load_results(args.before, args.metric)
+    after = load_results(args.after, args.metric)
+
+    print(f'| Benchmark | Before ({args.metric}) | After | Change |')
+    print('|---|---:|---:|---:|')
+    for key in sorted(before.keys() & after.keys()):
+        change = (after[key] - before[key]) / before[key] * 100 if before[key] else 0
+        print(f'| {result_name(key)} | {before[key]:.3f} | {after[key]:.3f} | {change:+.1f}% |')
+
+    for key in sorted(before.keys() ^ after.keys()):
+        print(f'Only in one of the runs: {result_name(key)}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Memory used per line of highlighted documents.
+ *
+ * Builds synthetic documents of 10k, 100k and 1M lines by repeating a snippet of each language
+ * (or the files given on the command line), highlights them synchronously and prints
+ * Qutepart::memoryStats() divided by the line count.
+ *
+ * Usage: qutepart-memory-bench [--lines 10000,100000] [file...]
+ */
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+
+#include "qutepart/qutepart.h"
+
+namespace {
+
+struct Sample {
+    QString fileName; // used to choose the language
+    QString text;
+};
+
+const QList<Sample> BUILTIN_SAMPLES = {
+    {"sample.cpp", "#include <vector>\n"
+                   "\n"
+                   "/* Sum the values.\n"
+                   " * Multiline comment\n"
+                   " */\n"
+                   "int sum(const std::vector<int> &values) {\n"
+                   "    int result = 0; // accumulator\n"
+                   "    for (auto value : values) {\n"
+                   "        result += value * 0x10;\n"
+                   "    }\n"
+                   "    const char *s = \"text\\n\";\n"
+                   "    return result;\n"
+                   "}\n"},
+    {"sample.py", "import os\n"
+                  "\n"
+                  "class Walker(object):\n"
+                  "    \"\"\"Walk the tree.\"\"\"\n"
+                  "    def __init__(self, root):\n"
+                  "        self.root = root  # comment\n"
+                  "\n"
+                  "    def files(self):\n"
+                  "        for name in os.listdir(self.root):\n"
+                  "            yield '%s/%s' % (self.root, name)\n"},
+    {"sample.xml", "<?xml version=\"1.0\"?>\n"
+                   "<!-- comment -->\n"
+                   "<items count=\"2\">\n"
+                   "  <item id=\"1\">first &amp; second</item>\n"
+                   "  <item id=\"2\"><![CDATA[raw <text>]]></item>\n"
+                   "</items>\n"},
+    {"sample.md", "# Title\n"
+                  "\n"
+                  "Some *emphasis* and `code` in a [link](http://example.com).\n"
+                  "\n"
+                  "- first item\n"
+                  "- second item\n"
+                  "\n"
+                  "```\n"
+                  "verbatim\n"
+                  "```\n"},
+};
+
+QString repeatToLines(const QString &snippet, int lineCount) {
+    auto lines = snippet.split('\n');
+    if (lines.size() > 1 && lines.last().isEmpty()) {
+        lines.removeLast();
+    }
+
+    QString result;
+    result.reserve(lineCount * (snippet.size() / lines.size() + 1));
+    for (int i = 0; i < lineCount; i++) {
+        result += lines[i % lines.size()];
+        if (i + 1 < lineCount) {
+            result += '\n';
+        }
+    }
+    return result;
+}
+
+double perLine(size_t bytes, int lineCount) { return double(bytes) / lineCount; }
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    Q_INIT_RESOURCE(qutepart_syntax_files);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Print memory used per line of highlighted documents");
+    parser.addHelpOption();
+    QCommandLineOption linesOption("lines", "Comma separated document sizes, in lines", "counts",
+                                   "10000,100000,1000000");
+    parser.addOption(linesOption);
+    parser.addPositionalArgument("file", "Files to use instead of the built-in samples");
+    parser.process(app);
+
+    QList<int> lineCounts;
+    for (const auto &count : parser.value(linesOption).split(',', Qt::SkipEmptyParts)) {
+        bool ok = false;
+        auto value = count.toInt(&ok);
+        if (!ok || value <= 0) {
+            qCritical() << "Invalid line count" << count;
+            return 1;
+        }
+        lineCounts.append(value);
+    }
+
+    QList<Sample> samples;
+    for (const auto &path : parser.positionalArguments()) {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly)) {
+            qCritical() << "Failed to open" << path;
+            return 1;
+        }
+        samples.append({QFileInfo(path).fileName(), QString::fromUtf8(file.readAll())});
+    }
+    if (samples.isEmpty()) {
+        samples = BUILTIN_SAMPLES;
+    }
+
+    QTextStream out(stdout);
+    out << "file\tlanguage\tlines\tms\tblockData\ttextSpans\tregions\tformats\tstacks\tdocument"
+           "\tgrammar\n";
+
+    for (const auto &sample : samples) {
+        auto langInfo = Qutepart::chooseLanguage(QString(), QString(), sample.fileName);
+        if (!langInfo.isValid()) {
+            qWarning() << "No language for" << sample.fileName;
+            continue;
+        }
+
+        for (auto lineCount : lineCounts) {
+            auto text = repeatToLines(sample.text, lineCount);
+
+            Qutepart::Qutepart editor;
+            editor.setHighlightingTimeSlice(0);
+            editor.setHighlighter(langInfo.id);
+
+            QElapsedTimer timer;
+            timer.start();
+            editor.setPlainText(text);
+            auto elapsed = timer.elapsed();
+
+            auto stats = editor.memoryStats();
+            size_t grammar = 0;
+            for (auto size : stats.grammars) {
+                grammar += size;
+            }
+
+            out << sample.fileName << '\t' << langInfo.names.value(0) << '\t' << lineCount << '\t'
+                << elapsed << '\t' << perLine(stats.blockData, lineCount) << '\t'
+                << perLine(stats.textSpans, lineCount) << '\t'
+                << perLine(stats.regions, lineCount) << '\t'
+                << perLine(stats.formatRanges, lineCount) << '\t'
+                << perLine(stats.contextStacks, lineCount) << '\t'
+                << perLine(stats.documentTotal(), lineCount) << '\t' << grammar << '\n';
+            out.flush();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,369 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Throughput benchmarks of the highlighting engine, the indenters and the completer.
+ *
+ * A regular QTest executable, all QTest options work. In addition `--json FILE` writes the
+ * results as JSON, to compare releases:
+ *
+ *     qutepart_bench --json results.json
+ *     qutepart_bench HighlightLines cpp
+ *
+ * The samples are read from code-examples/, set QUTEPART_CODE_EXAMPLES to use another directory.
+ */
+
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QXmlStreamReader>
+
+#include "completer.h"
+#include "hl/language.h"
+#include "hl/loader.h"
+#include "hl/syntax_highlighter.h"
+#include "hl_factory.h"
+#include "indent/indenter.h"
+#include "qutepart/qutepart.h"
+
+namespace {
+
+// Samples are repeated up to this size, so short files are measured too
+const int MIN_LINE_COUNT = 10000;
+
+QString codeExamplesDir() {
+    auto dir = qEnvironmentVariable("QUTEPART_CODE_EXAMPLES");
+    return dir.isEmpty() ? QString(QUTEPART_CODE_EXAMPLES_DIR) : dir;
+}
+
+QString readSample(const QString &fileName) {
+    QFile file(QDir(codeExamplesDir()).filePath(fileName));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+    return QString::fromUtf8(file.readAll());
+}
+
+QStringList repeatLines(const QString &text, int minLineCount) {
+    auto lines = text.split('\n');
+    if (lines.size() > 1 && lines.last().isEmpty()) {
+        lines.removeLast();
+    }
+
+    QStringList result;
+    while (result.size() < minLineCount) {
+        result += lines;
+    }
+    return result;
+}
+
+// Language of a sample. The .syntax file next to it names the language, if the file name is
+// ambiguous
+QString sampleLanguageId(const QString &fileName, const QString &text) {
+    auto syntaxName = readSample(fileName + ".syntax").trimmed();
+    auto firstLine = text.section('\n', 0, 0);
+    return Qutepart::chooseLanguage(QString(), syntaxName, fileName, firstLine).id;
+}
+
+} // namespace
+
+class Benchmark : public QObject {
+    Q_OBJECT
+
+  public:
+    // Lines processed by one iteration of a data row, to report lines per second
+    QHash<QString, int> lineCounts;
+
+  private:
+    void setLineCount(int lineCount) {
+        lineCounts[QString("%1/%2").arg(QTest::currentTestFunction(), QTest::currentDataTag())] =
+            lineCount;
+    }
+
+    void addSampleRows() {
+        QTest::addColumn<QString>("fileName");
+        const auto fileNames = QDir(codeExamplesDir()).entryList(QDir::Files, QDir::Name);
+        for (const auto &fileName : fileNames) {
+            if (!fileName.endsWith(".syntax")) {
+                QTest::newRow(qPrintable(fileName)) << fileName;
+            }
+        }
+    }
+
+  private slots:
+    void initTestCase() {
+        if (!QDir(codeExamplesDir()).exists()) {
+            QSKIP("code-examples directory not found, set QUTEPART_CODE_EXAMPLES");
+        }
+    }
+
+    void LoadSyntax_data() {
+        QTest::addColumn<QString>("languageId");
+        QTest::addColumn<bool>("fromXml");
+        const auto fileNames = QDir(":/qutepart/syntax").entryList(QDir::Files, QDir::Name);
+        for (const auto &fileName : fileNames) {
+            QTest::addRow("%s", qPrintable(fileName)) << fileName << false;
+            QTest::addRow("%s xml", qPrintable(fileName)) << fileName << true;
+        }
+    }
+
+    /* Parsing the syntax file and building the contexts, including the languages it includes.
+     * From the syntax bundle, if the library was built with it, or from XML. Included languages
+     * are always loaded the default way
+     */
+    void LoadSyntax() {
+        QFETCH(QString, languageId);
+        QFETCH(bool, fromXml);
+        Qutepart::clearLanguageCache();
+
+        QSharedPointer<Qutepart::Language> language;
+        if (fromXml) {
+            QFile file(":/qutepart/syntax/" + languageId);
+            QVERIFY(file.open(QIODevice::ReadOnly));
+            QBENCHMARK_ONCE {
+                QXmlStreamReader xmlReader(&file);
+                Qutepart::SyntaxReader reader(xmlReader, file.fileName());
+                QString error;
+                language = Qutepart::parseXmlFile(languageId, reader, error);
+            }
+        } else {
+            QBENCHMARK_ONCE { language = Qutepart::loadLanguage(languageId); }
+        }
+        if (language.isNull()) {
+            QSKIP("Failed to load the language");
+        }
+    }
+
+    // Language detection by file name, as when a project tree is opened. "lines" are paths
+    void ChooseLanguage() {
+        auto fileNames = QDir(codeExamplesDir()).entryList(QDir::Files, QDir::Name);
+        fileNames << "Makefile" << "CMakeLists.txt" << "README" << "archive.tar.gz"
+                  << "usr.bin.ping" << "x.log.1" << "MAIN.CPP";
+
+        QStringList paths;
+        for (int i = 0; paths.size() < 100000; i++) {
+            paths << QString("/project/dir%1/%2").arg(i % 100).arg(fileNames[i % fileNames.size()]);
+        }
+        setLineCount(paths.size());
+
+        QBENCHMARK {
+            for (const auto &path : std::as_const(paths)) {
+                Qutepart::chooseLanguage(QString(), QString(), path);
+            }
+        }
+    }
+
+    void HighlightLines_data() { addSampleRows(); }
+
+    void HighlightLines() {
+        QFETCH(QString, fileName);
+        auto text = readSample(fileName);
+        auto languageId = sampleLanguageId(fileName, text);
+        if (languageId.isEmpty()) {
+            QSKIP("No language for the file");
+        }
+        auto language = Qutepart::loadLanguage(languageId);
+        QVERIFY(!language.isNull());
+
+        auto lines = repeatLines(text, MIN_LINE_COUNT);
+        setLineCount(lines.size());
+
+        Qutepart::HighlightedLine line(0, language->getDefaultContextStack());
+        QBENCHMARK {
+            auto contextStack = language->getDefaultContextStack();
+            for (const auto &lineText : std::as_const(lines)) {
+                language->highlightLine(lineText, contextStack, line);
+                contextStack = line.endContextStack;
+            }
+        }
+    }
+
+    void EditRehighlight_data() {
+        QTest::addColumn<QString>("fileName");
+        QTest::addColumn<bool>("middle");
+
+        for (const auto &fileName : {"highlight.cpp", "test.py", "highlight.php"}) {
+            QTest::addRow("%s top", fileName) << QString(fileName) << false;
+            QTest::addRow("%s middle", fileName) << QString(fileName) << true;
+        }
+    }
+
+    // Insert and remove a character, the document is highlighted synchronously
+    void EditRehighlight() {
+        QFETCH(QString, fileName);
+        QFETCH(bool, middle);
+
+        auto text = readSample(fileName);
+        auto lines = repeatLines(text, MIN_LINE_COUNT);
+
+        Qutepart::Qutepart editor;
+        editor.setHighlightingTimeSlice(0);
+        editor.setHighlighter(sampleLanguageId(fileName, text));
+        editor.setPlainText(lines.join('\n'));
+
+        auto block = editor.document()->findBlockByNumber(middle ? lines.size() / 2 : 0);
+        QTextCursor cursor(block);
+        QBENCHMARK {
+            cursor.insertText("x");
+            cursor.deletePreviousChar();
+        }
+    }
+
+    void Indent_data() {
+        QTest::addColumn<int>("algorithm");
+        QTest::addColumn<QString>("fileName");
+
+        QTest::newRow("normal") << int(Qutepart::INDENT_ALG_NORMAL) << "highlight.cpp";
+        QTest::newRow("cstyle") << int(Qutepart::INDENT_ALG_CSTYLE) << "highlight.cpp";
+        QTest::newRow("python") << int(Qutepart::INDENT_ALG_PYTHON) << "test.py";
+        QTest::newRow("ruby") << int(Qutepart::INDENT_ALG_RUBY) << "highlight.rb";
+        QTest::newRow("lisp") << int(Qutepart::INDENT_ALG_LISP) << "highlight.lisp";
+        QTest::newRow("scheme") << int(Qutepart::INDENT_ALG_SCHEME) << "highlight.scheme";
+        QTest::newRow("xml") << int(Qutepart::INDENT_ALG_XML) << "highlight.xml";
+        QTest::newRow("markdown") << int(Qutepart::INDENT_ALG_MARKDOWN) << "test.markdown";
+    }
+
+    // Indent every line as if Enter was pressed before it
+    void Indent() {
+        QFETCH(int, algorithm);
+        QFETCH(QString, fileName);
+
+        auto text = readSample(fileName);
+        auto languageId = sampleLanguageId(fileName, text);
+        auto lines = repeatLines(text, 1000);
+        setLineCount(lines.size());
+
+        QTextDocument document(lines.join('\n'));
+        auto highlighter = static_cast<Qutepart::SyntaxHighlighter *>(
+            Qutepart::makeHighlighter(&document, languageId));
+        if (highlighter) {
+            highlighter->setTimeSliceBudget(0);
+            highlighter->rehighlight();
+        }
+
+        Qutepart::Indenter indenter(nullptr);
+        indenter.setAlgorithm(static_cast<Qutepart::IndentAlg>(algorithm));
+        indenter.setLanguage(languageId);
+
+        QBENCHMARK {
+            for (auto block = document.begin().next(); block.isValid(); block = block.next()) {
+                indenter.indentBlock(block, 0, Qt::Key_Enter);
+            }
+        }
+    }
+
+    void UpdateWordSet_data() { addSampleRows(); }
+
+    void UpdateWordSet() {
+        QFETCH(QString, fileName);
+        auto text = readSample(fileName);
+        auto lines = repeatLines(text, MIN_LINE_COUNT);
+        setLineCount(lines.size());
+
+        Qutepart::Qutepart editor;
+        editor.setPlainText(lines.join('\n'));
+        Qutepart::Completer completer(&editor);
+        auto language = Qutepart::loadLanguage(sampleLanguageId(fileName, text));
+        if (!language.isNull()) {
+            completer.setKeywords(language->allLanguageKeywords());
+        }
+
+        QBENCHMARK { completer.updateWordSet(); }
+    }
+};
+
+namespace {
+
+/* Convert the QTest XML log to JSON:
+ * {"results": [{"benchmark", "tag", "metric", "value", "iterations", "lines", "linesPerSecond"}]}
+ * `value` is per iteration.
+ */
+QJsonObject benchmarkResultsToJson(QIODevice &xmlLog, const QHash<QString, int> &lineCounts) {
+    QJsonArray results;
+    QString function;
+
+    QXmlStreamReader xml(&xmlLog);
+    while (!xml.atEnd()) {
+        if (xml.readNext() != QXmlStreamReader::StartElement) {
+            continue;
+        }
+        auto attrs = xml.attributes();
+        if (xml.name() == QLatin1String("TestFunction")) {
+            function = attrs.value("name").toString();
+        } else if (xml.name() == QLatin1String("BenchmarkResult")) {
+            QJsonObject result;
+            auto tag = attrs.value("tag").toString();
+            auto metric = attrs.value("metric").toString();
+            auto value = attrs.value("value").toDouble();
+            result["benchmark"] = function;
+            result["tag"] = tag;
+            result["metric"] = metric;
+            result["value"] = value;
+            result["iterations"] = attrs.value("iterations").toInt();
+
+            auto lines = lineCounts.value(function + "/" + tag);
+            if (lines > 0) {
+                result["lines"] = lines;
+                if (metric == QLatin1String("WalltimeMilliseconds") && value > 0) {
+                    result["linesPerSecond"] = lines * 1000. / value;
+                }
+            }
+            results.append(result);
+        }
+    }
+
+    QJsonObject json;
+    json["qtVersion"] = qVersion();
+    json["results"] = results;
+    return json;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    Q_INIT_RESOURCE(qutepart_syntax_files);
+
+    auto args = app.arguments();
+    QString jsonPath;
+    auto jsonIndex = args.indexOf("--json");
+    if (jsonIndex != -1 && jsonIndex + 1 < args.size()) {
+        jsonPath = args[jsonIndex + 1];
+        args.remove(jsonIndex, 2);
+    }
+
+    Benchmark benchmark;
+    if (jsonPath.isEmpty()) {
+        return QTest::qExec(&benchmark, args);
+    }
+
+    QTemporaryDir tmpDir;
+    auto xmlPath = tmpDir.filePath("results.xml");
+    args << "-o" << xmlPath + ",xml" << "-o" << "-,txt";
+    auto status = QTest::qExec(&benchmark, args);
+
+    QFile xmlLog(xmlPath);
+    QFile jsonFile(jsonPath);
+    if (!xmlLog.open(QIODevice::ReadOnly) || !jsonFile.open(QIODevice::WriteOnly)) {
+        qCritical() << "Failed to write" << jsonPath;
+        return 1;
+    }
+    jsonFile.write(QJsonDocument(benchmarkResultsToJson(xmlLog, benchmark.lineCounts)).toJson());
+    return status;
+}
+
+#include "qutepart_bench.moc"
@@ -17,11 +17,13 @@
 #include <QDebug>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <QMap>
 #include <QPlainTextEdit>
 #include <QSharedPointer>
 #include <QTextBlock>
 
 class QSyntaxHighlighter;
+class QThreadPool;
 
 namespace Qutepart {
 
@@ -120,12 +122,60 @@ LangInfo chooseLanguage(const QString &mimeType = QString(),
                         const QString &sourceFilePath = QString(),
                         const QString &firstLine = QString());
 
+/**
+ * Enable or disable the highlighting profiler for all editors.
+ *
+ * While enabled, every syntax rule and context counts match attempts, hits and the time spent
+ * matching. Highlighting gets slower. See ::Qutepart::Qutepart::highlightingProfile()
+ */
+void setHighlightingProfilerEnabled(bool enabled);
+
+/**
+ * Cache highlighted lines, for all editors.
+ *
+ * Every language keeps up to `lines` highlighted lines, by their text and the context they
+ * start in. Repeated lines, like empty lines, `}` or the prefixes of a log, are then not
+ * highlighted again. See ::Qutepart::Qutepart::lineCacheStats()
+ *
+ * \param lines Lines per language. 0, the default, disables the cache and drops the lines
+ */
+void setHighlightingLineCache(int lines);
+
+/**
+ * Load languages in the background, so the first ::Qutepart::Qutepart::setHighlighter() with
+ * them does not parse anything.
+ *
+ * The languages are loaded in parallel, together with the languages they include (i.e.
+ * `##Doxygen`, `##CSS`). Without preloading, an included language is loaded when highlighting
+ * first reaches it. Loaded languages are shared by all the editors, every language is loaded
+ * once, even if several of the preloaded languages include it.
+ *
+ * The future has one result per loaded language, its ID, in the order the loads finish.
+ * Languages which fail to load are skipped.
+ *
+ * \param languageIds See Qutepart::LangInfo::id
+ * \param pool Thread pool to load on. `QThreadPool::globalInstance()` if `nullptr`
+ */
+QFuture<QString> preloadLanguages(const QStringList &languageIds, QThreadPool *pool = nullptr);
+
+/**
+ * Preload the most used languages once the application is idle.
+ *
+ * Starts when the event loop has processed the events queued so far (i.e. after the main window
+ * and its tabs are restored), on low priority threads. Needs a running event loop.
+ *
+ * \param languageIdsByUsage Language IDs, most used first. i.e. saved from previous sessions
+ * \param count How many languages of the list to preload
+ */
+QFuture<QString> preloadLanguagesWhenIdle(const QStringList &languageIdsByUsage, int count);
+
 class Indenter;
 class BracketHighlighter;
 class LineNumberArea;
 class MarkArea;
 class Minimap;
 class Completer;
+class Language;
 class Theme;
 class FoldingArea;
 
@@ -238,6 +288,71 @@ struct TextCursorPosition {
     int column;
 };
 
+/** Memory used by an editor, in bytes
+ *
+ * Estimates of the heap memory of the internal structures, without the allocator overhead.
+ * Returned by ::Qutepart::Qutepart::memoryStats()
+ */
+struct MemoryStats {
+    /// Per line highlighting state, excluding the members listed below
+    size_t blockData = 0;
+
+    /// Text types and languages of the lines, used by comment toggling and bracket matching
+    size_t textSpans = 0;
+
+    /// Folding regions open at the end of the lines
+    size_t regions = 0;
+
+    /// Formats applied to the lines by the highlighter, and their style ids kept for theme changes
+    size_t formatRanges = 0;
+
+    /// Persistent and extra selections
+    size_t selections = 0;
+
+    /// Word lists of the autocompletion
+    size_t completer = 0;
+
+    /// Interned context stacks and block states of the languages. Shared between editors
+    size_t contextStacks = 0;
+
+    /// Loaded grammars by language name. Shared between editors using the same language
+    QMap<QString, size_t> grammars;
+
+    /// Highlighted lines cached by the languages. Shared between editors
+    size_t lineCaches = 0;
+
+    /// Memory owned by this editor, i.e. everything except the shared structures
+    size_t documentTotal() const {
+        return blockData + textSpans + regions + formatRanges + selections + completer;
+    }
+
+    /// Everything, including the shared structures
+    size_t total() const {
+        size_t result = documentTotal() + contextStacks + lineCaches;
+        for (auto size : grammars) {
+            result += size;
+        }
+        return result;
+    }
+};
+
+/** Counters of the cache of highlighted lines
+ *
+ * Returned by ::Qutepart::Qutepart::lineCacheStats()
+ */
+struct LineCacheStats {
+    /// Lines found in the cache
+    quint64 hits = 0;
+
+    /// Lines highlighted and added to the cache
+    quint64 misses = 0;
+
+    /// Share of the lines found in the cache, 0 to 1
+    double hitRate() const {
+        return hits + misses == 0 ? 0 : static_cast<double>(hits) / (hits + misses);
+    }
+};
+
 struct CompletionItem {
     QString text;
     QString source;
@@ -295,6 +410,41 @@ class Qutepart : public QPlainTextEdit {
      */
     void removeHighlighter();
 
+    /**
+     * Time in milliseconds the highlighter may spend at once. Visible lines are highlighted
+     * first, the rest of the document is highlighted in the background in slices of this size.
+     * Lines which are not highlighted yet are drawn with default colors.
+     * 0 highlights the whole document synchronously.
+     */
+    void setHighlightingTimeSlice(int msec);
+    int highlightingTimeSlice() const;
+
+    /// Returns true while the background highlighting has not reached the end of the document
+    bool isHighlightingPending() const;
+
+    /**
+     * Estimate memory used by the editor and by the languages it highlights.
+     * Walks the whole document, do not call it on every keystroke.
+     */
+    MemoryStats memoryStats() const;
+
+    /**
+     * Counters of the highlighting profiler for the languages of the document, rules which
+     * took most time first. See ::Qutepart::setHighlightingProfilerEnabled()
+     *
+     * \param json Return a JSON array, one object per language, instead of a text table
+     */
+    QString highlightingProfile(bool json = false) const;
+
+    /// Reset the highlighting profiler counters of the languages of the document
+    void resetHighlightingProfile();
+
+    /**
+     * Counters of the cache of highlighted lines of the languages of the document, since they
+     * were loaded. See ::Qutepart::setHighlightingLineCache()
+     */
+    LineCacheStats lineCacheStats() const;
+
     /**
      * Set indenter algorithm. Use `Qutepart::chooseLanguage()` to choose the algorithm.
      *
@@ -530,6 +680,12 @@ class Qutepart : public QPlainTextEdit {
      */
     void multipleCursorCut();
 
+  signals:
+    /// Background highlighting made progress. Emitted after every time slice
+    void highlightingProgress(int highlightedLines, int totalLines);
+    /// Background highlighting reached the end of the document
+    void highlightingFinished();
+
   protected:
     bool event(QEvent *event) override;
     bool eventFilter(QObject *obj, QEvent *event) override;
@@ -609,6 +765,9 @@ class Qutepart : public QPlainTextEdit {
     void onShortcutJoinLines();
 
     void toggleExtraCursorsVisibility();
+    void updateHighlighterVisibleBlocks();
+    // The main language and the languages it includes, which were used in the document
+    QSet<Language *> highlightedLanguages() const;
 
   private slots:
     void onCompletionFutureFinished();
@@ -626,6 +785,7 @@ class Qutepart : public QPlainTextEdit {
     QString lastWordUnderCursor;
 
     QSyntaxHighlighter *highlighter_ = nullptr;
+    int highlightingTimeSlice_;
     Indenter *indenter_;
     BracketHighlighter *bracketHighlighter_ = nullptr;
     LineNumberArea *lineNumberArea_ = nullptr;
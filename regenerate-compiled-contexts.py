@@ -0,0 +1,318 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+# SPDX-License-Identifier: MIT
+
+"""Generate C++ matchers for the contexts of the most used syntax files.
+
+Every context becomes a function, which switches on the first character of the text and checks
+the literal rules (DetectChar, Detect2Chars, AnyChar, StringDetect, LineContinue) and
+DetectSpaces and DetectIdentifier inline, in the order of the syntax file. All other rules
+(regular expressions, keywords, numbers, dynamic rules, IncludeRules) are tried by the
+interpreter, see Context::tryRulesFromCompiled().
+
+The rules are referred by their index in the context, as the loader creates them. The names of
+the rules are stored with every context, a context of a changed syntax file is interpreted.
+"""
+
+import argparse
+import os.path
+import re
+import xml.etree.ElementTree
+
+
+COMPILED_FILES = [
+    'cmake.xml',
+    'cpp.xml',
+    'isocpp.xml',
+    'json.xml',
+    'markdown.xml',
+    'python.xml',
+    'yaml.xml',
+]
+
+RULE_NAMES = {
+    'keyword': 'Keyword',
+}
+
+# QChar::isSpace() and QChar::isLetter() of the ASCII characters
+ASCII_SPACES = set([0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x20])
+
+
+def is_ascii_letter(unit):
+    return ord('a') <= unit <= ord('z') or ord('A') <= unit <= ord('Z')
+
+
+def parse_bool(value):
+    if value.lower() in ('true', '1'):
+        return True
+    elif value.lower() in ('false', '0'):
+        return False
+    else:
+        raise UserWarning("Invalid bool attribute value '%s'" % value)
+
+
+def process_escape_sequences(value):
+    # Same as processEscapeSequences() of loader.cpp
+    for escaped, char in (('\\a', '\a'), ('\\b', '\b'), ('\\f', '\f'), ('\\n', '\n'),
+                          ('\\r', '\r'), ('\\t', '\t'), ('\\\\', '\\')):
+        value = value.replace(escaped, char)
+    return value
+
+
+def utf16_units(value):
+    data = value.encode('utf-16-le')
+    return [data[i] | (data[i + 1] << 8) for i in range(0, len(data), 2)]
+
+
+def char_literal(unit):
+    if 0x20 <= unit < 0x7f and chr(unit) not in "'\\":
+        return "u'%s'" % chr(unit)
+    return '0x%04x' % unit
+
+
+def latin1_literal(units):
+    return '"%s"' % ''.join(('\\' + chr(unit)) if chr(unit) in '"\\' else chr(unit)
+                            for unit in units)
+
+
+def is_printable_ascii(units):
+    return all(0x20 <= unit < 0x7f for unit in units)
+
+
+class Rule:
+    """A rule of a context. `start_units` is None if the rule may start at any character"""
+
+    def __init__(self, index, element):
+        self.index = index
+        self.name = RULE_NAMES.get(element.tag, element.tag)
+        self.kind = 'generic'
+        self.start_units = None
+        self.value = None
+
+        attrs = element.attrib
+        self.column = int(attrs['column']) if 'column' in attrs else -1
+        self.first_non_space = parse_bool(attrs.get('firstNonSpace', 'false'))
+        dynamic = parse_bool(attrs.get('dynamic', 'false'))
+        if dynamic:
+            return
+
+        tag = element.tag
+        if tag == 'DetectChar' and attrs.get('char'):
+            units = utf16_units(process_escape_sequences(attrs['char']))
+            self.kind, self.start_units = 'char', [units[0]]
+        elif tag == 'Detect2Chars' and 'char' in attrs and 'char1' in attrs:
+            units = utf16_units(process_escape_sequences(attrs['char']) +
+                                process_escape_sequences(attrs['char1']))
+            if len(units) == 2:
+                self.kind, self.start_units, self.value = '2chars', [units[0]], units
+        elif tag == 'AnyChar' and 'String' in attrs:
+            self.kind, self.start_units = 'anychar', sorted(set(utf16_units(attrs['String'])))
+        elif tag == 'StringDetect' and 'String' in attrs and \
+                not parse_bool(attrs.get('insensitive', 'false')):
+            units = utf16_units(attrs['String'])
+            if not units:
+                self.kind, self.start_units = 'never', []
+            elif is_printable_ascii(units):
+                self.kind, self.start_units, self.value = 'string', [units[0]], units
+        elif tag == 'LineContinue':
+            self.kind, self.start_units = 'linecontinue', [ord('\\')]
+        elif tag == 'DetectSpaces':
+            self.kind = 'spaces'
+        elif tag == 'DetectIdentifier':
+            self.kind = 'identifier'
+
+    def can_start(self, unit):
+        """If the rule can match at the unit. None is any character not in the switch"""
+        if self.start_units is not None:
+            return unit is not None and unit in self.start_units
+        if unit is None or unit >= 0x80:
+            return True
+        if self.kind == 'spaces':
+            return unit in ASCII_SPACES
+        if self.kind == 'identifier':
+            return is_ascii_letter(unit)
+        return True
+
+    def code(self, indent):
+        """Statements trying the rule. The first character is known to be a start character.
+        A single statement returns unconditionally"""
+        conditions = []
+        if self.column != -1:
+            conditions.append('textToMatch.currentColumnIndex == %d' % self.column)
+        if self.first_non_space:
+            conditions.append('textToMatch.firstNonSpace')
+
+        matched = 'return context.matchedFromCompiled(%d, %%s, %%s, result);' % self.index
+        if self.kind == 'char' or self.kind == 'anychar':
+            result = matched % (1, 'false')
+        elif self.kind == '2chars':
+            conditions.append('text.size() >= 2 && text.at(1) == QChar(%s)' %
+                              char_literal(self.value[1]))
+            result = matched % (2, 'false')
+        elif self.kind == 'string':
+            if len(self.value) > 1:
+                conditions.append('text.startsWith(QLatin1String(%s))' %
+                                  latin1_literal(self.value))
+            result = matched % (len(self.value), 'false')
+        elif self.kind == 'linecontinue':
+            conditions.append('text.size() == 1')
+            result = matched % (1, 'true')
+        elif self.kind == 'spaces':
+            conditions.append('textToMatch.countSpaces() > 0')
+            result = matched % ('textToMatch.countSpaces()', 'false')
+        elif self.kind == 'identifier':
+            conditions.append('textToMatch.isLetter()')
+            result = matched % ('textToMatch.countWordChars()', 'false')
+        else:
+            return []
+
+        if not conditions:
+            return [indent + result]
+        return [indent + 'if (%s) {' % ' && '.join(conditions),
+                indent + '    ' + result,
+                indent + '}']
+
+
+def load_contexts(file_path):
+    with open(file_path, 'r', encoding='utf-8') as syntax_file:
+        root = xml.etree.ElementTree.parse(syntax_file).getroot()
+
+    contexts = []
+    for context in root.find('highlighting').find('contexts').findall('context'):
+        rules = [Rule(index, element) for index, element in enumerate(context)]
+        contexts.append((context.attrib['name'], rules))
+
+    # The loader finds contexts by name, skip the ambiguous ones
+    names = [name for name, _ in contexts]
+    return [(name, rules) for name, rules in contexts if names.count(name) == 1]
+
+
+def rule_names_hash(rules):
+    """FNV-1a of the rule names separated by spaces, see Context::ruleNamesHash()"""
+    result = 0x811c9dc5
+    for byte in ' '.join(rule.name for rule in rules).encode('utf-8'):
+        result = ((result ^ byte) * 0x01000193) & 0xffffffff
+    return result
+
+
+def identifier(file_name):
+    return re.sub(r'[^A-Za-z0-9]', '', os.path.splitext(file_name)[0].title())
+
+
+def rules_code(rules, indent):
+    """Statements trying the rules in order. Consecutive generic rules are tried by one call"""
+    out = []
+    index = 0
+    while index < len(rules):
+        if rules[index].kind != 'generic':
+            code = rules[index].code(indent)
+            out.extend(code)
+            if len(code) == 1:
+                return out, True  # the following rules are never reached
+            index += 1
+            continue
+
+        end = index
+        while end < len(rules) and rules[end].kind == 'generic' and \
+                rules[end].index == rules[index].index + end - index:
+            end += 1
+        out.append(indent + 'if (context.tryRulesFromCompiled(%d, %d, textToMatch, result)) {' %
+                   (rules[index].index, rules[end - 1].index + 1))
+        out.append(indent + '    return true;')
+        out.append(indent + '}')
+        index = end
+    return out, False
+
+
+def write_matcher(out, function_name, context_name, rules):
+    out.append('// %s' % context_name)
+    out.append('bool %s(const Context &context, const TextToMatch &textToMatch,' %
+               function_name)
+    out.append('%sMatchResult &result) {' % (' ' * len('bool %s(' % function_name)))
+    out.append('    [[maybe_unused]] const QStringView text = textToMatch.text;')
+
+    units = sorted(set(unit for rule in rules if rule.start_units for unit in rule.start_units))
+    if units:
+        out.append('    switch (text.at(0).unicode()) {')
+        for unit in units:
+            out.append('    case %s:' % char_literal(unit))
+            code, returns = rules_code([rule for rule in rules if rule.can_start(unit)],
+                                       '        ')
+            out.extend(code)
+            if not returns:
+                out.append('        return false;')
+        out.append('    default:')
+        out.append('        break;')
+        out.append('    }')
+
+    code, returns = rules_code([rule for rule in rules if rule.can_start(None)], '    ')
+    out.extend(code)
+    if not returns:
+        out.append('    return false;')
+    out.append('}')
+    out.append('')
+
+
+def write_compiled_contexts(xml_path, out_file):
+    out = ['// This file is autogenerated by regenerate-compiled-contexts.py',
+           '// Do not edit it',
+           '',
+           '#include <iterator>',
+           '',
+           '#include "compiled_contexts.h"',
+           '#include "context.h"',
+           '#include "match_result.h"',
+           '#include "text_to_match.h"',
+           '',
+           'namespace Qutepart {',
+           '',
+           'namespace {',
+           '']
+
+    entries = []
+    for file_name in sorted(COMPILED_FILES):
+        language = identifier(file_name)
+        for index, (context_name, rules) in enumerate(
+                load_contexts(os.path.join(xml_path, file_name))):
+            if all(rule.kind == 'generic' for rule in rules):
+                continue  # nothing to specialise, the interpreter dispatches better
+            function_name = 'match%sContext%d' % (language, index)
+            write_matcher(out, function_name, context_name, rules)
+            entries.append((file_name, context_name, len(rules), rule_names_hash(rules),
+                            function_name))
+
+    entries.sort(key=lambda entry: (entry[0], entry[1]))
+    out.append('constexpr CompiledContext compiledContextEntries[] = {')
+    for file_name, context_name, rule_count, names_hash, function_name in entries:
+        out.append('    {"%s", "%s", %d, 0x%08x, %s},' %
+                   (file_name, context_name.replace('\\', '\\\\').replace('"', '\\"'),
+                    rule_count, names_hash,
+                    function_name))
+    out.append('};')
+    out.append('')
+    out.append('} // namespace')
+    out.append('')
+    out.append('const LanguageDbTable<CompiledContext> compiledContexts = {')
+    out.append('    compiledContextEntries, std::size(compiledContextEntries)};')
+    out.append('')
+    out.append('} // namespace Qutepart')
+
+    with open(out_file, 'w', encoding='utf-8') as out_stream:
+        out_stream.write('\n'.join(out) + '\n')
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Regenerate compiled contexts .cpp file')
+    parser.add_argument('--xml_path', default='./syntax')
+    parser.add_argument('--out_file', default='src/hl/compiled_contexts_generated.cpp')
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    write_compiled_contexts(args.xml_path, args.out_file)
+
+
+if __name__ == '__main__':
+    main()
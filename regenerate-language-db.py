@@ -19,6 +19,34 @@ Syntax = collections.namedtuple('Syntax',
     ['name', 'extensions', 'firstLineGlobs', 'mimetype', 'priority', 'hidden', 'indenter'])
 
 
+# Several syntax files of the same priority claim these. Without the table the first file name in
+# sorted order would win, the table keeps the languages the editor has always chosen
+TIE_BREAKS = {
+    'mimeTypeToXmlFileName': {
+        'application/x-shellscript': 'zsh.xml',
+        'text/html': 'vue.xml',
+        'text/x-adasrc': 'gpr.xml',
+        'text/x-asm': 'gnuassembler.xml',
+        'text/x-c-hdr': 'objectivecpp.xml',
+        'text/x-sql': 'sql-postgresql.xml',
+    },
+    'extensionToXmlFileName': {
+        '*.ASM': 'picsrc.xml',
+        '*.asm': 'picsrc.xml',
+        '*.DDL': 'sql-postgresql.xml',
+        '*.ddl': 'sql-postgresql.xml',
+        '*.e': 'euphoria.xml',
+        '*.M': 'octave.xml',
+        '*.m': 'octave.xml',
+        '*.mm': 'objectivecpp.xml',
+        '*.profile': 'zsh.xml',
+        '*.sh': 'zsh.xml',
+        '*.SQL': 'sql-postgresql.xml',
+        '*.sql': 'sql-postgresql.xml',
+    },
+}
+
+
 def parseSemicolonSeparatedList(line):
     return [item
             for item in line.split(';')
@@ -82,13 +110,16 @@ def load_language_db(xmlFilesPath):
     _add_php('css-php.xml', 'css.xml')
     _add_php('html-php.xml', 'html.xml')
 
+    # Sorted, so languages of the same priority are chosen the same way on every run
     xmlFileNames = [fileName
-                    for fileName in os.listdir(xmlFilesPath)
+                    for fileName in sorted(os.listdir(xmlFilesPath))
                     if fileName.endswith('.xml')]
 
     languageNameToXmlFileName = {}
     mimeTypeToXmlFileName = {}
     extensionToXmlFileName = {}
+    claims = {'mimeTypeToXmlFileName': collections.defaultdict(set),
+              'extensionToXmlFileName': collections.defaultdict(set)}
     firstLineToXmlFileName = {}
     xmlFileNameToIndenter = {}
 
@@ -102,12 +133,14 @@ def load_language_db(xmlFilesPath):
 
         if syntax.mimetype:
             for mimetype in syntax.mimetype:
+                claims['mimeTypeToXmlFileName'][mimetype].add((syntax.priority, xmlFileName))
                 if not mimetype in mimeTypeToXmlFileName or \
                    mimeTypeToXmlFileName[mimetype][0] < syntax.priority:
                     mimeTypeToXmlFileName[mimetype] = (syntax.priority, xmlFileName)
 
         if syntax.extensions:
             for extension in syntax.extensions:
+                claims['extensionToXmlFileName'][extension].add((syntax.priority, xmlFileName))
                 if extension not in extensionToXmlFileName or \
                    extensionToXmlFileName[extension][0] < syntax.priority:
                     extensionToXmlFileName[extension] = (syntax.priority, xmlFileName)
@@ -121,6 +154,15 @@ def load_language_db(xmlFilesPath):
         if syntax.indenter is not None:
             xmlFileNameToIndenter[xmlFileName] = syntax.indenter
 
+    for tableName, table in (('mimeTypeToXmlFileName', mimeTypeToXmlFileName),
+                             ('extensionToXmlFileName', extensionToXmlFileName)):
+        for key, xmlFileName in TIE_BREAKS[tableName].items():
+            priority = table[key][0]
+            if (priority, xmlFileName) not in claims[tableName][key]:
+                raise UserWarning("Tie break '%s' of '%s' is not a syntax file of the top priority"
+                                  % (xmlFileName, key))
+            table[key] = (priority, xmlFileName)
+
     # remove priority, leave only xml file names
     for dictionary in (languageNameToXmlFileName,
                        mimeTypeToXmlFileName,
@@ -135,6 +177,9 @@ def load_language_db(xmlFilesPath):
     # Fix up php first line pattern. It contains <?php, but it is generated from html, and html doesn't contain it
     firstLineToXmlFileName['<?php*'] = 'html-php.xml'
 
+    # Markdown has its own indenter, the syntax file doesn't name it
+    xmlFileNameToIndenter['markdown.xml'] = 'markdown'
+
     return {
         'languageNameToXmlFileName' : languageNameToXmlFileName,
         'mimeTypeToXmlFileName' : mimeTypeToXmlFileName,
@@ -147,24 +192,110 @@ def load_language_db(xmlFilesPath):
 HEADER = """// This file is autogenerated by regenerate-language-db.py
 // Do not edit it
 
-#include <QMap>
-#include <QString>
+#include <iterator>
+
+#include "language_db.h"
 
 namespace Qutepart {"""
 
+FOOTER = """} // namespace Qutepart"""
+
+WILDCARD_CHARS = '*?[]\\'
+
+
+def c_string(value):
+    if not value.isascii():
+        raise UserWarning("Not ASCII value in the language DB '%s'" % value)
+    # Backslashes are escaped in the syntax files already, as in "\\documentclass"
+    return '"' + value.replace('"', '\\"') + '"'
+
+
+def split_file_name_globs(globToXmlFileName):
+    """Split the globs by shape, see src/hl/language_db.h.
+    Rank is the position of the glob in the sorted list, QMap order, the lowest rank matches first
+    """
+    exact = {}
+    suffix = {}
+    prefix = {}
+    residual = []
+    for rank, glob in enumerate(sorted(globToXmlFileName)):
+        value = globToXmlFileName[glob]
+        if not any(c in WILDCARD_CHARS for c in glob):
+            table, literal = exact, glob.lower()
+        elif glob.startswith('*') and not any(c in WILDCARD_CHARS for c in glob[1:]):
+            table, literal = suffix, glob[1:].lower()[::-1]
+        elif glob.endswith('*') and not any(c in WILDCARD_CHARS for c in glob[:-1]):
+            table, literal = prefix, glob[:-1].lower()
+        else:
+            residual.append((glob, value, rank))
+            continue
+
+        # Matching is not case sensitive, "*.C" and "*.c" are the same glob
+        if literal not in table:
+            table[literal] = (value, rank)
+
+    def entries(table):
+        return [(literal, value, rank) for literal, (value, rank) in sorted(table.items())]
+
+    return {
+        'fileNameGlobs': entries(exact),
+        'fileNameSuffixGlobs': entries(suffix),
+        'fileNamePrefixGlobs': entries(prefix),
+        'residualFileNameGlobs': residual,
+    }
+
+
+def write_table(out_file, name, entryType, entries):
+    if not entries:
+        return
+    print('', file=out_file)
+    print('constexpr {} {}Entries[] = {{'.format(entryType, name), file=out_file)
+    for entry in entries:
+        fields = [c_string(field) if isinstance(field, str) else str(field) for field in entry]
+        print('    {{{}}},'.format(', '.join(fields)), file=out_file)
+    print('};', file=out_file)
+
+
 def write_syntax_db(out_file_path, syntax_db):
+    def sortedItems(dictionary):
+        return sorted(dictionary.items())
+
+    languageNameToXmlFileName = syntax_db['languageNameToXmlFileName']
+    languageNames = sorted((xmlFileName, name)
+                           for name, xmlFileName in languageNameToXmlFileName.items())
+    globTables = split_file_name_globs(syntax_db['extensionToXmlFileName'])
+    firstLineGlobs = [(glob, value, rank)
+                      for rank, (glob, value)
+                      in enumerate(sortedItems(syntax_db['firstLineToXmlFileName']))]
+
+    tables = [
+        ('languageNameToXmlFileName', 'LanguageDbEntry', sortedItems(languageNameToXmlFileName)),
+        ('mimeTypeToXmlFileName', 'LanguageDbEntry', sortedItems(syntax_db['mimeTypeToXmlFileName'])),
+        ('xmlFileNameToIndenter', 'LanguageDbEntry', sortedItems(syntax_db['xmlFileNameToIndenter'])),
+        ('xmlFileNameToLanguageNames', 'LanguageDbEntry', languageNames),
+    ]
+    for name, entries in globTables.items():
+        tables.append((name, 'LanguageDbGlob', entries))
+    tables.append(('firstLineGlobs', 'LanguageDbGlob', firstLineGlobs))
+
     with open(out_file_path, 'w') as out_file:
         print(HEADER, file=out_file)
-        for key, valueMap in syntax_db.items():
-            print('', file=out_file)
-            print('QMap<QString,QString> create_{}() {{'.format(key), file=out_file)
-            print('\tQMap<QString,QString> {}; '.format(key), file=out_file)
-            for valKey, valValue in valueMap.items():
-                print('\t{}["{}"] = "{}";'.format(key, valKey, valValue), file=out_file)
-            print('\treturn {};'.format(key), file=out_file)
-            print('}}'.format(key), file=out_file)
-            print('QMap<QString,QString> {} = create_{}();'.format(key, key), file=out_file)
-        print ('}  // namespace Qutepart', file=out_file)
+        print('', file=out_file)
+        print('namespace {', file=out_file)
+        for name, entryType, entries in tables:
+            write_table(out_file, name, entryType, entries)
+        print('', file=out_file)
+        print('} // namespace', file=out_file)
+        print('', file=out_file)
+        for name, entryType, entries in tables:
+            if entries:
+                print('constexpr LanguageDbTable<{0}> {1} = {{\n    {1}Entries, std::size({1}Entries)}};'
+                      .format(entryType, name), file=out_file)
+            else:
+                print('constexpr LanguageDbTable<{}> {} = {{}};'.format(entryType, name),
+                      file=out_file)
+        print('', file=out_file)
+        print(FOOTER, file=out_file)
 
 
 def parse_args():
@@ -11,6 +11,7 @@
 #include <QScrollBar>
 
 #include "completer.h"
+#include "hl/memory_usage.h"
 #include "html_delegate.h"
 #include "qutepart.h"
 
@@ -391,6 +392,20 @@ void Completer::setCustomCompletions(const QSet<CompletionItem> &wordSet) {
 
 bool Completer::isVisible() const { return widget_ != nullptr; }
 
+size_t Completer::memoryUsage() const {
+    size_t result = keywords_.capacity() * sizeof(QString) +
+                    (customCompletions_.capacity() + wordSet_.capacity()) * sizeof(CompletionItem);
+    for (const auto &keyword : keywords_) {
+        result += stringMemoryUsage(keyword);
+    }
+    for (const auto &set : {&customCompletions_, &wordSet_}) {
+        for (const auto &item : *set) {
+            result += stringMemoryUsage(item.text) + stringMemoryUsage(item.source);
+        }
+    }
+    return result;
+}
+
 // Text in the qpart changed. Update word set
 void Completer::onTextChanged() { updateWordSetTimer_.start(); }
 
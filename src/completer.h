@@ -31,6 +31,12 @@ class Completer : public QObject {
     bool isVisible() const;
     bool invokeCompletionIfAvailable(bool requestedByUser);
 
+    // Estimated memory held by the word lists, in bytes
+    size_t memoryUsage() const;
+
+    // Collect the words of the document. Called after edits, once the typing pauses
+    void updateWordSet();
+
   public slots:
     void invokeCompletion();
 
@@ -41,7 +47,6 @@ class Completer : public QObject {
     void onCompletionListTabPressed();
 
   private:
-    void updateWordSet();
     bool shouldShowModel(CompletionModel *model, bool forceShow);
     void createWidget(CompletionModel *model);
     void closeCompletion();
@@ -6,53 +6,129 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
+#include <QMultiHash>
+#include <QMutex>
 #include <QStringList>
+#include <QVector>
 
 namespace Qutepart {
 
 class ContextSwitcher;
 class Context;
-struct ContextStackItem;
 class ContextStack;
+class ContextStackTable;
 
-size_t qHash(const ContextStackItem &key, uint seed = 0);
 size_t qHash(const ContextStack &key, uint seed = 0);
 
-struct ContextStackItem {
-    ContextStackItem();
-    ContextStackItem(const Context *context, const QStringList &data = QStringList());
-
-    bool operator==(const ContextStackItem &other) const;
-
+/* One level of an interned context stack. Nodes are immutable, a stack is represented by its top
+ * node. Nodes of stacks without data are owned by a ContextStackTable, the ones with data, see
+ * ContextStackTable, by the stacks which refer to them.
+ */
+struct ContextStackNode {
+    const ContextStackTable *table;
+    const ContextStackNode *parent; // nullptr for the root
+    std::shared_ptr<const ContextStackNode> parentOwner; // if the parent is owned by the stacks
     const Context *context;
     QStringList data;
+    size_t hash; // of the whole stack
+    int depth;   // 1 for the root
+    int id;      // unique in the table
+
+    // Owned by the stacks which refer to it
+    inline bool hasData() const { return !data.isEmpty() || parentOwner != nullptr; }
+
+    // Children without data, looked up without locking the table. See ContextStackTable::push()
+    static constexpr int CHILD_SLOTS = 4;
+    mutable std::atomic<const ContextStackNode *> children[CHILD_SLOTS] = {};
 };
 
+/* Persistent context stack.
+ * Stacks are interned in a ContextStackTable: equal stacks share the same node, so comparing
+ * stacks compares pointers, and switching contexts does not copy anything.
+ */
 class ContextStack {
   public:
-    ContextStack(Context *context);
+    // Null stack, i.e. of a block which has not been highlighted yet
+    ContextStack() : node(nullptr) {}
 
-    bool operator==(const ContextStack &other) const;
-    bool operator!=(const ContextStack &other) const;
+    inline bool isNull() const { return node == nullptr; }
 
-  private:
-    ContextStack(const QVector<ContextStackItem> &items);
+    inline bool operator==(const ContextStack &other) const { return node == other.node; }
+    inline bool operator!=(const ContextStack &other) const { return node != other.node; }
 
-  public:
     // Apply context switch operation and return new context
     ContextStack switchContext(const ContextSwitcher &operation,
                                const QStringList &data = QStringList()) const;
 
-    // Get current context
-    const Context *currentContext() const;
+    // Get current context. nullptr for a null stack
+    inline const Context *currentContext() const { return node ? node->context : nullptr; }
 
-    // Get current data
-    const QStringList &currentData() const;
+    // Get current data. Shall not be called for a null stack
+    inline const QStringList &currentData() const { return node->data; }
+
+    inline int depth() const { return node->depth; }
+
+    // Unique in the table, suitable as a block state
+    inline int id() const { return node->id; }
 
   private:
-    QVector<ContextStackItem> items;
+    explicit ContextStack(const ContextStackNode *node,
+                          std::shared_ptr<const ContextStackNode> owner = nullptr)
+        : node(node), owner(std::move(owner)) {}
+
+    const ContextStackNode *node;
+    std::shared_ptr<const ContextStackNode> owner; // of the node, if it has data
 
+    friend class ContextStackTable;
     friend size_t qHash(const ContextStack &key, uint seed);
 };
 
+/* Owner of the interned context stacks of a language. Interning is thread safe.
+ *
+ * Stacks without data are bounded by the grammar and the nesting in the documents, their nodes
+ * live as long as the table. Stacks with data, i.e. of heredocs, are one per delimiter, and
+ * languages are shared by all the documents of the process. Their nodes are deleted with the
+ * last stack which refers to them, i.e. when the blocks are highlighted again or the document
+ * is closed. The table remembers them weakly, and drops the deleted ones when it has
+ * DATA_STACKS_SWEEP_SIZE of them.
+ */
+class ContextStackTable {
+  public:
+    static constexpr int DATA_STACKS_SWEEP_SIZE = 1 << 16;
+
+    explicit ContextStackTable(const Context *rootContext);
+    ~ContextStackTable();
+
+    ContextStackTable(const ContextStackTable &) = delete;
+    ContextStackTable &operator=(const ContextStackTable &) = delete;
+
+    // Stack containing only the root context
+    inline ContextStack root() const { return ContextStack(rootNode); }
+
+    // Count of interned stacks, including deleted stacks with data not dropped yet
+    int size() const;
+
+    // Estimated memory held by the interned stacks, in bytes
+    size_t memoryUsage() const;
+
+  private:
+    ContextStack push(const ContextStack &parent, const Context *context,
+                      const QStringList &data) const;
+    ContextStack pushWithData(const ContextStack &parent, const Context *context,
+                              const QStringList &data, size_t hash) const;
+    void sweepDataNodes() const;
+
+    mutable QMutex mutex;
+    mutable QMultiHash<size_t, ContextStackNode *> nodes; // by hash
+    mutable QMultiHash<size_t, std::weak_ptr<const ContextStackNode>> dataNodes;
+    mutable int dataNodesLimit = DATA_STACKS_SWEEP_SIZE;
+    mutable int nextId = 0;
+    const ContextStackNode *rootNode;
+
+    friend class ContextStack;
+};
+
 } // namespace Qutepart
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include <QDebug>
+
+#include "compiled_contexts.h"
+
+namespace Qutepart {
+
+std::atomic<bool> compiledMatchersEnabled{true};
+
+void setCompiledMatchersEnabled(bool enabled) {
+    compiledMatchersEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+namespace {
+
+struct FileNameLess {
+    bool operator()(const CompiledContext &entry, QStringView fileName) const {
+        return fileName.compare(QLatin1String(entry.fileName)) > 0;
+    }
+    bool operator()(QStringView fileName, const CompiledContext &entry) const {
+        return fileName.compare(QLatin1String(entry.fileName)) < 0;
+    }
+};
+
+} // namespace
+
+void attachCompiledMatchers(const QString &xmlFileName, const QList<ContextPtr> &contexts) {
+    auto range = std::equal_range(compiledContexts.begin(), compiledContexts.end(),
+                                  QStringView(xmlFileName), FileNameLess());
+
+    for (auto it = range.first; it != range.second; ++it) {
+        auto contextName = QString::fromUtf8(it->contextName);
+        auto context = std::find_if(contexts.cbegin(), contexts.cend(),
+                                    [&contextName](const ContextPtr &context) {
+                                        return context->name() == contextName;
+                                    });
+        if (context == contexts.cend() ||
+            !(*context)->setCompiledMatcher(it->matcher, it->ruleCount, it->ruleNamesHash)) {
+            qWarning() << "Compiled context" << contextName << "of" << xmlFileName
+                       << "doesn't match the syntax file. Regenerate the compiled contexts";
+        }
+    }
+}
+
+} // namespace Qutepart
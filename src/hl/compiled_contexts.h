@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QList>
+#include <QString>
+
+#include "context.h"
+#include "language_db.h"
+
+namespace Qutepart {
+
+/* Matchers of the contexts of the most used syntax files, generated by
+ * regenerate-compiled-contexts.py to compiled_contexts_generated.cpp.
+ *
+ * A matcher does the same as Context::tryMatch(). It switches on the first character, and checks
+ * the simple rules inline. All other rules are tried by the interpreter, see
+ * Context::tryRulesFromCompiled().
+ */
+struct CompiledContext {
+    const char *fileName;
+    const char *contextName;
+    // The matcher refers to the rules by index, it is used only if the loaded rules are the same
+    int ruleCount;
+    quint32 ruleNamesHash;
+    CompiledMatcher matcher;
+};
+
+// Sorted by file name
+extern const LanguageDbTable<CompiledContext> compiledContexts;
+
+// Attach the matchers of the syntax file to its contexts. Called by the loader
+void attachCompiledMatchers(const QString &xmlFileName, const QList<ContextPtr> &contexts);
+
+// Enabled by default. When disabled all the contexts are interpreted, i.e. to compare the results
+extern std::atomic<bool> compiledMatchersEnabled;
+inline bool areCompiledMatchersEnabled() {
+    return compiledMatchersEnabled.load(std::memory_order_relaxed);
+}
+void setCompiledMatchersEnabled(bool enabled);
+
+} // namespace Qutepart
@@ -0,0 +1,5155 @@
+// This file is autogenerated by regenerate-compiled-contexts.py
+// Do not edit it
+
+#include <iterator>
+
+#include "compiled_contexts.h"
+#include "context.h"
+#include "match_result.h"
+#include "text_to_match.h"
+
+namespace Qutepart {
+
+namespace {
+
+// Normal Text
+bool matchCmakeContext0(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'#':
+        if (context.tryRulesFromCompiled(1, 106, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(106, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 106, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(107, textToMatch.countWordChars(), false, result);
+    }
+    if (context.tryRulesFromCompiled(108, 110, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// break_ctx
+bool matchCmakeContext1(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// cmake_host_system_information_ctx
+bool matchCmakeContext3(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// cmake_minimum_required_ctx
+bool matchCmakeContext5(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// cmake_parse_arguments_ctx
+bool matchCmakeContext7(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// cmake_policy_ctx
+bool matchCmakeContext9(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// configure_file_ctx
+bool matchCmakeContext11(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// continue_ctx
+bool matchCmakeContext13(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// elseif_ctx
+bool matchCmakeContext15(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// elseif_ctx_op
+bool matchCmakeContext16(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// else_ctx
+bool matchCmakeContext18(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// endforeach_ctx
+bool matchCmakeContext20(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// endfunction_ctx
+bool matchCmakeContext22(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// endif_ctx
+bool matchCmakeContext24(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// endmacro_ctx
+bool matchCmakeContext26(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// endwhile_ctx
+bool matchCmakeContext28(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// execute_process_ctx
+bool matchCmakeContext30(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// file_ctx
+bool matchCmakeContext32(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// find_file_ctx
+bool matchCmakeContext34(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// find_library_ctx
+bool matchCmakeContext36(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// find_package_ctx
+bool matchCmakeContext38(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// find_path_ctx
+bool matchCmakeContext40(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// find_program_ctx
+bool matchCmakeContext42(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// foreach_ctx
+bool matchCmakeContext44(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// function_ctx
+bool matchCmakeContext46(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// get_cmake_property_ctx
+bool matchCmakeContext48(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// get_directory_property_ctx
+bool matchCmakeContext50(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// get_filename_component_ctx
+bool matchCmakeContext52(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// get_property_ctx
+bool matchCmakeContext54(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// if_ctx
+bool matchCmakeContext56(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// if_ctx_op
+bool matchCmakeContext57(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// include_ctx
+bool matchCmakeContext59(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// include_guard_ctx
+bool matchCmakeContext61(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// list_ctx
+bool matchCmakeContext63(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// macro_ctx
+bool matchCmakeContext65(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// mark_as_advanced_ctx
+bool matchCmakeContext67(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// math_ctx
+bool matchCmakeContext69(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// message_ctx
+bool matchCmakeContext71(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// option_ctx
+bool matchCmakeContext73(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// return_ctx
+bool matchCmakeContext75(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// separate_arguments_ctx
+bool matchCmakeContext77(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// set_directory_properties_ctx
+bool matchCmakeContext79(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// set_property_ctx
+bool matchCmakeContext81(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// set_ctx
+bool matchCmakeContext83(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// site_name_ctx
+bool matchCmakeContext85(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// string_ctx
+bool matchCmakeContext87(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// unset_ctx
+bool matchCmakeContext89(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// variable_watch_ctx
+bool matchCmakeContext91(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// while_ctx
+bool matchCmakeContext93(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// while_ctx_op
+bool matchCmakeContext94(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// add_compile_definitions_ctx
+bool matchCmakeContext96(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_compile_options_ctx
+bool matchCmakeContext98(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_custom_command_ctx
+bool matchCmakeContext100(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_custom_target_ctx
+bool matchCmakeContext102(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_definitions_ctx
+bool matchCmakeContext104(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_dependencies_ctx
+bool matchCmakeContext106(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_executable_ctx
+bool matchCmakeContext108(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_library_ctx
+bool matchCmakeContext110(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_subdirectory_ctx
+bool matchCmakeContext112(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// add_test_ctx
+bool matchCmakeContext114(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// aux_source_directory_ctx
+bool matchCmakeContext116(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// build_command_ctx
+bool matchCmakeContext118(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// create_test_sourcelist_ctx
+bool matchCmakeContext120(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// define_property_ctx
+bool matchCmakeContext122(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// enable_language_ctx
+bool matchCmakeContext124(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// enable_testing_ctx
+bool matchCmakeContext126(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// export_ctx
+bool matchCmakeContext128(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// fltk_wrap_ui_ctx
+bool matchCmakeContext130(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// get_source_file_property_ctx
+bool matchCmakeContext132(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// get_target_property_ctx
+bool matchCmakeContext134(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// get_test_property_ctx
+bool matchCmakeContext136(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// include_directories_ctx
+bool matchCmakeContext138(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// include_external_msproject_ctx
+bool matchCmakeContext140(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// include_regular_expression_ctx
+bool matchCmakeContext142(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// install_ctx
+bool matchCmakeContext144(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// link_directories_ctx
+bool matchCmakeContext146(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// link_libraries_ctx
+bool matchCmakeContext148(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// load_cache_ctx
+bool matchCmakeContext150(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// project_ctx
+bool matchCmakeContext152(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// qt_wrap_cpp_ctx
+bool matchCmakeContext154(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// qt_wrap_ui_ctx
+bool matchCmakeContext156(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// remove_definitions_ctx
+bool matchCmakeContext158(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// set_source_files_properties_ctx
+bool matchCmakeContext160(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// set_target_properties_ctx
+bool matchCmakeContext162(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// set_tests_properties_ctx
+bool matchCmakeContext164(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// source_group_ctx
+bool matchCmakeContext166(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// target_compile_definitions_ctx
+bool matchCmakeContext168(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// target_compile_features_ctx
+bool matchCmakeContext170(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// target_compile_options_ctx
+bool matchCmakeContext172(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// target_include_directories_ctx
+bool matchCmakeContext174(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// target_link_libraries_ctx
+bool matchCmakeContext176(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// target_sources_ctx
+bool matchCmakeContext178(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// try_compile_ctx
+bool matchCmakeContext180(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// try_run_ctx
+bool matchCmakeContext182(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_build_ctx
+bool matchCmakeContext184(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_configure_ctx
+bool matchCmakeContext186(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_coverage_ctx
+bool matchCmakeContext188(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_empty_binary_directory_ctx
+bool matchCmakeContext190(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_memcheck_ctx
+bool matchCmakeContext192(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_read_custom_files_ctx
+bool matchCmakeContext194(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_run_script_ctx
+bool matchCmakeContext196(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_sleep_ctx
+bool matchCmakeContext198(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_start_ctx
+bool matchCmakeContext200(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_submit_ctx
+bool matchCmakeContext202(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_test_ctx
+bool matchCmakeContext204(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_update_ctx
+bool matchCmakeContext206(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// ctest_upload_ctx
+bool matchCmakeContext208(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// EndCmdPop
+bool matchCmakeContext214(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u')':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// EndCmdPop2
+bool matchCmakeContext215(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u')':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// User Function
+bool matchCmakeContext216(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'(':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Detect Variable Substitutions
+bool matchCmakeContext220(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'$':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'{')) {
+            return context.matchedFromCompiled(1, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// VarSubst
+bool matchCmakeContext221(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'}':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(1, textToMatch.countWordChars(), false, result);
+    }
+    if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// @VarSubst
+bool matchCmakeContext222(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'@':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// VarSubst@
+bool matchCmakeContext223(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'@':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(1, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// User Function Args
+bool matchCmakeContext224(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'#':
+        if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(6, 1, false, result);
+    case 0x005c:
+        if (text.size() >= 2 && text.at(1) == QChar(u'(')) {
+            return context.matchedFromCompiled(0, 2, false, result);
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u')')) {
+            return context.matchedFromCompiled(1, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(7, 12, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(7, 12, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Comment
+bool matchCmakeContext227(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(0, 1, true, result);
+        }
+        if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Detect Generator Expressions
+bool matchCmakeContext232(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'$':
+        if (text.size() >= 2 && text.at(1) == QChar(u'<')) {
+            return context.matchedFromCompiled(0, 2, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    return false;
+}
+
+// Generator Expression
+bool matchCmakeContext233(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'#':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'>':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(3, 6, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// DetectNSEnd
+bool matchCppContext3(const Context &context, const TextToMatch &textToMatch,
+                      MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u' ':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'!':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'%':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'&':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'(':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u')':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'*':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'+':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u',':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'-':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'.':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'/':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u';':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'<':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'=':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'>':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'?':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'[':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u']':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'^':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'{':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'|':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'}':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'~':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(0, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// Main
+bool matchIsocppContext0(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'!':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'$':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(20, 1, false, result);
+    case u'%':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'&':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'(':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u')':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'*':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'+':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u',':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(6, 1, false, result);
+    case u'-':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'.':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'/':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u':':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u';':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(6, 1, false, result);
+    case u'<':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'=':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'>':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'?':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'@':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(20, 1, false, result);
+    case u'B':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("BOOST_"))) {
+            return context.matchedFromCompiled(13, 6, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'[':
+        if (text.size() >= 2 && text.at(1) == QChar(u'[')) {
+            return context.matchedFromCompiled(3, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u']':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'^':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'`':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(20, 1, false, result);
+    case u'a':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("aux::"))) {
+            return context.matchedFromCompiled(16, 5, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'b':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("boost::"))) {
+            return context.matchedFromCompiled(12, 7, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'd':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("detail::"))) {
+            return context.matchedFromCompiled(14, 8, false, result);
+        }
+        if (text.startsWith(QLatin1String("details::"))) {
+            return context.matchedFromCompiled(15, 9, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'i':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("internals::"))) {
+            return context.matchedFromCompiled(17, 11, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u's':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("std::"))) {
+            return context.matchedFromCompiled(11, 5, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'{':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'|':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'}':
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'~':
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// match comments
+bool matchIsocppContext1(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'/':
+        if (text.size() >= 2 && text.at(1) == QChar(u'/')) {
+            return context.matchedFromCompiled(0, 2, false, result);
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'*')) {
+            return context.matchedFromCompiled(1, 2, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    return false;
+}
+
+// MatchComment
+bool matchIsocppContext2(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'/':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'/')) {
+            return context.matchedFromCompiled(1, 2, false, result);
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'*')) {
+            return context.matchedFromCompiled(2, 2, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// match comments and region markers
+bool matchIsocppContext3(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'/':
+        if (text.size() >= 2 && text.at(1) == QChar(u'/')) {
+            return context.matchedFromCompiled(0, 2, false, result);
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'*')) {
+            return context.matchedFromCompiled(1, 2, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    return false;
+}
+
+// MatchCommentAndRegionMarkers
+bool matchIsocppContext4(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'/':
+        if (textToMatch.firstNonSpace && text.startsWith(QLatin1String("//BEGIN"))) {
+            return context.matchedFromCompiled(0, 7, false, result);
+        }
+        if (textToMatch.firstNonSpace && text.startsWith(QLatin1String("//END"))) {
+            return context.matchedFromCompiled(1, 5, false, result);
+        }
+        if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// match string
+bool matchIsocppContext6(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(0, 1, false, result);
+    case 0x0027:
+        return context.matchedFromCompiled(10, 1, false, result);
+    case u'L':
+        if (text.size() >= 2 && text.at(1) == QChar(u'"')) {
+            return context.matchedFromCompiled(3, 2, false, result);
+        }
+        if (text.startsWith(QLatin1String("LR\""))) {
+            return context.matchedFromCompiled(8, 3, false, result);
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(0x0027)) {
+            return context.matchedFromCompiled(11, 2, false, result);
+        }
+        return false;
+    case u'R':
+        if (text.size() >= 2 && text.at(1) == QChar(u'"')) {
+            return context.matchedFromCompiled(5, 2, false, result);
+        }
+        return false;
+    case u'U':
+        if (text.size() >= 2 && text.at(1) == QChar(u'"')) {
+            return context.matchedFromCompiled(1, 2, false, result);
+        }
+        if (text.startsWith(QLatin1String("UR\""))) {
+            return context.matchedFromCompiled(7, 3, false, result);
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(0x0027)) {
+            return context.matchedFromCompiled(13, 2, false, result);
+        }
+        return false;
+    case u'u':
+        if (text.size() >= 2 && text.at(1) == QChar(u'"')) {
+            return context.matchedFromCompiled(2, 2, false, result);
+        }
+        if (text.startsWith(QLatin1String("u8\""))) {
+            return context.matchedFromCompiled(4, 3, false, result);
+        }
+        if (text.startsWith(QLatin1String("uR\""))) {
+            return context.matchedFromCompiled(6, 3, false, result);
+        }
+        if (text.startsWith(QLatin1String("u8R\""))) {
+            return context.matchedFromCompiled(9, 4, false, result);
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(0x0027)) {
+            return context.matchedFromCompiled(12, 2, false, result);
+        }
+        if (text.startsWith(QLatin1String("u8'"))) {
+            return context.matchedFromCompiled(14, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    return false;
+}
+
+// match identifier
+bool matchIsocppContext7(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (context.tryRulesFromCompiled(0, 9, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(9, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// IntSuffix
+bool matchIsocppContext10(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        return context.matchedFromCompiled(0, 1, false, result);
+    case u'L':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'U':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'_':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'd':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'h':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'i':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'l':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'm':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'n':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u's':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'u':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'y':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// IntSuffixPattern
+bool matchIsocppContext11(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'_':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// FloatSuffix
+bool matchIsocppContext12(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'F':
+        return context.matchedFromCompiled(0, 1, false, result);
+    case u'L':
+        return context.matchedFromCompiled(0, 1, false, result);
+    case u'_':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'f':
+        return context.matchedFromCompiled(0, 1, false, result);
+    case u'l':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// CheckUDLOperator
+bool matchIsocppContext15(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (text.size() >= 2 && text.at(1) == QChar(u'"')) {
+            return context.matchedFromCompiled(1, 2, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    return false;
+}
+
+// UDLOperatorName
+bool matchIsocppContext16(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Char8 Literal
+bool matchIsocppContext18(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Char16 Literal
+bool matchIsocppContext19(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Char32 Literal
+bool matchIsocppContext20(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Char Literal Close
+bool matchIsocppContext21(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// string special char
+bool matchIsocppContext27(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(2, 1, true, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// string normal char
+bool matchIsocppContext28(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Attribute
+bool matchIsocppContext30(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'!':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(4, 1, false, result);
+    case u'%':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'&':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'(':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u')':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'*':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'+':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u',':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'-':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'.':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'/':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'0':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'1':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'2':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'3':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'4':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'5':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'6':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'7':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'8':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'9':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u':':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'<':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'=':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'>':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'?':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'[':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u']':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u']')) {
+            return context.matchedFromCompiled(1, 2, false, result);
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'^':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'{':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'|':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'}':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'~':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(6, 9, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(9, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// AttributeNamespace
+bool matchIsocppContext32(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(2, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// DetectNSEnd
+bool matchIsocppContext36(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0009:
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u' ':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'!':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'%':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'&':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'(':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u')':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'*':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'+':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u',':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'-':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'.':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'/':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u';':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'<':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'=':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'>':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'?':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'[':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u']':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'^':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'{':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'|':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'}':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u'~':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(3, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(1, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// Comment 1
+bool matchIsocppContext43(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(0, 1, true, result);
+        }
+        if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(1, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(4, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// Comment 2
+bool matchIsocppContext44(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'*':
+        if (text.size() >= 2 && text.at(1) == QChar(u'/')) {
+            return context.matchedFromCompiled(2, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(3, 5, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(1, 1, true, result);
+        }
+        if (context.tryRulesFromCompiled(3, 5, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(3, 5, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(5, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// AfterHashLineError
+bool matchIsocppContext46(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(0, 1, true, result);
+        }
+        if (context.tryRulesFromCompiled(1, 10, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 10, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// LineError
+bool matchIsocppContext47(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(0, 1, true, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    return false;
+}
+
+// Include
+bool matchIsocppContext49(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(0, 1, true, result);
+        }
+        if (context.tryRulesFromCompiled(1, 4, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// PreprocessorEndOfLineSpace
+bool matchIsocppContext52(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Preprocessor
+bool matchIsocppContext53(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(0, 1, true, result);
+        }
+        if (context.tryRulesFromCompiled(1, 4, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Define
+bool matchIsocppContext54(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'/':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'/')) {
+            return context.matchedFromCompiled(2, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'*')) {
+            return context.matchedFromCompiled(4, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(5, 6, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(5, 6, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(6, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// In Define
+bool matchIsocppContext55(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'!':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'#':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(20, 1, false, result);
+    case u'$':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(21, 1, false, result);
+    case u'%':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'&':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'(':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u')':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'*':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'+':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u',':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(6, 1, false, result);
+    case u'-':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'.':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'/':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u':':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u';':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(6, 1, false, result);
+    case u'<':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'=':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'>':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'?':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'@':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(21, 1, false, result);
+    case u'B':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("BOOST_"))) {
+            return context.matchedFromCompiled(13, 6, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'[':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'[')) {
+            return context.matchedFromCompiled(3, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u']':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'^':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'`':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(21, 1, false, result);
+    case u'a':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("aux::"))) {
+            return context.matchedFromCompiled(16, 5, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'b':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("boost::"))) {
+            return context.matchedFromCompiled(12, 7, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'd':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("detail::"))) {
+            return context.matchedFromCompiled(14, 8, false, result);
+        }
+        if (text.startsWith(QLatin1String("details::"))) {
+            return context.matchedFromCompiled(15, 9, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'i':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("internals::"))) {
+            return context.matchedFromCompiled(17, 11, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u's':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("std::"))) {
+            return context.matchedFromCompiled(11, 5, false, result);
+        }
+        if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'{':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'|':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'}':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'~':
+        if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(4, 6, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(18, 20, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// InPreprocessor
+bool matchIsocppContext56(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(0, 1, true, result);
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// Outscoped Common
+bool matchIsocppContext57(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'*':
+        if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'/')) {
+            return context.matchedFromCompiled(4, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(5, 7, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case 0x005c:
+        if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(5, 7, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(7, 1, true, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(3, textToMatch.countWordChars(), false, result);
+    }
+    if (context.tryRulesFromCompiled(5, 7, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Outscoped
+bool matchIsocppContext58(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Inscoped
+bool matchIsocppContext61(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Inscoped AfterHash
+bool matchIsocppContext62(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Outscoped intern
+bool matchIsocppContext63(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'*':
+        if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'/')) {
+            return context.matchedFromCompiled(4, 2, false, result);
+        }
+        if (context.tryRulesFromCompiled(5, 9, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(3, textToMatch.countWordChars(), false, result);
+    }
+    if (context.tryRulesFromCompiled(5, 9, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Normal
+bool matchJsonContext0(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'[':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'{':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(2, textToMatch.countSpaces(), false, result);
+    }
+    return false;
+}
+
+// Pair
+bool matchJsonContext1(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(0, 1, false, result);
+    case u',':
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u':':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'}':
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(4, textToMatch.countSpaces(), false, result);
+    }
+    return false;
+}
+
+// String_Key
+bool matchJsonContext2(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Value
+bool matchJsonContext3(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(0, 1, false, result);
+    case u',':
+        return context.matchedFromCompiled(4, 1, false, result);
+    case u'[':
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'{':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'}':
+        return context.matchedFromCompiled(3, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(5, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(6, 9, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// String_Value
+bool matchJsonContext4(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Array
+bool matchJsonContext5(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(4, 1, false, result);
+    case u',':
+        return context.matchedFromCompiled(0, 1, false, result);
+    case u'[':
+        return context.matchedFromCompiled(3, 1, false, result);
+    case u']':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'{':
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(5, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(6, 9, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Normal Text
+bool matchMarkdownContext0(const Context &context, const TextToMatch &textToMatch,
+                           MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'>':
+        if (textToMatch.currentColumnIndex == 0) {
+            return context.matchedFromCompiled(0, 1, false, result);
+        }
+        if (context.tryRulesFromCompiled(1, 16, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 16, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// inc
+bool matchMarkdownContext8(const Context &context, const TextToMatch &textToMatch,
+                           MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'`':
+        if (context.tryRulesFromCompiled(0, 14, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("```"))) {
+            return context.matchedFromCompiled(14, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 14, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Normal
+bool matchPythonContext0(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'!':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'#':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(22, 1, false, result);
+    case u'%':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'&':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'(':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(20, 1, false, result);
+    case u'*':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'+':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'-':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'/':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u';':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'<':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'=':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'>':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'@':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'[':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(19, 1, false, result);
+    case 0x005c:
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'^':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'{':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(18, 1, false, result);
+    case u'|':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    case u'~':
+        if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(25, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 18, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(21, 22, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(23, 25, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// #CheckForString
+bool matchPythonContext1(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(1, 1, true, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    return false;
+}
+
+// CheckForStringNext
+bool matchPythonContext2(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        if (text.size() == 1) {
+            return context.matchedFromCompiled(1, 1, true, result);
+        }
+        if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// StringVariants
+bool matchPythonContext3(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 17, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// CommentVariants
+bool matchPythonContext4(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(1, 9, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Dictionary
+bool matchPythonContext5(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'}':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// List
+bool matchPythonContext6(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u']':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Tuple
+bool matchPythonContext7(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u')':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Triple A-comment
+bool matchPythonContext9(const Context &context, const TextToMatch &textToMatch,
+                         MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("'''"))) {
+            return context.matchedFromCompiled(1, 3, false, result);
+        }
+        if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Triple Q-comment
+bool matchPythonContext10(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("\"\"\""))) {
+            return context.matchedFromCompiled(1, 3, false, result);
+        }
+        if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Single A-comment
+bool matchPythonContext11(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Single Q-comment
+bool matchPythonContext12(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// stringformat
+bool matchPythonContext13(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'{':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'{')) {
+            return context.matchedFromCompiled(2, 2, false, result);
+        }
+        return false;
+    case u'}':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.size() >= 2 && text.at(1) == QChar(u'}')) {
+            return context.matchedFromCompiled(3, 2, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// stringinterpolation
+bool matchPythonContext15(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'{':
+        if (text.size() >= 2 && text.at(1) == QChar(u'{')) {
+            return context.matchedFromCompiled(0, 2, false, result);
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// String Interpolation
+bool matchPythonContext16(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x005c:
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(1, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Triple A-string
+bool matchPythonContext17(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("'''"))) {
+            return context.matchedFromCompiled(2, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Raw Triple A-string
+bool matchPythonContext18(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("'''"))) {
+            return context.matchedFromCompiled(2, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Triple A-F-String
+bool matchPythonContext19(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("'''"))) {
+            return context.matchedFromCompiled(2, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Raw Triple A-F-String
+bool matchPythonContext20(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("'''"))) {
+            return context.matchedFromCompiled(2, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Triple Q-string
+bool matchPythonContext21(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("\"\"\""))) {
+            return context.matchedFromCompiled(2, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Raw Triple Q-string
+bool matchPythonContext22(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("\"\"\""))) {
+            return context.matchedFromCompiled(2, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Triple Q-F-String
+bool matchPythonContext23(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("\"\"\""))) {
+            return context.matchedFromCompiled(2, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Raw Triple Q-F-String
+bool matchPythonContext24(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("\"\"\""))) {
+            return context.matchedFromCompiled(2, 3, false, result);
+        }
+        return false;
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Single A-string
+bool matchPythonContext25(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Raw A-string
+bool matchPythonContext26(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Single A-F-String
+bool matchPythonContext27(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Raw A-F-String
+bool matchPythonContext28(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Single Q-string
+bool matchPythonContext29(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Raw Q-string
+bool matchPythonContext30(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Single Q-F-String
+bool matchPythonContext31(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// Raw Q-F-String
+bool matchPythonContext32(const Context &context, const TextToMatch &textToMatch,
+                          MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(2, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 2, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// normal
+bool matchYamlContext0(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(0, 3, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 14, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(15, 1, false, result);
+    case u'#':
+        if (context.tryRulesFromCompiled(0, 3, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(4, 1, false, result);
+    case 0x0027:
+        if (context.tryRulesFromCompiled(0, 3, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 14, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(14, 1, false, result);
+    case u'-':
+        if (context.tryRulesFromCompiled(0, 3, textToMatch, result)) {
+            return true;
+        }
+        if (textToMatch.firstNonSpace) {
+            return context.matchedFromCompiled(5, 1, false, result);
+        }
+        if (context.tryRulesFromCompiled(8, 14, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'[':
+        if (context.tryRulesFromCompiled(0, 3, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(6, 1, false, result);
+    case u'{':
+        if (context.tryRulesFromCompiled(0, 3, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 3, textToMatch, result)) {
+        return true;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(3, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(8, 14, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// dash
+bool matchYamlContext1(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'#':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(2, 7, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// header
+bool matchYamlContext2(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'#':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// attribute
+bool matchYamlContext5(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'#':
+        return context.matchedFromCompiled(0, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// attribute-inline
+bool matchYamlContext6(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'#':
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u',':
+        return context.matchedFromCompiled(0, 1, false, result);
+    case u'}':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    return false;
+}
+
+// attribute-pre
+bool matchYamlContext7(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'#':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case 0x0027:
+        if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(6, 1, false, result);
+    case u'[':
+        if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(4, 1, false, result);
+    case u'{':
+        if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(2, 4, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(8, 11, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// attribute-pre-inline
+bool matchYamlContext8(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(7, 1, false, result);
+    case u'#':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case 0x0027:
+        if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(6, 1, false, result);
+    case u',':
+        if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 10, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(10, 1, false, result);
+    case u'[':
+        if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(4, 1, false, result);
+    case u'n':
+        if (text.startsWith(QLatin1String("null"))) {
+            return context.matchedFromCompiled(2, 4, false, result);
+        }
+        if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 10, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(12, 13, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'{':
+        if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    case u'}':
+        if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(8, 10, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(11, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(3, 4, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(8, 10, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(12, 13, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// list
+bool matchYamlContext9(const Context &context, const TextToMatch &textToMatch,
+                       MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        if (context.tryRulesFromCompiled(3, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(7, 8, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(10, 12, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(13, 1, false, result);
+    case u'#':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case 0x0027:
+        if (context.tryRulesFromCompiled(3, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(7, 8, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(10, 12, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(12, 1, false, result);
+    case u',':
+        if (context.tryRulesFromCompiled(3, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(7, 8, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(10, 12, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(14, 1, false, result);
+    case u'[':
+        if (context.tryRulesFromCompiled(3, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(7, 8, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(8, 1, false, result);
+    case u']':
+        return context.matchedFromCompiled(2, 1, false, result);
+    case u'n':
+        if (context.tryRulesFromCompiled(3, 6, textToMatch, result)) {
+            return true;
+        }
+        if (text.startsWith(QLatin1String("null"))) {
+            return context.matchedFromCompiled(6, 4, false, result);
+        }
+        if (context.tryRulesFromCompiled(7, 8, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(10, 12, textToMatch, result)) {
+            return true;
+        }
+        return false;
+    case u'{':
+        if (context.tryRulesFromCompiled(3, 6, textToMatch, result)) {
+            return true;
+        }
+        if (context.tryRulesFromCompiled(7, 8, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(9, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(3, 6, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(7, 8, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(10, 12, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// hash
+bool matchYamlContext10(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'#':
+        return context.matchedFromCompiled(1, 1, false, result);
+    case u'}':
+        if (context.tryRulesFromCompiled(2, 5, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(5, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.countSpaces() > 0) {
+        return context.matchedFromCompiled(0, textToMatch.countSpaces(), false, result);
+    }
+    if (context.tryRulesFromCompiled(2, 5, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// attribute-string
+bool matchYamlContext11(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(0, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// attribute-stringx
+bool matchYamlContext12(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(0, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// attribute-string-inline
+bool matchYamlContext13(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(0, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// attribute-stringx-inline
+bool matchYamlContext14(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(0, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// attribute-end-inline
+bool matchYamlContext16(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'}':
+        if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+            return true;
+        }
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (context.tryRulesFromCompiled(0, 1, textToMatch, result)) {
+        return true;
+    }
+    if (context.tryRulesFromCompiled(2, 3, textToMatch, result)) {
+        return true;
+    }
+    return false;
+}
+
+// string
+bool matchYamlContext17(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case 0x0027:
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(0, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+// stringx
+bool matchYamlContext18(const Context &context, const TextToMatch &textToMatch,
+                        MatchResult &result) {
+    [[maybe_unused]] const QStringView text = textToMatch.text;
+    switch (text.at(0).unicode()) {
+    case u'"':
+        return context.matchedFromCompiled(1, 1, false, result);
+    default:
+        break;
+    }
+    if (textToMatch.isLetter()) {
+        return context.matchedFromCompiled(0, textToMatch.countWordChars(), false, result);
+    }
+    return false;
+}
+
+constexpr CompiledContext compiledContextEntries[] = {
+    {"cmake.xml", "@VarSubst", 1, 0x73e80ec6, matchCmakeContext222},
+    {"cmake.xml", "Comment", 3, 0x85c63c00, matchCmakeContext227},
+    {"cmake.xml", "Detect Generator Expressions", 1, 0x32437cbd, matchCmakeContext232},
+    {"cmake.xml", "Detect Variable Substitutions", 3, 0x305829a3, matchCmakeContext220},
+    {"cmake.xml", "EndCmdPop", 1, 0x73e80ec6, matchCmakeContext214},
+    {"cmake.xml", "EndCmdPop2", 1, 0x73e80ec6, matchCmakeContext215},
+    {"cmake.xml", "Generator Expression", 6, 0x1718b88d, matchCmakeContext233},
+    {"cmake.xml", "Normal Text", 110, 0x383519c9, matchCmakeContext0},
+    {"cmake.xml", "User Function", 2, 0x513eb065, matchCmakeContext216},
+    {"cmake.xml", "User Function Args", 12, 0xe4a196af, matchCmakeContext224},
+    {"cmake.xml", "VarSubst", 4, 0x5fb59050, matchCmakeContext221},
+    {"cmake.xml", "VarSubst@", 3, 0xe95853bd, matchCmakeContext223},
+    {"cmake.xml", "add_compile_definitions_ctx", 1, 0x73e80ec6, matchCmakeContext96},
+    {"cmake.xml", "add_compile_options_ctx", 1, 0x73e80ec6, matchCmakeContext98},
+    {"cmake.xml", "add_custom_command_ctx", 1, 0x73e80ec6, matchCmakeContext100},
+    {"cmake.xml", "add_custom_target_ctx", 1, 0x73e80ec6, matchCmakeContext102},
+    {"cmake.xml", "add_definitions_ctx", 1, 0x73e80ec6, matchCmakeContext104},
+    {"cmake.xml", "add_dependencies_ctx", 1, 0x73e80ec6, matchCmakeContext106},
+    {"cmake.xml", "add_executable_ctx", 1, 0x73e80ec6, matchCmakeContext108},
+    {"cmake.xml", "add_library_ctx", 1, 0x73e80ec6, matchCmakeContext110},
+    {"cmake.xml", "add_subdirectory_ctx", 1, 0x73e80ec6, matchCmakeContext112},
+    {"cmake.xml", "add_test_ctx", 1, 0x73e80ec6, matchCmakeContext114},
+    {"cmake.xml", "aux_source_directory_ctx", 1, 0x73e80ec6, matchCmakeContext116},
+    {"cmake.xml", "break_ctx", 1, 0x73e80ec6, matchCmakeContext1},
+    {"cmake.xml", "build_command_ctx", 1, 0x73e80ec6, matchCmakeContext118},
+    {"cmake.xml", "cmake_host_system_information_ctx", 1, 0x73e80ec6, matchCmakeContext3},
+    {"cmake.xml", "cmake_minimum_required_ctx", 1, 0x73e80ec6, matchCmakeContext5},
+    {"cmake.xml", "cmake_parse_arguments_ctx", 1, 0x73e80ec6, matchCmakeContext7},
+    {"cmake.xml", "cmake_policy_ctx", 1, 0x73e80ec6, matchCmakeContext9},
+    {"cmake.xml", "configure_file_ctx", 1, 0x73e80ec6, matchCmakeContext11},
+    {"cmake.xml", "continue_ctx", 1, 0x73e80ec6, matchCmakeContext13},
+    {"cmake.xml", "create_test_sourcelist_ctx", 1, 0x73e80ec6, matchCmakeContext120},
+    {"cmake.xml", "ctest_build_ctx", 1, 0x73e80ec6, matchCmakeContext184},
+    {"cmake.xml", "ctest_configure_ctx", 1, 0x73e80ec6, matchCmakeContext186},
+    {"cmake.xml", "ctest_coverage_ctx", 1, 0x73e80ec6, matchCmakeContext188},
+    {"cmake.xml", "ctest_empty_binary_directory_ctx", 1, 0x73e80ec6, matchCmakeContext190},
+    {"cmake.xml", "ctest_memcheck_ctx", 1, 0x73e80ec6, matchCmakeContext192},
+    {"cmake.xml", "ctest_read_custom_files_ctx", 1, 0x73e80ec6, matchCmakeContext194},
+    {"cmake.xml", "ctest_run_script_ctx", 1, 0x73e80ec6, matchCmakeContext196},
+    {"cmake.xml", "ctest_sleep_ctx", 1, 0x73e80ec6, matchCmakeContext198},
+    {"cmake.xml", "ctest_start_ctx", 1, 0x73e80ec6, matchCmakeContext200},
+    {"cmake.xml", "ctest_submit_ctx", 1, 0x73e80ec6, matchCmakeContext202},
+    {"cmake.xml", "ctest_test_ctx", 1, 0x73e80ec6, matchCmakeContext204},
+    {"cmake.xml", "ctest_update_ctx", 1, 0x73e80ec6, matchCmakeContext206},
+    {"cmake.xml", "ctest_upload_ctx", 1, 0x73e80ec6, matchCmakeContext208},
+    {"cmake.xml", "define_property_ctx", 1, 0x73e80ec6, matchCmakeContext122},
+    {"cmake.xml", "else_ctx", 1, 0x73e80ec6, matchCmakeContext18},
+    {"cmake.xml", "elseif_ctx", 1, 0x73e80ec6, matchCmakeContext15},
+    {"cmake.xml", "elseif_ctx_op", 4, 0x18f074d9, matchCmakeContext16},
+    {"cmake.xml", "enable_language_ctx", 1, 0x73e80ec6, matchCmakeContext124},
+    {"cmake.xml", "enable_testing_ctx", 1, 0x73e80ec6, matchCmakeContext126},
+    {"cmake.xml", "endforeach_ctx", 1, 0x73e80ec6, matchCmakeContext20},
+    {"cmake.xml", "endfunction_ctx", 1, 0x73e80ec6, matchCmakeContext22},
+    {"cmake.xml", "endif_ctx", 1, 0x73e80ec6, matchCmakeContext24},
+    {"cmake.xml", "endmacro_ctx", 1, 0x73e80ec6, matchCmakeContext26},
+    {"cmake.xml", "endwhile_ctx", 1, 0x73e80ec6, matchCmakeContext28},
+    {"cmake.xml", "execute_process_ctx", 1, 0x73e80ec6, matchCmakeContext30},
+    {"cmake.xml", "export_ctx", 1, 0x73e80ec6, matchCmakeContext128},
+    {"cmake.xml", "file_ctx", 1, 0x73e80ec6, matchCmakeContext32},
+    {"cmake.xml", "find_file_ctx", 1, 0x73e80ec6, matchCmakeContext34},
+    {"cmake.xml", "find_library_ctx", 1, 0x73e80ec6, matchCmakeContext36},
+    {"cmake.xml", "find_package_ctx", 1, 0x73e80ec6, matchCmakeContext38},
+    {"cmake.xml", "find_path_ctx", 1, 0x73e80ec6, matchCmakeContext40},
+    {"cmake.xml", "find_program_ctx", 1, 0x73e80ec6, matchCmakeContext42},
+    {"cmake.xml", "fltk_wrap_ui_ctx", 1, 0x73e80ec6, matchCmakeContext130},
+    {"cmake.xml", "foreach_ctx", 1, 0x73e80ec6, matchCmakeContext44},
+    {"cmake.xml", "function_ctx", 1, 0x73e80ec6, matchCmakeContext46},
+    {"cmake.xml", "get_cmake_property_ctx", 1, 0x73e80ec6, matchCmakeContext48},
+    {"cmake.xml", "get_directory_property_ctx", 1, 0x73e80ec6, matchCmakeContext50},
+    {"cmake.xml", "get_filename_component_ctx", 1, 0x73e80ec6, matchCmakeContext52},
+    {"cmake.xml", "get_property_ctx", 1, 0x73e80ec6, matchCmakeContext54},
+    {"cmake.xml", "get_source_file_property_ctx", 1, 0x73e80ec6, matchCmakeContext132},
+    {"cmake.xml", "get_target_property_ctx", 1, 0x73e80ec6, matchCmakeContext134},
+    {"cmake.xml", "get_test_property_ctx", 1, 0x73e80ec6, matchCmakeContext136},
+    {"cmake.xml", "if_ctx", 1, 0x73e80ec6, matchCmakeContext56},
+    {"cmake.xml", "if_ctx_op", 4, 0x18f074d9, matchCmakeContext57},
+    {"cmake.xml", "include_ctx", 1, 0x73e80ec6, matchCmakeContext59},
+    {"cmake.xml", "include_directories_ctx", 1, 0x73e80ec6, matchCmakeContext138},
+    {"cmake.xml", "include_external_msproject_ctx", 1, 0x73e80ec6, matchCmakeContext140},
+    {"cmake.xml", "include_guard_ctx", 1, 0x73e80ec6, matchCmakeContext61},
+    {"cmake.xml", "include_regular_expression_ctx", 1, 0x73e80ec6, matchCmakeContext142},
+    {"cmake.xml", "install_ctx", 1, 0x73e80ec6, matchCmakeContext144},
+    {"cmake.xml", "link_directories_ctx", 1, 0x73e80ec6, matchCmakeContext146},
+    {"cmake.xml", "link_libraries_ctx", 1, 0x73e80ec6, matchCmakeContext148},
+    {"cmake.xml", "list_ctx", 1, 0x73e80ec6, matchCmakeContext63},
+    {"cmake.xml", "load_cache_ctx", 1, 0x73e80ec6, matchCmakeContext150},
+    {"cmake.xml", "macro_ctx", 1, 0x73e80ec6, matchCmakeContext65},
+    {"cmake.xml", "mark_as_advanced_ctx", 1, 0x73e80ec6, matchCmakeContext67},
+    {"cmake.xml", "math_ctx", 1, 0x73e80ec6, matchCmakeContext69},
+    {"cmake.xml", "message_ctx", 1, 0x73e80ec6, matchCmakeContext71},
+    {"cmake.xml", "option_ctx", 1, 0x73e80ec6, matchCmakeContext73},
+    {"cmake.xml", "project_ctx", 1, 0x73e80ec6, matchCmakeContext152},
+    {"cmake.xml", "qt_wrap_cpp_ctx", 1, 0x73e80ec6, matchCmakeContext154},
+    {"cmake.xml", "qt_wrap_ui_ctx", 1, 0x73e80ec6, matchCmakeContext156},
+    {"cmake.xml", "remove_definitions_ctx", 1, 0x73e80ec6, matchCmakeContext158},
+    {"cmake.xml", "return_ctx", 1, 0x73e80ec6, matchCmakeContext75},
+    {"cmake.xml", "separate_arguments_ctx", 1, 0x73e80ec6, matchCmakeContext77},
+    {"cmake.xml", "set_ctx", 1, 0x73e80ec6, matchCmakeContext83},
+    {"cmake.xml", "set_directory_properties_ctx", 1, 0x73e80ec6, matchCmakeContext79},
+    {"cmake.xml", "set_property_ctx", 1, 0x73e80ec6, matchCmakeContext81},
+    {"cmake.xml", "set_source_files_properties_ctx", 1, 0x73e80ec6, matchCmakeContext160},
+    {"cmake.xml", "set_target_properties_ctx", 1, 0x73e80ec6, matchCmakeContext162},
+    {"cmake.xml", "set_tests_properties_ctx", 1, 0x73e80ec6, matchCmakeContext164},
+    {"cmake.xml", "site_name_ctx", 1, 0x73e80ec6, matchCmakeContext85},
+    {"cmake.xml", "source_group_ctx", 1, 0x73e80ec6, matchCmakeContext166},
+    {"cmake.xml", "string_ctx", 1, 0x73e80ec6, matchCmakeContext87},
+    {"cmake.xml", "target_compile_definitions_ctx", 1, 0x73e80ec6, matchCmakeContext168},
+    {"cmake.xml", "target_compile_features_ctx", 1, 0x73e80ec6, matchCmakeContext170},
+    {"cmake.xml", "target_compile_options_ctx", 1, 0x73e80ec6, matchCmakeContext172},
+    {"cmake.xml", "target_include_directories_ctx", 1, 0x73e80ec6, matchCmakeContext174},
+    {"cmake.xml", "target_link_libraries_ctx", 1, 0x73e80ec6, matchCmakeContext176},
+    {"cmake.xml", "target_sources_ctx", 1, 0x73e80ec6, matchCmakeContext178},
+    {"cmake.xml", "try_compile_ctx", 1, 0x73e80ec6, matchCmakeContext180},
+    {"cmake.xml", "try_run_ctx", 1, 0x73e80ec6, matchCmakeContext182},
+    {"cmake.xml", "unset_ctx", 1, 0x73e80ec6, matchCmakeContext89},
+    {"cmake.xml", "variable_watch_ctx", 1, 0x73e80ec6, matchCmakeContext91},
+    {"cmake.xml", "while_ctx", 1, 0x73e80ec6, matchCmakeContext93},
+    {"cmake.xml", "while_ctx_op", 4, 0x18f074d9, matchCmakeContext94},
+    {"cpp.xml", "DetectNSEnd", 2, 0x4cfdcd5b, matchCppContext3},
+    {"isocpp.xml", "AfterHashLineError", 10, 0xec63a147, matchIsocppContext46},
+    {"isocpp.xml", "Attribute", 10, 0x89ad28ab, matchIsocppContext30},
+    {"isocpp.xml", "AttributeNamespace", 3, 0x038a2064, matchIsocppContext32},
+    {"isocpp.xml", "Char Literal Close", 1, 0x73e80ec6, matchIsocppContext21},
+    {"isocpp.xml", "Char16 Literal", 3, 0xd698c2a8, matchIsocppContext19},
+    {"isocpp.xml", "Char32 Literal", 3, 0xd698c2a8, matchIsocppContext20},
+    {"isocpp.xml", "Char8 Literal", 3, 0xd698c2a8, matchIsocppContext18},
+    {"isocpp.xml", "CheckUDLOperator", 2, 0xb8f8462b, matchIsocppContext15},
+    {"isocpp.xml", "Comment 1", 5, 0x0f0e0b60, matchIsocppContext43},
+    {"isocpp.xml", "Comment 2", 6, 0xa90afdfa, matchIsocppContext44},
+    {"isocpp.xml", "Define", 7, 0xd78b78c4, matchIsocppContext54},
+    {"isocpp.xml", "DetectNSEnd", 4, 0x27fdad80, matchIsocppContext36},
+    {"isocpp.xml", "FloatSuffix", 3, 0x04e106cf, matchIsocppContext12},
+    {"isocpp.xml", "In Define", 22, 0x5f31d4f8, matchIsocppContext55},
+    {"isocpp.xml", "InPreprocessor", 2, 0x996853a5, matchIsocppContext56},
+    {"isocpp.xml", "Include", 4, 0xe479ff89, matchIsocppContext49},
+    {"isocpp.xml", "Inscoped", 3, 0xac4ad84b, matchIsocppContext61},
+    {"isocpp.xml", "Inscoped AfterHash", 3, 0x7b1af20d, matchIsocppContext62},
+    {"isocpp.xml", "IntSuffix", 2, 0xfc5123e0, matchIsocppContext10},
+    {"isocpp.xml", "IntSuffixPattern", 3, 0xde202286, matchIsocppContext11},
+    {"isocpp.xml", "LineError", 1, 0xb621cc7e, matchIsocppContext47},
+    {"isocpp.xml", "Main", 21, 0xfdffefda, matchIsocppContext0},
+    {"isocpp.xml", "MatchComment", 3, 0x79160a26, matchIsocppContext2},
+    {"isocpp.xml", "MatchCommentAndRegionMarkers", 3, 0x0079939e, matchIsocppContext4},
+    {"isocpp.xml", "Outscoped", 3, 0xac4ad84b, matchIsocppContext58},
+    {"isocpp.xml", "Outscoped Common", 8, 0xdd8f53ba, matchIsocppContext57},
+    {"isocpp.xml", "Outscoped intern", 9, 0x639c7803, matchIsocppContext63},
+    {"isocpp.xml", "Preprocessor", 4, 0x7514a4ff, matchIsocppContext53},
+    {"isocpp.xml", "PreprocessorEndOfLineSpace", 2, 0xc0f448f0, matchIsocppContext52},
+    {"isocpp.xml", "UDLOperatorName", 2, 0x56ef9610, matchIsocppContext16},
+    {"isocpp.xml", "match comments", 2, 0xc9bda98b, matchIsocppContext1},
+    {"isocpp.xml", "match comments and region markers", 2, 0xc9bda98b, matchIsocppContext3},
+    {"isocpp.xml", "match identifier", 10, 0x44597bc8, matchIsocppContext7},
+    {"isocpp.xml", "match string", 15, 0xeac71395, matchIsocppContext6},
+    {"isocpp.xml", "string normal char", 2, 0x1c4bdb85, matchIsocppContext28},
+    {"isocpp.xml", "string special char", 3, 0xc43ccf3e, matchIsocppContext27},
+    {"json.xml", "Array", 9, 0xae2d9d49, matchJsonContext5},
+    {"json.xml", "Normal", 3, 0x2e33116f, matchJsonContext0},
+    {"json.xml", "Pair", 5, 0x97495311, matchJsonContext1},
+    {"json.xml", "String_Key", 2, 0x214961bf, matchJsonContext2},
+    {"json.xml", "String_Value", 2, 0x214961bf, matchJsonContext4},
+    {"json.xml", "Value", 9, 0xae2d9d49, matchJsonContext3},
+    {"markdown.xml", "Normal Text", 16, 0x52765b05, matchMarkdownContext0},
+    {"markdown.xml", "inc", 15, 0x48c69835, matchMarkdownContext8},
+    {"python.xml", "#CheckForString", 2, 0xce5eabd4, matchPythonContext1},
+    {"python.xml", "CheckForStringNext", 3, 0x5ebc99a7, matchPythonContext2},
+    {"python.xml", "CommentVariants", 9, 0x487c9c1d, matchPythonContext4},
+    {"python.xml", "Dictionary", 4, 0x0b5042c6, matchPythonContext5},
+    {"python.xml", "List", 4, 0x0b5042c6, matchPythonContext6},
+    {"python.xml", "Normal", 26, 0x0b881ef8, matchPythonContext0},
+    {"python.xml", "Raw A-F-String", 3, 0x0a8a10dd, matchPythonContext28},
+    {"python.xml", "Raw A-string", 3, 0x0a8a10dd, matchPythonContext26},
+    {"python.xml", "Raw Q-F-String", 3, 0x0a8a10dd, matchPythonContext32},
+    {"python.xml", "Raw Q-string", 3, 0x0a8a10dd, matchPythonContext30},
+    {"python.xml", "Raw Triple A-F-String", 3, 0x53be6b4c, matchPythonContext20},
+    {"python.xml", "Raw Triple A-string", 3, 0x53be6b4c, matchPythonContext18},
+    {"python.xml", "Raw Triple Q-F-String", 3, 0x53be6b4c, matchPythonContext24},
+    {"python.xml", "Raw Triple Q-string", 3, 0x53be6b4c, matchPythonContext22},
+    {"python.xml", "Single A-F-String", 3, 0x9709d8ec, matchPythonContext27},
+    {"python.xml", "Single A-comment", 3, 0x40775128, matchPythonContext11},
+    {"python.xml", "Single A-string", 3, 0x9709d8ec, matchPythonContext25},
+    {"python.xml", "Single Q-F-String", 3, 0x9709d8ec, matchPythonContext31},
+    {"python.xml", "Single Q-comment", 3, 0x40775128, matchPythonContext12},
+    {"python.xml", "Single Q-string", 3, 0x9709d8ec, matchPythonContext29},
+    {"python.xml", "String Interpolation", 3, 0x4f347486, matchPythonContext16},
+    {"python.xml", "StringVariants", 17, 0xc3b0f6bd, matchPythonContext3},
+    {"python.xml", "Triple A-F-String", 3, 0xf6140905, matchPythonContext19},
+    {"python.xml", "Triple A-comment", 3, 0x99c49237, matchPythonContext9},
+    {"python.xml", "Triple A-string", 3, 0xf6140905, matchPythonContext17},
+    {"python.xml", "Triple Q-F-String", 3, 0xf6140905, matchPythonContext23},
+    {"python.xml", "Triple Q-comment", 3, 0x99c49237, matchPythonContext10},
+    {"python.xml", "Triple Q-string", 3, 0xf6140905, matchPythonContext21},
+    {"python.xml", "Tuple", 4, 0x0b5042c6, matchPythonContext7},
+    {"python.xml", "stringformat", 4, 0xbdd135cb, matchPythonContext13},
+    {"python.xml", "stringinterpolation", 2, 0xf9b4a27c, matchPythonContext15},
+    {"yaml.xml", "attribute", 1, 0x73e80ec6, matchYamlContext5},
+    {"yaml.xml", "attribute-end-inline", 3, 0xd698c2a8, matchYamlContext16},
+    {"yaml.xml", "attribute-inline", 3, 0x0cc9156c, matchYamlContext6},
+    {"yaml.xml", "attribute-pre", 11, 0x7bb9b185, matchYamlContext7},
+    {"yaml.xml", "attribute-pre-inline", 13, 0x22b81198, matchYamlContext8},
+    {"yaml.xml", "attribute-string", 2, 0x98fbc500, matchYamlContext11},
+    {"yaml.xml", "attribute-string-inline", 2, 0x98fbc500, matchYamlContext13},
+    {"yaml.xml", "attribute-stringx", 2, 0x98fbc500, matchYamlContext12},
+    {"yaml.xml", "attribute-stringx-inline", 2, 0x98fbc500, matchYamlContext14},
+    {"yaml.xml", "dash", 7, 0x10dda6e1, matchYamlContext1},
+    {"yaml.xml", "hash", 6, 0x742ca8a0, matchYamlContext10},
+    {"yaml.xml", "header", 1, 0x73e80ec6, matchYamlContext2},
+    {"yaml.xml", "list", 15, 0x50b654e8, matchYamlContext9},
+    {"yaml.xml", "normal", 16, 0x87764bbc, matchYamlContext0},
+    {"yaml.xml", "string", 2, 0x98fbc500, matchYamlContext17},
+    {"yaml.xml", "stringx", 2, 0x98fbc500, matchYamlContext18},
+};
+
+} // namespace
+
+const LanguageDbTable<CompiledContext> compiledContexts = {
+    compiledContextEntries, std::size(compiledContextEntries)};
+
+} // namespace Qutepart
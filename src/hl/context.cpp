@@ -4,13 +4,18 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <algorithm>
+
 #include <QDebug>
 #include <QScopedPointer>
 
+#include "compiled_contexts.h"
 #include "context.h"
+#include "external_context.h"
+#include "highlighted_line.h"
 #include "match_result.h"
+#include "memory_usage.h"
 #include "rules.h"
-#include "text_block_user_data.h"
 #include "text_to_match.h"
 #include "theme.h"
 
@@ -19,10 +24,12 @@ namespace Qutepart {
 Context::Context(const QString &name, const QString &attribute,
                  const ContextSwitcher &lineEndContext, const ContextSwitcher &lineBeginContext,
                  const ContextSwitcher &lineEmptyContext, const ContextSwitcher &fallthroughContext,
-                 bool dynamic, const QList<RulePtr> &rules)
+                 bool dynamic, const QList<RulePtr> &rules, const RuleArenaPtr &arena)
     : _name(name), attribute(attribute), _lineEndContext(lineEndContext),
       _lineBeginContext(lineBeginContext), _lineEmptyContext(lineEmptyContext),
-      fallthroughContext(fallthroughContext), _dynamic(dynamic), rules(rules) {}
+      fallthroughContext(fallthroughContext), _dynamic(dynamic), rules(rules), arena(arena) {}
+
+Context::~Context() { delete ruleDispatch_.loadRelaxed(); }
 
 void Context::printDescription(QTextStream &out) const {
     out << "\tContext " << this->_name << "\n";
@@ -50,27 +57,6 @@ void Context::printDescription(QTextStream &out) const {
 
 QString Context::name() const { return _name; }
 
-void Context::setTheme(const Theme *theme) {
-    style.setTheme(theme);
-
-    if (_lineEndContext.context()) {
-        _lineEndContext.context()->setTheme(theme);
-    }
-    if (_lineBeginContext.context()) {
-        _lineBeginContext.context()->setTheme(theme);
-    }
-    if (_lineEmptyContext.context()) {
-        _lineEmptyContext.context()->setTheme(theme);
-    }
-    if (fallthroughContext.context()) {
-        fallthroughContext.context()->setTheme(theme);
-    }
-
-    for (auto &rule : rules) {
-        rule->setTheme(theme);
-    }
-}
-
 void Context::setLanguage(QSharedPointer<Language> newLanguage) {
     this->language = newLanguage;
     for (auto &rule : rules) {
@@ -78,29 +64,30 @@ void Context::setLanguage(QSharedPointer<Language> newLanguage) {
     }
 }
 
-void Context::resolveContextReferences(const QHash<QString, ContextPtr> &contexts, QString &error) {
-    _lineEndContext.resolveContextReferences(contexts, error);
+void Context::resolveContextReferences(const QHash<QString, ContextPtr> &contexts,
+                                       ExternalContexts &externalContexts, QString &error) {
+    _lineEndContext.resolveContextReferences(contexts, externalContexts, error);
     if (!error.isNull()) {
         return;
     }
 
-    _lineBeginContext.resolveContextReferences(contexts, error);
+    _lineBeginContext.resolveContextReferences(contexts, externalContexts, error);
     if (!error.isNull()) {
         return;
     }
 
-    _lineEmptyContext.resolveContextReferences(contexts, error);
+    _lineEmptyContext.resolveContextReferences(contexts, externalContexts, error);
     if (!error.isNull()) {
         return;
     }
 
-    fallthroughContext.resolveContextReferences(contexts, error);
+    fallthroughContext.resolveContextReferences(contexts, externalContexts, error);
     if (!error.isNull()) {
         return;
     }
 
     for (auto &rule : rules) {
-        rule->resolveContextReferences(contexts, error);
+        rule->resolveContextReferences(contexts, externalContexts, error);
         if (!error.isNull()) {
             return;
         }
@@ -135,68 +122,40 @@ void Context::setStyles(const QHash<QString, Style> &styles, QString &error) {
     }
 }
 
-void appendFormat(QVector<QTextLayout::FormatRange> &formats, int start, int length,
-                  const QTextCharFormat &format) {
-
-    if ((!formats.isEmpty()) && (formats.last().start + formats.last().length) == start &&
-        formats.last().format == format) {
-        formats.last().length += length;
-    } else {
-        QTextLayout::FormatRange fmtRange;
-        fmtRange.start = start;
-        fmtRange.length = length;
-        fmtRange.format = format;
-        formats.append(fmtRange);
-    }
-}
-
-void fillTextTypeMap(QString &textTypeMap, int start, int length, QChar textType) {
-    for (auto i = start; i < start + length; i++) {
-        textTypeMap[i] = textType;
-    }
-}
-
-void fillLanguageMap(QVector<Language *> &languageMap, int start, int length, Language *language) {
-    for (auto i = start; i < start + length; i++) {
-        languageMap[i] = language;
-    }
-}
-
 // Helper function for parseBlock()
 void Context::applyMatchResult(const TextToMatch &textToMatch, const MatchResult &matchRes,
-                               const Context *context, QVector<QTextLayout::FormatRange> &formats,
-                               QString &textTypeMap, QVector<Language *> &languageMap) const {
-    auto displayFormat = matchRes.style.format();
+                               const Context *context, HighlightedLine &result) const {
+    const auto &ruleStyle = matchRes.rule->style;
+    auto styleId = ruleStyle.id();
 
-    if (displayFormat.isNull()) {
-        displayFormat = context->style.format();
+    if (styleId == -1) {
+        styleId = context->style.id();
     }
 
-    if (!displayFormat.isNull()) {
-        appendFormat(formats, textToMatch.currentColumnIndex, matchRes.length, *displayFormat);
+    if (styleId != -1) {
+        result.appendFormat(textToMatch.currentColumnIndex, matchRes.length, styleId);
     }
 
-    QChar textType = matchRes.style.textType();
+    QChar textType = ruleStyle.textType();
     if (textType == 0) {
         textType = context->style.textType();
     }
-    fillTextTypeMap(textTypeMap, textToMatch.currentColumnIndex, matchRes.length, textType);
+    result.appendTextType(textToMatch.currentColumnIndex, matchRes.length, textType);
 
-    auto lang = matchRes.rule->language;
-    if (lang.isNull()) {
-        lang = context->language;
+    auto lang = matchRes.rule->language.data();
+    if (lang == nullptr) {
+        lang = context->language.data();
     }
-    fillLanguageMap(languageMap, textToMatch.currentColumnIndex, matchRes.length, lang.data());
+    result.appendLanguage(textToMatch.currentColumnIndex, matchRes.length, lang);
 }
 
 // Parse block. Exits, when reached end of the text, or when context is switched
 const ContextStack Context::parseBlock(const ContextStack &contextStack, TextToMatch &textToMatch,
-                                       QVector<QTextLayout::FormatRange> &formats,
-                                       QString &textTypeMap, QVector<Language *> &languageMap,
-                                       bool &lineContinue, TextBlockUserData *data) const {
+                                       HighlightedLine &result) const {
     textToMatch.contextData = &contextStack.currentData();
 
     if (textToMatch.isEmpty() && (!_lineEmptyContext.isNull())) {
+        recordContextSwitch();
         return contextStack.switchContext(_lineEmptyContext);
     }
 
@@ -205,54 +164,89 @@ const ContextStack Context::parseBlock(const ContextStack &contextStack, TextToM
         bool matched = tryMatch(textToMatch, matchRes);
 
         if (matched) {
-            lineContinue = matchRes.lineContinue;
+            result.lineContinue = matchRes.lineContinue;
 
-            if (data && !matchRes.rule->beginRegion.isEmpty()) {
-                data->regions.push(matchRes.rule->beginRegion);
+            if (!matchRes.rule->beginRegion.isEmpty()) {
+                result.beginRegion(matchRes.rule->beginRegion);
             }
 
-            if (data && !matchRes.rule->endRegion.isEmpty()) {
-                if (!data->regions.isEmpty() && data->regions.top() == matchRes.rule->endRegion) {
-                    data->regions.pop();
-                }
+            if (!matchRes.rule->endRegion.isEmpty()) {
+                result.endRegion(matchRes.rule->endRegion);
             }
 
-            if (data) {
-                data->folding.level = data->regions.size();
-            }
-
-            if (matchRes.nextContext.isNull()) {
-                applyMatchResult(textToMatch, matchRes, this, formats, textTypeMap, languageMap);
+            const auto &nextContext = matchRes.rule->contextSwitcher;
+            if (nextContext.isNull()) {
+                applyMatchResult(textToMatch, matchRes, this, result);
                 textToMatch.shift(matchRes.length);
             } else {
+                recordContextSwitch();
                 ContextStack newContextStack =
-                    contextStack.switchContext(matchRes.nextContext, matchRes.data);
+                    contextStack.switchContext(nextContext, matchRes.data);
 
-                applyMatchResult(textToMatch, matchRes, newContextStack.currentContext(), formats,
-                                 textTypeMap, languageMap);
+                applyMatchResult(textToMatch, matchRes, newContextStack.currentContext(), result);
                 textToMatch.shift(matchRes.length);
                 return newContextStack;
             }
         } else {
-            lineContinue = false;
-            if (!style.format().isNull()) {
-                appendFormat(formats, textToMatch.currentColumnIndex, 1, *style.format());
+            result.lineContinue = false;
+
+            /* Skip the following characters no rule can start at, i.e. the text of comments and
+             * strings. They get the context format as one run
+             */
+            int length = 1;
+            if (this->fallthroughContext.isNull()) {
+                length += ruleDispatch().countUnmatchable(textToMatch.text.mid(1));
+            }
+
+            if (style.id() != -1) {
+                result.appendFormat(textToMatch.currentColumnIndex, length, style.id());
             }
-            textTypeMap[textToMatch.currentColumnIndex] = style.textType();
-            languageMap[textToMatch.currentColumnIndex] = this->language.data();
+            result.appendTextType(textToMatch.currentColumnIndex, length, style.textType());
+            result.appendLanguage(textToMatch.currentColumnIndex, length, this->language.data());
             if (!this->fallthroughContext.isNull()) {
+                recordContextSwitch();
                 return contextStack.switchContext(this->fallthroughContext);
             }
-            textToMatch.shiftOnce();
+            textToMatch.shift(length);
         }
     }
 
     return contextStack;
 }
 
-bool Context::tryMatch(const TextToMatch &textToMatch, MatchResult &result) const {
-    for (auto &rule : rules) {
-        if (rule->tryMatch(textToMatch, result)) {
+bool Context::tryMatchProfiled(const TextToMatch &textToMatch, MatchResult &result) const {
+    ProfileTimer timer;
+    bool matched = tryMatchUnprofiled(textToMatch, result);
+    profileCounters.recordAttempt(matched, timer.nsecsElapsed());
+    return matched;
+}
+
+bool Context::tryMatchUnprofiled(const TextToMatch &textToMatch, MatchResult &result) const {
+    if (textToMatch.isEmpty()) {
+        for (auto &rule : rules) {
+            if (rule->tryMatch(textToMatch, result)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if (Q_UNLIKELY(isProfilingEnabled())) {
+        // The rules count their attempts
+        for (const auto &record : ruleDispatch().rulesFor(textToMatch.text.at(0))) {
+            if (record.rule->tryMatch(textToMatch, result)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if (compiledMatcher != nullptr && areCompiledMatchersEnabled()) {
+        return compiledMatcher(*this, textToMatch, result);
+    }
+
+    for (const auto &record : ruleDispatch().rulesFor(textToMatch.text.at(0))) {
+        if (tryMatchRecord(record, textToMatch, result)) {
             return true;
         }
     }
@@ -260,4 +254,228 @@ bool Context::tryMatch(const TextToMatch &textToMatch, MatchResult &result) cons
     return false;
 }
 
+// Same as AbstractRule::tryMatch(), without calling the simple rules
+bool Context::tryMatchRecord(const RuleRecord &record, const TextToMatch &textToMatch,
+                             MatchResult &result) {
+    if (record.column != -1 && record.column != textToMatch.currentColumnIndex) {
+        return false;
+    }
+
+    if (record.firstNonSpace && (not textToMatch.firstNonSpace)) {
+        return false;
+    }
+
+    const auto &text = textToMatch.text;
+    switch (record.kind) {
+    case RuleRecord::DetectChar:
+        return text.at(0) == record.char0 && record.rule->makeMatchResult(result, 1);
+    case RuleRecord::Detect2Chars:
+        return text.size() >= 2 && text.at(0) == record.char0 && text.at(1) == record.char1 &&
+               record.rule->makeMatchResult(result, 2);
+    case RuleRecord::LineContinue:
+        return text.size() == 1 && text.at(0) == '\\' &&
+               record.rule->makeMatchResult(result, 1, true);
+    case RuleRecord::DetectSpaces: {
+        int length = textToMatch.countSpaces();
+        return length > 0 && record.rule->makeMatchResult(result, length);
+    }
+    case RuleRecord::DetectIdentifier:
+        return textToMatch.isLetter() &&
+               record.rule->makeMatchResult(result, textToMatch.countWordChars());
+    case RuleRecord::Generic:
+        break;
+    }
+
+    return record.rule->tryMatchImpl(textToMatch, result);
+}
+
+bool Context::setCompiledMatcher(CompiledMatcher matcher, int ruleCount, quint32 namesHash) {
+    if (rules.size() != ruleCount || ruleNamesHash() != namesHash) {
+        return false;
+    }
+    compiledMatcher = matcher;
+    return true;
+}
+
+bool Context::matchedFromCompiled(int index, int length, bool lineContinue,
+                                  MatchResult &result) const {
+    return rules[index]->makeMatchResult(result, length, lineContinue);
+}
+
+bool Context::tryRulesFromCompiled(int first, int last, const TextToMatch &textToMatch,
+                                   MatchResult &result) const {
+    const auto &dispatch = ruleDispatch();
+    auto ch = textToMatch.text.at(0);
+    for (int i = first; i < last; i++) {
+        if (dispatch.ruleChars[i].contains(ch) &&
+            tryMatchRecord(dispatch.records[i], textToMatch, result)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+quint32 Context::ruleNamesHash() const {
+    QByteArray names;
+    for (const auto &rule : rules) {
+        if (!names.isEmpty()) {
+            names += ' ';
+        }
+        names += rule->name().toUtf8();
+    }
+
+    quint32 result = 0x811c9dc5;
+    for (char byte : std::as_const(names)) {
+        result = (result ^ static_cast<quint8>(byte)) * 0x01000193;
+    }
+    return result;
+}
+
+void Context::collectStartChars(StartCharSet &chars, QSet<const Context *> &visiting) const {
+    if (visiting.contains(this)) {
+        // IncludeRules loop. Don't try to be smart
+        chars.addAll();
+        return;
+    }
+
+    visiting.insert(this);
+    for (auto &rule : rules) {
+        rule->collectStartChars(chars, visiting);
+        if (chars.isAny()) {
+            break;
+        }
+    }
+    visiting.remove(this);
+}
+
+size_t Context::memoryUsage() const {
+    size_t result = sizeof(Context) + stringMemoryUsage(_name) +
+                    stringMemoryUsage(attribute) + listMemoryUsage(rules);
+    for (const auto &rule : rules) {
+        result += rule->memoryUsage();
+    }
+
+    auto dispatch = ruleDispatch_.loadAcquire();
+    if (dispatch != nullptr) {
+        result += sizeof(RuleDispatch) + listMemoryUsage(dispatch->buckets) +
+                  listMemoryUsage(dispatch->records) + listMemoryUsage(dispatch->ruleChars);
+        for (const auto &bucket : dispatch->buckets) {
+            result += listMemoryUsage(bucket);
+        }
+    }
+    return result;
+}
+
+void Context::appendProfile(QList<ProfileEntry> &entries) const {
+    entries.append({_name, -1, QString(), profileCounters.snapshot()});
+    for (int i = 0; i < rules.size(); i++) {
+        entries.append({_name, i, rules[i]->description(), rules[i]->profile()});
+    }
+}
+
+void Context::resetProfile() {
+    profileCounters.reset();
+    for (auto &rule : rules) {
+        rule->resetProfile();
+    }
+}
+
+int Context::RuleDispatch::countUnmatchable(QStringView text) const {
+    if (emptyBucket < 0) {
+        return 0;
+    }
+
+    // A tight loop over the UTF-16 code units, one table lookup per character
+    auto begin = text.utf16();
+    auto end = begin + text.size();
+    auto it = std::find_if(begin, end, [this](char16_t code) {
+        return bucketIndex[slot(QChar(code))] != emptyBucket;
+    });
+    return static_cast<int>(it - begin);
+}
+
+bool Context::RuleDispatch::isOutdated() const {
+    return std::any_of(unresolved.cbegin(), unresolved.cend(),
+                       [](const ExternalContext *context) { return context->isResolved(); });
+}
+
+const Context::RuleDispatch &Context::ruleDispatch() const {
+    auto dispatch = ruleDispatch_.loadAcquire();
+    if (dispatch != nullptr) {
+        if (dispatch->unresolved.isEmpty()) {
+            return *dispatch;
+        }
+        // The handles are checked only after some external context was resolved
+        auto generation = getExternalContextsGeneration();
+        if (dispatch->generation.load(std::memory_order_relaxed) == generation) {
+            return *dispatch;
+        }
+        if (!dispatch->isOutdated()) {
+            dispatch->generation.store(generation, std::memory_order_relaxed);
+            return *dispatch;
+        }
+    }
+
+    // Several threads may race here. The result is the same, only one table is kept
+    auto built = buildRuleDispatch();
+    if (!ruleDispatch_.testAndSetOrdered(dispatch, built)) {
+        delete built;
+        return *ruleDispatch_.loadAcquire();
+    }
+    built->previous.reset(dispatch);
+    return *built;
+}
+
+Context::RuleDispatch *Context::buildRuleDispatch() const {
+    // Before collecting, so a context resolved meanwhile makes the table outdated
+    auto generation = getExternalContextsGeneration();
+    QVector<StartCharSet> ruleChars;
+    ruleChars.reserve(rules.size());
+    for (auto &rule : rules) {
+        StartCharSet chars;
+        QSet<const Context *> visiting{this};
+        rule->collectStartChars(chars, visiting);
+        ruleChars.append(chars);
+    }
+
+    QVector<RuleRecord> records(rules.size());
+    for (int i = 0; i < rules.size(); i++) {
+        rules[i]->fillRecord(records[i]);
+    }
+
+    auto dispatch = new RuleDispatch();
+    dispatch->generation.store(generation, std::memory_order_relaxed);
+    for (const auto &chars : std::as_const(ruleChars)) {
+        dispatch->unresolved += chars.unresolved;
+    }
+    if (compiledMatcher != nullptr) {
+        dispatch->records = records;
+        dispatch->ruleChars = ruleChars;
+    }
+
+    for (int slot = 0; slot <= RuleDispatch::NON_ASCII_SLOT; slot++) {
+        QVector<RuleRecord> candidates;
+        for (int i = 0; i < rules.size(); i++) {
+            bool canStart = slot == RuleDispatch::NON_ASCII_SLOT
+                                ? ruleChars[i].containsNonAscii()
+                                : ruleChars[i].containsAscii(slot);
+            if (canStart) {
+                candidates.append(records[i]);
+            }
+        }
+
+        auto existing = dispatch->buckets.indexOf(candidates);
+        if (existing < 0) {
+            existing = dispatch->buckets.size();
+            dispatch->buckets.append(candidates);
+        }
+        dispatch->bucketIndex[slot] = static_cast<quint8>(existing);
+        if (candidates.isEmpty()) {
+            dispatch->emptyBucket = existing;
+        }
+    }
+
+    return dispatch;
+}
+
 } // namespace Qutepart
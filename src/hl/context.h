@@ -6,13 +6,22 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include <QAtomicPointer>
 #include <QHash>
+#include <QSet>
 #include <QSharedPointer>
 #include <QTextLayout>
 #include <QTextStream>
 
 #include "context_stack.h"
 #include "context_switcher.h"
+#include "profiler.h"
+#include "rule_arena.h"
+#include "start_char_set.h"
 #include "style.h"
 
 namespace Qutepart {
@@ -21,27 +30,57 @@ class Context;
 typedef QSharedPointer<Context> ContextPtr;
 
 class AbstractRule;
-typedef QSharedPointer<AbstractRule> RulePtr;
+// Rules are owned by the RuleArena of the language
+typedef AbstractRule *RulePtr;
 
 class Language;
 class TextToMatch;
-class MatchResult;
-class Theme;
-class TextBlockUserData;
+struct MatchResult;
+class HighlightedLine;
+
+// See compiled_contexts.h
+typedef bool (*CompiledMatcher)(const Context &context, const TextToMatch &textToMatch,
+                                MatchResult &result);
+
+/* A rule as a context tries it. The common parameters are kept inline, so rules which can't
+ * match at the column are skipped without touching the rule. Simple rules are matched by a switch
+ * on the kind, all others by the rule. See AbstractRule::fillRecord()
+ */
+struct RuleRecord {
+    enum Kind : quint8 {
+        Generic,
+        DetectChar,
+        Detect2Chars,
+        LineContinue,
+        DetectSpaces,
+        DetectIdentifier,
+    };
+
+    Kind kind = Generic;
+    bool firstNonSpace = false;
+    int column = -1; // -1 if not set
+    QChar char0;
+    QChar char1;
+    const AbstractRule *rule = nullptr;
+
+    inline bool operator==(const RuleRecord &other) const { return rule == other.rule; }
+};
 
 class Context {
   public:
     Context(const QString &name, const QString &attribute, const ContextSwitcher &lineEndContext,
             const ContextSwitcher &lineBeginContext, const ContextSwitcher &lineEmptyContext,
-            const ContextSwitcher &fallthroughContext, bool dynamic, const QList<RulePtr> &rules);
+            const ContextSwitcher &fallthroughContext, bool dynamic, const QList<RulePtr> &rules,
+            const RuleArenaPtr &arena);
+    ~Context();
 
     void printDescription(QTextStream &out) const;
 
     QString name() const;
 
-    void setTheme(const Theme *theme);
     void setLanguage(QSharedPointer<Language> newLanguage);
-    void resolveContextReferences(const QHash<QString, ContextPtr> &contexts, QString &error);
+    void resolveContextReferences(const QHash<QString, ContextPtr> &contexts,
+                                  ExternalContexts &externalContexts, QString &error);
     void setKeywordParams(const QHash<QString, QStringList> &lists, const QString &deliminators,
                           bool caseSensitive, QString &error);
     void setStyles(const QHash<QString, Style> &styles, QString &error);
@@ -51,20 +90,50 @@ class Context {
     inline ContextSwitcher lineEndContext() const { return _lineEndContext; }
 
     const ContextStack parseBlock(const ContextStack &contextStack, TextToMatch &textToMatch,
-                                  QVector<QTextLayout::FormatRange> &formats, QString &textTypeMap,
-                                  QVector<Language *> &languageMap, bool &lineContinue,
-                                  TextBlockUserData *data) const;
+                                  HighlightedLine &result) const;
 
     // Try to match textToMatch with nested rules
     // Returns true and fills result on a match; result is untouched otherwise.
-    bool tryMatch(const TextToMatch &textToMatch, MatchResult &result) const;
+    inline bool tryMatch(const TextToMatch &textToMatch, MatchResult &result) const {
+        if (Q_UNLIKELY(isProfilingEnabled())) {
+            return tryMatchProfiled(textToMatch, result);
+        }
+        return tryMatchUnprofiled(textToMatch, result);
+    }
+
+    /* Match with a generated matcher, see compiled_contexts.h. Returns false if the rules are not
+     * the ones the matcher was generated for
+     */
+    bool setCompiledMatcher(CompiledMatcher matcher, int ruleCount, quint32 namesHash);
+    // Used by the compiled matchers. The rule at the index matched `length` characters
+    bool matchedFromCompiled(int index, int length, bool lineContinue, MatchResult &result) const;
+    // Used by the compiled matchers. Try the rules [first, last) as the interpreter does
+    bool tryRulesFromCompiled(int first, int last, const TextToMatch &textToMatch,
+                              MatchResult &result) const;
+
+    // Add characters any of the rules can start matching at. Used by IncludeRules
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &visiting) const;
+
+    // Estimated memory held by the context and its rules, in bytes. Included contexts not counted
+    size_t memoryUsage() const;
+
+    // Profile of the context and of its rules, see profiler.h
+    void appendProfile(QList<ProfileEntry> &entries) const;
+    void resetProfile();
+    // Count a switch from this context done outside parseBlock()
+    inline void recordContextSwitch() const { profileCounters.recordContextSwitch(); }
 
     QSharedPointer<Language> language;
 
   protected:
     void applyMatchResult(const TextToMatch &textToMatch, const MatchResult &matchRes,
-                          const Context *context, QVector<QTextLayout::FormatRange> &formats,
-                          QString &textTypeMap, QVector<Language *> &languageMap) const;
+                          const Context *context, HighlightedLine &result) const;
+    bool tryMatchUnprofiled(const TextToMatch &textToMatch, MatchResult &result) const;
+    bool tryMatchProfiled(const TextToMatch &textToMatch, MatchResult &result) const;
+    static bool tryMatchRecord(const RuleRecord &record, const TextToMatch &textToMatch,
+                               MatchResult &result);
+    // FNV-1a of the rule names separated by spaces, as regenerate-compiled-contexts.py computes it
+    quint32 ruleNamesHash() const;
 
     QString _name;
     QString attribute;
@@ -74,7 +143,59 @@ class Context {
     ContextSwitcher fallthroughContext;
     bool _dynamic;
     QList<RulePtr> rules;
+    RuleArenaPtr arena; // owns the rules
+    CompiledMatcher compiledMatcher = nullptr;
     Style style;
+    mutable ProfileCounters profileCounters;
+
+  private:
+    /* Rules which can start matching at a character, in the original order.
+     * ASCII characters are looked up directly, all other characters share the last slot.
+     * Characters with the same candidate rules share one bucket. A bucket is a contiguous array
+     * of rule records.
+     */
+    struct RuleDispatch {
+        static constexpr int NON_ASCII_SLOT = 128;
+
+        std::array<quint8, NON_ASCII_SLOT + 1> bucketIndex;
+        QVector<QVector<RuleRecord>> buckets;
+        int emptyBucket = -1; // characters no rule can start at, -1 if none
+
+        // Of every rule, for the compiled matchers
+        QVector<RuleRecord> records;
+        QVector<StartCharSet> ruleChars;
+
+        inline const QVector<RuleRecord> &rulesFor(QChar ch) const {
+            return buckets[bucketIndex[slot(ch)]];
+        }
+
+        static inline int slot(QChar ch) {
+            auto code = ch.unicode();
+            return code < NON_ASCII_SLOT ? code : NON_ASCII_SLOT;
+        }
+
+        // Count of characters at the start of the text no rule can start matching at
+        int countUnmatchable(QStringView text) const;
+
+        // Included contexts of other languages, which were not loaded when the table was built
+        QVector<const ExternalContext *> unresolved;
+        // Some of them are loaded now, the table must be built again
+        bool isOutdated() const;
+        // getExternalContextsGeneration() when `unresolved` was last checked
+        mutable std::atomic<quint32> generation{0};
+
+        // The table this one replaced. Other threads might still use it
+        std::unique_ptr<RuleDispatch> previous;
+    };
+
+    /* Built on first use, when all the local context references are resolved. Contexts of other
+     * languages not loaded yet are candidates for any character, the table is built again when
+     * they are loaded
+     */
+    const RuleDispatch &ruleDispatch() const;
+    RuleDispatch *buildRuleDispatch() const;
+
+    mutable QAtomicPointer<RuleDispatch> ruleDispatch_;
 };
 
 } // namespace Qutepart
@@ -4,71 +4,162 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <algorithm>
+
 #include <QDebug>
 #include <QHashFunctions>
+#include <QMutexLocker>
 
 #include "context.h"
 #include "context_switcher.h"
+#include "memory_usage.h"
 
 #include "context_stack.h"
 
 #define VERBOSE_LOGS 0
 
 namespace Qutepart {
-// FIXME avoid data where possible
-
-ContextStackItem::ContextStackItem() : context(nullptr) {}
-
-ContextStackItem::ContextStackItem(const Context *context, const QStringList &data)
-    : context(context), data(data) {}
 
-bool ContextStackItem::operator==(const ContextStackItem &other) const {
-    return context == other.context && data == other.data;
+namespace {
+size_t nodeHash(const ContextStackNode *parent, const Context *context, const QStringList &data) {
+    return qHashMulti(0, parent ? parent->hash : 0, context, data);
 }
 
-ContextStack::ContextStack(Context *context) { items.append(ContextStackItem(context)); }
-
-ContextStack::ContextStack(const QVector<ContextStackItem> &items) : items(items) {}
-
-bool ContextStack::operator==(const ContextStack &other) const { return items == other.items; }
-
-const Context *ContextStack::currentContext() const { return items.last().context; }
-
-const QStringList &ContextStack::currentData() const { return items.last().data; }
+inline int childSlot(const Context *context) {
+    return (reinterpret_cast<quintptr>(context) / sizeof(void *)) %
+           ContextStackNode::CHILD_SLOTS;
+}
+} // namespace
 
 ContextStack ContextStack::switchContext(const ContextSwitcher &operation,
                                          const QStringList &data) const {
-    auto newItems = items;
+    auto newStack = *this;
 
     if (operation.popsCount() > 0) {
-        if (newItems.size() - 1 < operation.popsCount()) {
+        if (node->depth - 1 < operation.popsCount()) {
 #if VERBOSE_LOGS
-            qWarning() << "#pop value is too big " << newItems.size() << operation.popsCount();
+            qWarning() << "#pop value is too big " << node->depth << operation.popsCount();
 #endif
-
-            if (newItems.size() > 1) {
-                newItems = newItems.mid(0, 1);
-            }
+            newStack = node->table->root();
         } else {
-            newItems = newItems.mid(0, newItems.size() - operation.popsCount());
+            for (int i = 0; i < operation.popsCount(); i++) {
+                // the owner is replaced after the parent is copied, it may delete the node
+                auto parent = newStack.node->parent;
+                newStack.owner = newStack.node->parentOwner;
+                newStack.node = parent;
+            }
         }
     }
 
     if (!operation.context().isNull()) {
-        newItems.append(ContextStackItem(operation.context().data(), data));
+        newStack = node->table->push(newStack, operation.context().data(), data);
+    }
+
+    return newStack;
+}
+
+size_t qHash(const ContextStack &key, uint seed) { return key.node->hash ^ seed; }
+
+ContextStackTable::ContextStackTable(const Context *rootContext) {
+    rootNode = push(ContextStack(), rootContext, QStringList()).node;
+}
+
+ContextStackTable::~ContextStackTable() { qDeleteAll(nodes); }
+
+int ContextStackTable::size() const {
+    QMutexLocker locker(&mutex);
+    return nodes.size() + dataNodes.size();
+}
+
+size_t ContextStackTable::memoryUsage() const {
+    QMutexLocker locker(&mutex);
+    size_t result = nodes.capacity() * (sizeof(size_t) + sizeof(ContextStackNode *));
+    for (auto node : std::as_const(nodes)) {
+        result += sizeof(ContextStackNode) + stringListMemoryUsage(node->data);
+    }
+    result += dataNodes.capacity() *
+              (sizeof(size_t) + sizeof(std::weak_ptr<const ContextStackNode>));
+    for (const auto &weakNode : std::as_const(dataNodes)) {
+        auto node = weakNode.lock();
+        if (node != nullptr) {
+            result += sizeof(ContextStackNode) + stringListMemoryUsage(node->data);
+        }
+    }
+    return result;
+}
+
+ContextStack ContextStackTable::push(const ContextStack &parent, const Context *context,
+                                     const QStringList &data) const {
+    auto parentNode = parent.node;
+    if (!data.isEmpty() || (parentNode != nullptr && parentNode->hasData())) {
+        return pushWithData(parent, context, data, nodeHash(parentNode, context, data));
+    }
+
+    /* Most switches push a context without data, which is already interned. Nodes are immutable
+     * once published, so the last children of the parent are checked without locking
+     */
+    std::atomic<const ContextStackNode *> *slot = nullptr;
+    if (parentNode != nullptr) {
+        slot = &parentNode->children[childSlot(context)];
+        auto child = slot->load(std::memory_order_acquire);
+        if (child != nullptr && child->context == context) {
+            return ContextStack(child);
+        }
+    }
+
+    auto hash = nodeHash(parentNode, context, data);
+    QMutexLocker locker(&mutex);
+    const ContextStackNode *node = nullptr;
+    for (auto it = nodes.constFind(hash); it != nodes.cend() && it.key() == hash; ++it) {
+        if (it.value()->parent == parentNode && it.value()->context == context) {
+            node = it.value();
+            break;
+        }
     }
 
-    return ContextStack(newItems);
+    if (node == nullptr) {
+        auto depth = parentNode ? parentNode->depth + 1 : 1;
+        auto newNode =
+            new ContextStackNode{this, parentNode, nullptr, context, {}, hash, depth, nextId++};
+        nodes.insert(hash, newNode);
+        node = newNode;
+    }
+
+    if (slot != nullptr) {
+        slot->store(node, std::memory_order_release);
+    }
+    return ContextStack(node);
 }
 
-bool ContextStack::operator!=(const ContextStack &other) const { return !(*this == other); }
+/* The node is shared by the stacks, and by its children. It is looked up through a weak
+ * pointer, a deleted one is created again with a new id
+ */
+ContextStack ContextStackTable::pushWithData(const ContextStack &parent, const Context *context,
+                                             const QStringList &data, size_t hash) const {
+    QMutexLocker locker(&mutex);
+    for (auto it = dataNodes.constFind(hash); it != dataNodes.cend() && it.key() == hash; ++it) {
+        auto node = it.value().lock();
+        if (node != nullptr && node->parent == parent.node && node->context == context &&
+            node->data == data) {
+            return ContextStack(node.get(), node);
+        }
+    }
 
-size_t qHash(const ContextStackItem &key, uint seed) {
-    return ::qHash(key.context, seed) ^ ::qHash(key.data, seed);
+    if (dataNodes.size() >= dataNodesLimit) {
+        sweepDataNodes();
+    }
+    std::shared_ptr<const ContextStackNode> node(new ContextStackNode{
+        this, parent.node, parent.owner, context, data, hash, parent.node->depth + 1, nextId++});
+    dataNodes.insert(hash, node);
+    return ContextStack(node.get(), node);
 }
 
-size_t qHash(const ContextStack &key, uint seed) {
-    return qHashRange(key.items.begin(), key.items.end(), seed);
+// Drop the deleted nodes. Called with the mutex locked
+void ContextStackTable::sweepDataNodes() const {
+    for (auto it = dataNodes.begin(); it != dataNodes.end();) {
+        it = it.value().expired() ? dataNodes.erase(it) : std::next(it);
+    }
+    dataNodesLimit = std::max(DATA_STACKS_SWEEP_SIZE, static_cast<int>(2 * dataNodes.size()));
 }
 
 } // namespace Qutepart
@@ -4,8 +4,6 @@
  * SPDX-License-Identifier: MIT
  */
 
-#include "loader.h"
-
 #include "context_switcher.h"
 
 namespace Qutepart {
@@ -21,13 +19,14 @@ QString ContextSwitcher::toString() const { return contextOperation; }
 bool ContextSwitcher::isNull() const { return contextOperation.isEmpty(); }
 
 void ContextSwitcher::resolveContextReferences(const QHash<QString, ContextPtr> &contexts,
+                                               ExternalContexts &externalContexts,
                                                QString &error) {
     if (contextName.isEmpty()) {
         return;
     }
 
     if (contextName.contains('#')) {
-        _context = loadExternalContext(contextName);
+        externalContext = referExternalContext(contextName, externalContexts);
         return;
     }
 
@@ -10,6 +10,8 @@
 #include <QSharedPointer>
 #include <QString>
 
+#include "external_context.h"
+
 namespace Qutepart {
 
 class Context;
@@ -23,15 +25,19 @@ class ContextSwitcher {
     QString toString() const;
     bool isNull() const;
 
-    void resolveContextReferences(const QHash<QString, ContextPtr> &contexts, QString &error);
+    void resolveContextReferences(const QHash<QString, ContextPtr> &contexts,
+                                  ExternalContexts &externalContexts, QString &error);
 
     int popsCount() const { return _popsCount; }
-    ContextPtr context() const { return _context; }
+    // Context of another language is loaded on the first call, see ExternalContext
+    ContextPtr context() const { return externalContext ? externalContext->context() : _context; }
+    bool isExternal() const { return !externalContext.isNull(); }
 
   protected:
     int _popsCount;
     QString contextName;
     ContextPtr _context;
+    ExternalContextPtr externalContext;
     QString contextOperation;
 };
 
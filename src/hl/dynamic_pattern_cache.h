@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QStringList>
+
+namespace Qutepart {
+
+/* Patterns of a dynamic rule, by the data captured when its context was entered.
+ * Dynamic rules are tried at every column of i.e. a heredoc, always with the same data, so
+ * substituting and compiling the pattern once per data is enough.
+ * Bounded, least recently used entries are dropped. Thread safe.
+ */
+template <typename T> class DynamicPatternCache {
+  public:
+    static constexpr int CAPACITY = 32;
+
+    DynamicPatternCache() : cache(CAPACITY) {}
+
+    template <typename MakePattern> T get(const QStringList &data, MakePattern makePattern) {
+        QMutexLocker locker(&mutex);
+        if (auto cached = cache.object(data)) {
+            return *cached;
+        }
+
+        T pattern = makePattern(data);
+        cache.insert(data, new T(pattern));
+        return pattern;
+    }
+
+    inline int size() const {
+        QMutexLocker locker(&mutex);
+        return cache.size();
+    }
+
+  private:
+    mutable QMutex mutex;
+    QCache<QStringList, T> cache;
+};
+
+} // namespace Qutepart
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "external_context.h"
+#include "loader.h"
+
+namespace Qutepart {
+
+std::atomic<quint32> externalContextsGeneration{0};
+
+ExternalContext::ExternalContext(const QString &name) : _name(name) {}
+
+const ContextPtr &ExternalContext::context() const {
+    if (resolved.loadAcquire() == 0) {
+        /* Loading a language doesn't resolve external contexts, so the lock is not taken again
+         * while the language is loading
+         */
+        QMutexLocker locker(&mutex);
+        if (resolved.loadRelaxed() == 0) {
+            _context = loadExternalContext(_name);
+            resolved.storeRelease(1);
+            externalContextsGeneration.fetch_add(1, std::memory_order_release);
+        }
+    }
+    return _context;
+}
+
+ExternalContextPtr referExternalContext(const QString &name, ExternalContexts &externalContexts) {
+    auto &context = externalContexts[name];
+    if (context.isNull()) {
+        context = ExternalContextPtr::create(name);
+    }
+    return context;
+}
+
+} // namespace Qutepart
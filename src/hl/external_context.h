@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QAtomicInt>
+#include <QHash>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QString>
+
+namespace Qutepart {
+
+class Context;
+typedef QSharedPointer<Context> ContextPtr;
+
+/* A context of another language, "Context##Language", or "##Language" for its default context.
+ *
+ * Referring to it doesn't load the other language. The language is loaded by the first
+ * context() call, when highlighting reaches a rule which includes or switches to the context.
+ * Thread safe, the language is loaded once.
+ */
+class ExternalContext {
+  public:
+    explicit ExternalContext(const QString &name);
+
+    inline const QString &name() const { return _name; }
+
+    // Null if the language or the context doesn't exist
+    const ContextPtr &context() const;
+    inline bool isResolved() const { return resolved.loadAcquire() != 0; }
+
+  private:
+    QString _name;
+    mutable QMutex mutex;
+    mutable QAtomicInt resolved;
+    mutable ContextPtr _context;
+};
+
+/* Incremented whenever an external context of any language is resolved. Contexts check it
+ * instead of all their unresolved handles, see Context::ruleDispatch()
+ */
+extern std::atomic<quint32> externalContextsGeneration;
+inline quint32 getExternalContextsGeneration() {
+    return externalContextsGeneration.load(std::memory_order_acquire);
+}
+
+typedef QSharedPointer<ExternalContext> ExternalContextPtr;
+
+// External contexts referred by a language, by name. Every name is resolved once
+typedef QHash<QString, ExternalContextPtr> ExternalContexts;
+
+// The handle of the external context, added to externalContexts on the first reference
+ExternalContextPtr referExternalContext(const QString &name, ExternalContexts &externalContexts);
+
+} // namespace Qutepart
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include "highlighted_line.h"
+
+namespace Qutepart {
+
+HighlightedLine::HighlightedLine(int length, const ContextStack &startContextStack)
+    : length(length), endContextStack(startContextStack) {}
+
+void HighlightedLine::reset(int length, const ContextStack &startContextStack) {
+    this->length = length;
+    endContextStack = startContextStack;
+    lineContinue = false;
+    formats.clear();
+    textTypes.clear();
+    languages.clear();
+    regionChanges.clear();
+}
+
+void HighlightedLine::appendFormat(int start, int length, int styleId) {
+    if ((!formats.isEmpty()) && (formats.last().start + formats.last().length) == start &&
+        formats.last().styleId == styleId) {
+        formats.last().length += length;
+    } else {
+        formats.append({start, length, styleId});
+    }
+}
+
+void HighlightedLine::appendTextType(int start, int length, QChar textType) {
+    if ((!textTypes.isEmpty()) && (textTypes.last().start + textTypes.last().length) == start &&
+        textTypes.last().textType == textType) {
+        textTypes.last().length += length;
+    } else {
+        textTypes.append({start, length, textType});
+    }
+}
+
+void HighlightedLine::appendLanguage(int start, int length, Language *language) {
+    if ((!languages.isEmpty()) && (languages.last().start + languages.last().length) == start &&
+        languages.last().language == language) {
+        languages.last().length += length;
+    } else {
+        languages.append({start, length, language});
+    }
+}
+
+void HighlightedLine::beginRegion(const QString &name) {
+    regionChanges.append({RegionChange::Begin, name});
+}
+
+void HighlightedLine::endRegion(const QString &name) {
+    regionChanges.append({RegionChange::End, name});
+}
+
+QString HighlightedLine::textTypeMap() const {
+    QString result(length, ' ');
+    for (const auto &run : textTypes) {
+        for (auto i = run.start; i < run.start + run.length; i++) {
+            result[i] = run.textType;
+        }
+    }
+    return result;
+}
+
+QVector<Language *> HighlightedLine::languageMap() const {
+    QVector<Language *> result(length);
+    for (const auto &run : languages) {
+        for (auto i = run.start; i < run.start + run.length; i++) {
+            result[i] = run.language;
+        }
+    }
+    return result;
+}
+
+void HighlightedLine::writeSpans(TextSpans &spans) const {
+    spans.reset(length);
+
+    int textTypeIndex = 0;
+    int languageIndex = 0;
+    int pos = 0;
+    while (pos < length) {
+        // runs are sorted and may be empty (look ahead rules)
+        while (textTypeIndex < textTypes.size() &&
+               textTypes[textTypeIndex].start + textTypes[textTypeIndex].length <= pos) {
+            textTypeIndex++;
+        }
+        while (languageIndex < languages.size() &&
+               languages[languageIndex].start + languages[languageIndex].length <= pos) {
+            languageIndex++;
+        }
+
+        int end = length;
+        QChar textType = ' ';
+        if (textTypeIndex < textTypes.size()) {
+            const auto &run = textTypes[textTypeIndex];
+            if (run.start <= pos) {
+                textType = run.textType;
+                end = std::min(end, run.start + run.length);
+            } else {
+                end = std::min(end, run.start);
+            }
+        }
+
+        Language *language = nullptr;
+        if (languageIndex < languages.size()) {
+            const auto &run = languages[languageIndex];
+            if (run.start <= pos) {
+                language = run.language;
+                end = std::min(end, run.start + run.length);
+            } else {
+                end = std::min(end, run.start);
+            }
+        }
+
+        spans.append(pos, textType, language);
+        pos = end;
+    }
+}
+
+void HighlightedLine::applyRegionChanges(QStack<QString> &regions) const {
+    for (const auto &change : regionChanges) {
+        if (change.kind == RegionChange::Begin) {
+            regions.push(change.name);
+        } else if (!regions.isEmpty() && regions.top() == change.name) {
+            regions.pop();
+        }
+    }
+}
+
+} // namespace Qutepart
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <QStack>
+#include <QString>
+#include <QTextCharFormat>
+#include <QVector>
+
+#include "context_stack.h"
+#include "text_spans.h"
+
+namespace Qutepart {
+
+class Language;
+
+/* Result of highlighting one line with Language::highlightLine().
+ * Plain data, which does not reference the document. It can be produced on a worker thread and
+ * applied to the document on the GUI thread. Positions are in UTF-16 code units.
+ */
+class HighlightedLine {
+  public:
+    struct FormatRun {
+        int start;
+        int length;
+        // In the StyleTable. Look the format up when applying, with the theme of the view
+        int styleId;
+    };
+
+    struct TextTypeRun {
+        int start;
+        int length;
+        QChar textType; // see detectTextType()
+    };
+
+    struct LanguageRun {
+        int start;
+        int length;
+        Language *language;
+    };
+
+    struct RegionChange {
+        enum Kind { Begin, End };
+        Kind kind;
+        QString name;
+    };
+
+    HighlightedLine(int length, const ContextStack &startContextStack);
+
+    // Start a new line. Keeps the allocated memory, so a line object can be reused
+    void reset(int length, const ContextStack &startContextStack);
+
+    void appendFormat(int start, int length, int styleId);
+    void appendTextType(int start, int length, QChar textType);
+    void appendLanguage(int start, int length, Language *language);
+    void beginRegion(const QString &name);
+    void endRegion(const QString &name);
+
+    // Expand the runs to one entry per character
+    QString textTypeMap() const;
+    QVector<Language *> languageMap() const;
+
+    // Merge text type and language runs, as stored in TextBlockUserData
+    void writeSpans(TextSpans &spans) const;
+
+    // Apply region changes of the line to the regions open at the end of the previous line
+    void applyRegionChanges(QStack<QString> &regions) const;
+
+    int length;
+    ContextStack endContextStack;
+    bool lineContinue = false;
+    QVector<FormatRun> formats;
+    QVector<TextTypeRun> textTypes;
+    QVector<LanguageRun> languages;
+    QVector<RegionChange> regionChanges;
+};
+
+} // namespace Qutepart
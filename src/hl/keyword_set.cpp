@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include "keyword_set.h"
+
+namespace Qutepart {
+
+KeywordSet::KeywordSet(const QStringList &words, bool caseSensitive)
+    : caseSensitive(caseSensitive) {
+    // keep load factor below 0.5
+    int capacity = 8;
+    while (capacity < words.size() * 2) {
+        capacity *= 2;
+    }
+    table.fill(0, capacity);
+    entries.reserve(words.size());
+
+    for (const auto &word : words) {
+        insert(word);
+    }
+
+    entries.squeeze();
+    text.squeeze();
+}
+
+// FNV-1a over folded UTF-16 code units
+uint KeywordSet::hashWord(QStringView word) const {
+    uint hash = 2166136261u;
+    for (QChar ch : word) {
+        hash ^= fold(ch).unicode();
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool KeywordSet::entryEquals(const Entry &entry, QStringView word) const {
+    if (entry.length != word.length()) {
+        return false;
+    }
+
+    const QChar *stored = text.constData() + entry.offset;
+    for (int i = 0; i < entry.length; i++) {
+        if (stored[i] != fold(word.at(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void KeywordSet::insert(QStringView word) {
+    if (word.isEmpty()) {
+        return;
+    }
+
+    uint hash = hashWord(word);
+    uint mask = table.size() - 1;
+    uint slot = hash & mask;
+    while (table[slot] != 0) {
+        const auto &entry = entries[table[slot] - 1];
+        if (entry.hash == hash && entryEquals(entry, word)) {
+            return; // duplicate
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    Entry entry{static_cast<int>(text.size()), static_cast<int>(word.length()), hash};
+    for (QChar ch : word) {
+        text.append(fold(ch));
+    }
+    entries.append(entry);
+    table[slot] = entries.size();
+
+    if (entry.length < MAX_TRACKED_LENGTH) {
+        lengths.set(entry.length);
+    }
+    maxLength = std::max(maxLength, entry.length);
+
+    if (caseSensitive) {
+        firstChars.add(word.at(0));
+    } else {
+        firstChars.addCaseInsensitive(word.at(0));
+    }
+}
+
+bool KeywordSet::contains(QStringView word) const {
+    auto length = word.length();
+    if (length == 0 || length > maxLength) {
+        return false;
+    }
+    if (length < MAX_TRACKED_LENGTH && !lengths.test(length)) {
+        return false;
+    }
+    if (!firstChars.contains(word.at(0))) {
+        return false;
+    }
+
+    uint hash = hashWord(word);
+    uint mask = table.size() - 1;
+    uint slot = hash & mask;
+    while (table[slot] != 0) {
+        const auto &entry = entries[table[slot] - 1];
+        if (entry.hash == hash && entryEquals(entry, word)) {
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return false;
+}
+
+} // namespace Qutepart
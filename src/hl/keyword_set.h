@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <bitset>
+
+#include <QStringList>
+#include <QVector>
+
+#include "start_char_set.h"
+
+namespace Qutepart {
+
+/* Immutable set of keywords, used by KeywordRule.
+ * Open addressing hash table over UTF-16 code units. Lookup takes a QStringView and folds
+ * the case on the fly, so matching a word does not allocate memory.
+ * Words are rejected by length and by the first character before hashing.
+ */
+class KeywordSet {
+  public:
+    KeywordSet() = default;
+    KeywordSet(const QStringList &words, bool caseSensitive);
+
+    bool contains(QStringView word) const;
+
+    inline int size() const { return entries.size(); }
+    inline bool isEmpty() const { return entries.isEmpty(); }
+
+    // Characters a keyword can start with, both cases for case insensitive sets
+    inline const StartCharSet &startChars() const { return firstChars; }
+
+    // Heap memory held by the set, in bytes
+    inline size_t memoryUsage() const {
+        return text.capacity() * sizeof(QChar) + entries.capacity() * sizeof(Entry) +
+               table.capacity() * sizeof(int);
+    }
+
+  private:
+    struct Entry {
+        int offset; // in `text`
+        int length;
+        uint hash;
+    };
+
+    static constexpr int MAX_TRACKED_LENGTH = 64;
+
+    inline QChar fold(QChar ch) const {
+        if (caseSensitive) {
+            return ch;
+        }
+        auto code = ch.unicode();
+        if (code < 128) {
+            return (code >= 'A' && code <= 'Z') ? QChar(code + ('a' - 'A')) : ch;
+        }
+        return ch.toLower();
+    }
+
+    uint hashWord(QStringView word) const;
+    bool entryEquals(const Entry &entry, QStringView word) const;
+    void insert(QStringView word);
+
+    bool caseSensitive = true;
+    QVector<QChar> text;     // all keywords, folded, one after another
+    QVector<Entry> entries;  // one per unique keyword
+    QVector<int> table;      // index in entries + 1, 0 for empty slot. Size is power of 2
+    std::bitset<MAX_TRACKED_LENGTH> lengths; // lengths of keywords shorter than the limit
+    int maxLength = 0;
+    StartCharSet firstChars;
+};
+
+} // namespace Qutepart
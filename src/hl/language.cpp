@@ -5,9 +5,15 @@
  */
 
 #include <algorithm>
+#include <atomic>
+
+#include <QMutexLocker>
+#include <QSemaphore>
 
 #include "context_switcher.h"
 #include "language.h"
+#include "memory_usage.h"
+#include "profiler.h"
 #include "text_block_user_data.h"
 #include "text_to_match.h"
 
@@ -22,7 +28,7 @@ Language::Language(const QString &name, const QStringList &extensions, const QSt
       endMultilineComment(endMultilineComment), singleLineComment(singleLineComment),
       extensions(extensions), mimetypes(mimetypes), priority(priority), hidden(hidden),
       indenter(indenter), allLanguageKeywords_(allLanguageKeywords), contexts(contexts),
-      defaultContextStack(contexts[0].data()) {}
+      contextStackTable(contexts[0].data()), defaultContextStack(contextStackTable.root()) {}
 
 void Language::printDescription(QTextStream &out) const {
     out << "Language " << name << "\n";
@@ -45,51 +51,244 @@ void Language::printDescription(QTextStream &out) const {
     }
 }
 
-int Language::highlightBlock(QTextBlock block, QVector<QTextLayout::FormatRange> &formats) {
-    ContextStack contextStack = getContextStack(block);
-    TextToMatch textToMatch(block.text(), contextStack.currentData());
-    QString textTypeMap(textToMatch.text.length(), ' ');
-    QVector<Language *> languageMap(textToMatch.text.length());
-    auto lineContinue = false;
+size_t Language::grammarMemoryUsage() const {
+    size_t result = sizeof(Language) + stringMemoryUsage(name) +
+                    stringMemoryUsage(startMultilineComment) +
+                    stringMemoryUsage(endMultilineComment) +
+                    stringMemoryUsage(singleLineComment) + stringListMemoryUsage(extensions) +
+                    stringListMemoryUsage(mimetypes) + stringMemoryUsage(indenter) +
+                    allLanguageKeywords_.capacity() * sizeof(QString) + listMemoryUsage(contexts);
+    for (const auto &keyword : allLanguageKeywords_) {
+        result += stringMemoryUsage(keyword);
+    }
+    for (const auto &context : contexts) {
+        result += context->memoryUsage();
+    }
+    return result;
+}
+
+size_t Language::contextStacksMemoryUsage() const {
+    size_t result = contextStackTable.memoryUsage();
+
+    QMutexLocker locker(&blockStatesMutex);
+    result += blockStates.capacity() *
+              (sizeof(QPair<int, QStringList>) + sizeof(std::shared_ptr<const int>));
+    for (auto it = blockStates.cbegin(); it != blockStates.cend(); ++it) {
+        // the state shares the allocation with the counters of the pointer
+        result += stringListMemoryUsage(it.key().second) + 2 * sizeof(void *) + sizeof(int);
+    }
+    return result;
+}
+
+int Language::highlightBlock(QTextBlock block, const StyleTable &styles,
+                             QVector<QTextLayout::FormatRange> &formats) {
+    auto text = block.text();
+    // Reused by the following blocks. The language is shared, the line is per thread
+    thread_local HighlightedLine line(0, ContextStack());
+    highlightLine(text, getContextStack(block), line);
+    return applyHighlightedLine(block, line, styles, formats);
+}
+
+int Language::applyHighlightedLine(QTextBlock block, const HighlightedLine &line,
+                                   const StyleTable &styles,
+                                   QVector<QTextLayout::FormatRange> &formats) {
     auto data = static_cast<TextBlockUserData *>(block.userData());
     if (!data) {
-        data = new TextBlockUserData(textTypeMap, contextStack);
+        data = new TextBlockUserData(line.endContextStack);
         block.setUserData(data);
     }
 
+    // assign instead of clear(), which would allocate a copy of a list shared with the
+    // previous block
     QTextBlock prevBlock = block.previous();
-    if (prevBlock.isValid()) {
-        TextBlockUserData *prevData = static_cast<TextBlockUserData *>(prevBlock.userData());
-        if (prevData) {
-            data->regions = prevData->regions;
+    TextBlockUserData *prevData =
+        prevBlock.isValid() ? static_cast<TextBlockUserData *>(prevBlock.userData()) : nullptr;
+    data->regions = prevData ? prevData->regions : QStack<QString>();
+    line.applyRegionChanges(data->regions);
+    data->folding.level = data->regions.size();
+
+    line.writeSpans(data->textSpans);
+    data->contexts = line.endContextStack;
+    data->styleRuns.assign(line.formats.cbegin(), line.formats.cend());
+
+    formats.reserve(formats.size() + line.formats.size());
+    for (const auto &run : std::as_const(line.formats)) {
+        auto format = styles.format(run.styleId);
+        if (format == nullptr) {
+            continue;
         }
+        QTextLayout::FormatRange range;
+        range.start = run.start;
+        range.length = run.length;
+        range.format = *format;
+        formats.append(range);
     }
-    if (data) {
-        data->folding.level = data->regions.size();
+
+    data->highlightState = blockState(data->contexts, data->regions);
+    return *data->highlightState;
+}
+
+std::shared_ptr<const int> Language::blockState(const ContextStack &contextStack,
+                                                const QStack<QString> &regions) {
+    QPair<int, QStringList> key(contextStack.id(), regions);
+
+    QMutexLocker locker(&blockStatesMutex);
+    auto it = blockStates.constFind(key);
+    if (it != blockStates.cend()) {
+        return it.value();
+    }
+
+    /* Only the table refers to a state no block keeps, and blocks get states only here, under
+     * the lock. States are not reused, so a block never gets the state of another context stack
+     */
+    if (blockStates.size() >= blockStatesLimit) {
+        for (auto it = blockStates.begin(); it != blockStates.end();) {
+            it = it.value().use_count() == 1 ? blockStates.erase(it) : std::next(it);
+        }
+        blockStatesLimit = std::max(MAX_BLOCK_STATES, static_cast<int>(2 * blockStates.size()));
     }
+    auto state = std::make_shared<const int>(nextBlockState++);
+    blockStates.insert(key, state);
+    return state;
+}
+
+HighlightedLine Language::highlightLine(QStringView line,
+                                        const ContextStack &contextStack) const {
+    HighlightedLine result(line.length(), contextStack);
+    highlightLine(line, contextStack, result);
+    return result;
+}
+
+void Language::highlightLine(QStringView line, const ContextStack &contextStack,
+                             HighlightedLine &result) const {
+    // The profiler counts the rules, which are not tried for cached lines
+    const int cacheCapacity = getLineCacheCapacity();
+    if (cacheCapacity > 0 && !isProfilingEnabled()) {
+        if (!lineCache.find(line, contextStack, cacheCapacity, result)) {
+            parseLine(line, contextStack, result);
+            lineCache.insert(line, contextStack, result);
+        }
+        return;
+    }
+
+    if (cacheCapacity == 0 && !lineCache.isEmpty()) {
+        lineCache.clear();
+    }
+    parseLine(line, contextStack, result);
+}
+
+void Language::parseLine(QStringView line, const ContextStack &contextStack,
+                         HighlightedLine &result) const {
+    result.reset(line.length(), contextStack);
+    thread_local LineCharClasses charClasses;
+    TextToMatch textToMatch(line, contextStack.currentData(), charClasses);
 
+    auto currentStack = contextStack;
     do {
-        auto const context = contextStack.currentContext();
-        contextStack = context->parseBlock(contextStack, textToMatch, formats, textTypeMap,
-                                           languageMap, lineContinue, data);
+        auto const context = currentStack.currentContext();
+        currentStack = context->parseBlock(currentStack, textToMatch, result);
     } while (!textToMatch.isEmpty());
 
-    if (!lineContinue) {
-        contextStack = switchAtEndOfLine(contextStack);
+    if (!result.lineContinue) {
+        currentStack = switchAtEndOfLine(currentStack);
     }
 
-    data->textTypeMap = textTypeMap;
-    data->languageMap = languageMap;
-    data->contexts = contextStack;
+    result.endContextStack = currentStack;
+}
+
+QVector<HighlightedLine> Language::highlightLines(const QList<QStringView> &lines,
+                                                 int chunkLines, ParallelHighlightStats *stats,
+                                                 QThreadPool *pool,
+                                                 const ContextStack &contextStack) const {
+    QVector<HighlightedLine> result(lines.size(), HighlightedLine(0, defaultContextStack));
+    auto resultData = result.data(); // written by the workers, one chunk each
+
+    chunkLines = std::max(chunkLines, 1);
+    const int chunks = static_cast<int>((lines.size() + chunkLines - 1) / chunkLines);
+    std::atomic<int> nextChunk{0};
+    auto highlightChunks = [&]() {
+        for (int chunk = nextChunk++; chunk < chunks; chunk = nextChunk++) {
+            auto chunkStack = defaultContextStack;
+            if (chunk == 0 && !contextStack.isNull()) {
+                chunkStack = contextStack;
+            }
+            const int end = std::min(static_cast<int>(lines.size()), (chunk + 1) * chunkLines);
+            for (int i = chunk * chunkLines; i < end; i++) {
+                highlightLine(lines[i], chunkStack, resultData[i]);
+                chunkStack = resultData[i].endContextStack;
+            }
+        }
+    };
+
+    /* The calling thread highlights too. Workers are started only if the pool has free threads,
+     * so a call from a task of the same pool doesn't wait for itself
+     */
+    QSemaphore finished;
+    int workers = 0;
+    for (int i = 1; i < chunks && pool != nullptr; i++) {
+        if (!pool->tryStart([&]() {
+                highlightChunks();
+                finished.release();
+            })) {
+            break;
+        }
+        workers++;
+    }
+    highlightChunks();
+    finished.acquire(workers);
 
-    size_t regionsHash = 0;
-    for (const auto &region : std::as_const(data->regions)) {
-        regionsHash = qHash(region, regionsHash);
+    ParallelHighlightStats counters;
+    counters.chunks = chunks;
+    for (int chunk = 1; chunk < chunks; chunk++) {
+        const int begin = chunk * chunkLines;
+        auto chunkStack = result[begin - 1].endContextStack;
+        if (chunkStack == defaultContextStack) {
+            continue;
+        }
+
+        counters.rehighlightedChunks++;
+        const int end = std::min(static_cast<int>(lines.size()), begin + chunkLines);
+        for (int i = begin; i < end; i++) {
+            auto guessedEnd = result[i].endContextStack;
+            highlightLine(lines[i], chunkStack, result[i]);
+            counters.rehighlightedLines++;
+            chunkStack = result[i].endContextStack;
+            if (chunkStack == guessedEnd) {
+                break; // the following lines are the same as highlighted from the real context
+            }
+        }
     }
 
-    return static_cast<int>((qHash(contextStack) ^ regionsHash));
+    if (stats != nullptr) {
+        *stats = counters;
+    }
+    return result;
 }
 
+LineCache::Stats Language::lineCacheStats() const { return lineCache.stats(); }
+
+void Language::resetLineCacheStats() { lineCache.resetStats(); }
+
+size_t Language::lineCacheMemoryUsage() const { return lineCache.memoryUsage(); }
+
+QList<ProfileEntry> Language::profile() const {
+    QList<ProfileEntry> entries;
+    for (const auto &context : contexts) {
+        context->appendProfile(entries);
+    }
+    return entries;
+}
+
+void Language::resetProfile() {
+    for (auto &context : contexts) {
+        context->resetProfile();
+    }
+}
+
+void Language::printProfile(QTextStream &out) const { printProfileTable(name, profile(), out); }
+
+QJsonObject Language::profileJson() const { return profileToJson(name, profile()); }
+
 ContextPtr Language::getContext(const QString &contextName) const {
     auto it = std::find_if(contexts.begin(), contexts.end(), [&contextName](const ContextPtr &ctx) {
         return ctx->name() == contextName;
@@ -101,13 +300,44 @@ ContextPtr Language::getContext(const QString &contextName) const {
     return ContextPtr();
 }
 
-void Language::setTheme(const Theme *theme) {
-    for (auto &ctx : contexts) {
-        ctx->setTheme(theme);
+void Language::setExternalContexts(const ExternalContexts &contexts) {
+    externalContexts = contexts;
+}
+
+void Language::resolveExternalContexts() const {
+    QSet<const Language *> visited{this};
+    QList<const Language *> pending{this};
+    while (!pending.isEmpty()) {
+        auto language = pending.takeLast();
+        for (const auto &externalContext : language->externalContexts) {
+            const auto &context = externalContext->context();
+            if (context.isNull() || context->language.isNull() ||
+                visited.contains(context->language.data())) {
+                continue;
+            }
+            visited.insert(context->language.data());
+            pending.append(context->language.data());
+        }
+    }
+}
+
+QStringList Language::loadedExternalLanguages() const {
+    QStringList result;
+    for (const auto &externalContext : externalContexts) {
+        if (!externalContext->isResolved()) {
+            continue;
+        }
+        const auto &context = externalContext->context();
+        if (!context.isNull() && !context->language.isNull() &&
+            !result.contains(context->language->fileName)) {
+            result.append(context->language->fileName);
+        }
     }
+    result.sort();
+    return result;
 }
 
-ContextStack Language::getContextStack(QTextBlock block) {
+ContextStack Language::getContextStack(QTextBlock block) const {
     TextBlockUserData *data = nullptr;
 
     QTextBlock prevBlock = block.previous();
@@ -115,16 +345,17 @@ ContextStack Language::getContextStack(QTextBlock block) {
         data = static_cast<TextBlockUserData *>(prevBlock.userData());
     }
 
-    if (data != nullptr) {
+    if (data != nullptr && !data->contexts.isNull()) {
         return data->contexts;
     } else {
         return defaultContextStack;
     }
 }
 
-ContextStack Language::switchAtEndOfLine(ContextStack contextStack) {
+ContextStack Language::switchAtEndOfLine(ContextStack contextStack) const {
     while (!contextStack.currentContext()->lineEndContext().isNull()) {
         ContextStack oldStack = contextStack;
+        contextStack.currentContext()->recordContextSwitch();
         contextStack = contextStack.switchContext(contextStack.currentContext()->lineEndContext());
         if (oldStack == contextStack) {
             // avoid infinite while loop if nothing to switch
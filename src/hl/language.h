@@ -6,17 +6,32 @@
 
 #pragma once
 
+#include <memory>
+
+#include <QHash>
 #include <QList>
+#include <QMutex>
+#include <QPair>
 #include <QSet>
+#include <QStack>
 #include <QTextBlock>
 #include <QTextStream>
+#include <QThreadPool>
 
 #include "context.h"
 #include "context_stack.h"
+#include "highlighted_line.h"
+#include "line_cache.h"
 
 namespace Qutepart {
 
-class Theme;
+// Counters of Language::highlightLines()
+struct ParallelHighlightStats {
+    int chunks = 0;
+    // Chunks which didn't start in the default context, and their lines highlighted again
+    int rehighlightedChunks = 0;
+    int rehighlightedLines = 0;
+};
 
 class Language {
   public:
@@ -26,11 +41,79 @@ class Language {
              const QSet<QString> &allLanguageKeywords, const QList<ContextPtr> &contexts);
 
     void printDescription(QTextStream &out) const;
-    int highlightBlock(QTextBlock block, QVector<QTextLayout::FormatRange> &formats);
+    // Formats are taken from styles, the table of the theme of the document
+    int highlightBlock(QTextBlock block, const StyleTable &styles,
+                       QVector<QTextLayout::FormatRange> &formats);
+    // Same, but the block has already been highlighted from getContextStack(block) as `line`
+    int applyHighlightedLine(QTextBlock block, const HighlightedLine &line,
+                             const StyleTable &styles, QVector<QTextLayout::FormatRange> &formats);
+
+    /* Highlight one line, starting with the context stack at the end of the previous line.
+     * Does not touch the document or any other GUI object, so it can run on a worker thread.
+     * The grammar is not modified after loading, so the language may be used by several threads
+     * at once. Formats are not part of the result, see StyleTable.
+     */
+    HighlightedLine highlightLine(QStringView line, const ContextStack &contextStack) const;
+    // Same, but reuse the memory of `result`
+    void highlightLine(QStringView line, const ContextStack &contextStack,
+                       HighlightedLine &result) const;
+
+    /* Highlight all the lines of a document, i.e. a huge file, on several threads.
+     *
+     * The lines are split into chunks of `chunkLines`, all of them are highlighted in parallel
+     * starting from the default context stack. Most lines end in the default context, see
+     * switchAtEndOfLine(). Then the chunks which really start in another context are highlighted
+     * again in order, until a line ends in the same context stack as it did before.
+     * The result is the same as of highlighting the lines one by one.
+     * The first line starts with `contextStack`, or the default one if it is null.
+     */
+    QVector<HighlightedLine>
+    highlightLines(const QList<QStringView> &lines, int chunkLines,
+                   ParallelHighlightStats *stats = nullptr,
+                   QThreadPool *pool = QThreadPool::globalInstance(),
+                   const ContextStack &contextStack = ContextStack()) const;
+
+    // Context stack at the end of the previous block, where highlighting of `block` starts
+    ContextStack getContextStack(QTextBlock block) const;
+
+    // Context stack of the first line of a document
+    inline const ContextStack &getDefaultContextStack() const { return defaultContextStack; }
+
+    /* Block state for QSyntaxHighlighter. Equal states mean equal context stacks and folding
+     * regions at the end of the block, there are no collisions. Blocks keep the returned pointer,
+     * see TextBlockUserData::highlightState. When MAX_BLOCK_STATES states are remembered, the
+     * ones no block keeps are forgotten, so the state of a live block never changes.
+     */
+    static constexpr int MAX_BLOCK_STATES = 1 << 16;
+    std::shared_ptr<const int> blockState(const ContextStack &contextStack,
+                                          const QStack<QString> &regions);
+
+    inline const ContextStackTable &getContextStackTable() const { return contextStackTable; }
+
+    /* Estimated memory, in bytes, of the loaded grammar (contexts, rules, keyword lists) and of
+     * the context stacks and block states interned while highlighting. Both are shared by all
+     * documents using the language.
+     */
+    size_t grammarMemoryUsage() const;
+    size_t contextStacksMemoryUsage() const;
+
+    /* Hits and misses of the cache of highlighted lines, and its memory, in bytes.
+     * See setLineCacheCapacity()
+     */
+    LineCache::Stats lineCacheStats() const;
+    void resetLineCacheStats();
+    size_t lineCacheMemoryUsage() const;
+
+    /* Counters of all contexts and rules, collected while the profiler is enabled.
+     * See profiler.h
+     */
+    QList<ProfileEntry> profile() const;
+    void resetProfile();
+    void printProfile(QTextStream &out) const;
+    QJsonObject profileJson() const;
 
     inline ContextPtr defaultContext() const { return contexts.first(); }
     ContextPtr getContext(const QString &contextName) const;
-    void setTheme(const Theme *theme);
 
     inline const QSet<QString> &allLanguageKeywords() const { return allLanguageKeywords_; }
     inline const QString &getStartMultilineComment() const { return startMultilineComment; }
@@ -38,6 +121,15 @@ class Language {
     inline const QString &getSingleLineComment() const { return singleLineComment; }
     inline const QString &getName() const { return name; }
 
+    /* Contexts of other languages this language includes or switches to. The languages are
+     * loaded when highlighting reaches them
+     */
+    void setExternalContexts(const ExternalContexts &contexts);
+    // Load the languages of the external contexts now, and the ones they include
+    void resolveExternalContexts() const;
+    // Languages loaded so far because of the external contexts, XML file names
+    QStringList loadedExternalLanguages() const;
+
     QString fileName;
 
   protected:
@@ -54,10 +146,20 @@ class Language {
     QSet<QString> allLanguageKeywords_;
 
     QList<ContextPtr> contexts;
+    ExternalContexts externalContexts;
+    ContextStackTable contextStackTable;
     ContextStack defaultContextStack;
 
-    ContextStack getContextStack(QTextBlock block);
-    ContextStack switchAtEndOfLine(ContextStack contextStack);
+    mutable QMutex blockStatesMutex;
+    QHash<QPair<int, QStringList>, std::shared_ptr<const int>> blockStates;
+    int nextBlockState = 0;
+    int blockStatesLimit = MAX_BLOCK_STATES; // grows if the blocks keep more states
+
+    mutable LineCache lineCache;
+
+    ContextStack switchAtEndOfLine(ContextStack contextStack) const;
+    void parseLine(QStringView line, const ContextStack &contextStack,
+                   HighlightedLine &result) const;
 };
 
 } // namespace Qutepart
@@ -4,65 +4,174 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <algorithm>
+
 #include <QDebug>
 #include <QFileInfo>
-#include <QMap>
+#include <QList>
 #include <QRegularExpression>
 #include <QString>
 
+#include "language_db.h"
 #include "qutepart.h"
 
 namespace Qutepart {
 
-extern QMap<QString, QString> mimeTypeToXmlFileName;
-extern QMap<QString, QString> languageNameToXmlFileName;
-extern QMap<QString, QString> extensionToXmlFileName;
-extern QMap<QString, QString> firstLineToXmlFileName;
-extern QMap<QString, QString> xmlFileNameToIndenter;
+namespace {
 
-/*
- * Search value in map {glob pattern: value}
- * Match string with glob pattern key
+struct KeyLess {
+    bool operator()(const LanguageDbEntry &entry, QStringView key) const {
+        return key.compare(QLatin1String(entry.key)) > 0;
+    }
+    bool operator()(QStringView key, const LanguageDbEntry &entry) const {
+        return key.compare(QLatin1String(entry.key)) < 0;
+    }
+};
+
+QString findValue(const LanguageDbTable<LanguageDbEntry> &table, QStringView key) {
+    auto it = std::lower_bound(table.begin(), table.end(), key, KeyLess());
+    if (it != table.end() && key == QLatin1String(it->key)) {
+        return QString::fromLatin1(it->value);
+    }
+    return QString();
+}
+
+// The matching glob with the lowest rank
+class GlobMatch {
+  public:
+    void offer(const LanguageDbGlob &glob) {
+        if (best == nullptr || glob.rank < best->rank) {
+            best = &glob;
+        }
+    }
+
+    bool beats(const LanguageDbGlob &glob) const {
+        return best != nullptr && best->rank < glob.rank;
+    }
+
+    QString value() const { return best ? QString::fromLatin1(best->value) : QString(); }
+
+  private:
+    const LanguageDbGlob *best = nullptr;
+};
+
+/* Offers the globs which patterns are prefixes of a string, or only the one equal to it if
+ * exact. charAt(i) is the lower case character i of the string.
+ * The table is sorted, so the patterns which start with the first i characters of the string
+ * are a range, and those of length i are the first in it. The range is narrowed by one
+ * character at a time, usually it is empty after a few characters
  */
-QString searchInGlobMap(const QMap<QString, QString> &map, const QString &string) {
-    QMap<QString, QString>::const_iterator it = map.begin();
-    while (it != map.end()) {
-        QString wildcardExp = QRegularExpression::wildcardToRegularExpression(it.key());
-        QRegularExpression re(QRegularExpression::anchoredPattern(wildcardExp),
-                              QRegularExpression::CaseInsensitiveOption);
-        if (re.match(string).hasMatch()) {
-            return it.value();
+template <typename CharAt>
+void matchPrefixes(const LanguageDbTable<LanguageDbGlob> &table, qsizetype length, CharAt charAt,
+                   bool exact, GlobMatch &match) {
+    auto lo = table.begin();
+    auto hi = table.end();
+    for (qsizetype i = 0; lo < hi; i++) {
+        for (; lo < hi && lo->pattern[i] == '\0'; ++lo) {
+            if (!exact || i == length) {
+                match.offer(*lo);
+            }
+        }
+        if (i == length) {
+            break;
+        }
+
+        char16_t chr = charAt(i);
+        lo = std::lower_bound(lo, hi, chr, [i](const LanguageDbGlob &glob, char16_t c) {
+            return char16_t(uchar(glob.pattern[i])) < c;
+        });
+        hi = std::upper_bound(lo, hi, chr, [i](char16_t c, const LanguageDbGlob &glob) {
+            return c < char16_t(uchar(glob.pattern[i]));
+        });
+    }
+}
+
+// Globs matched with regular expressions, compiled once
+class WildcardGlobs {
+  public:
+    explicit WildcardGlobs(const LanguageDbTable<LanguageDbGlob> &globs) {
+        for (const auto &glob : globs) {
+            QString wildcardExp =
+                QRegularExpression::wildcardToRegularExpression(QLatin1String(glob.pattern));
+            QRegularExpression re(QRegularExpression::anchoredPattern(wildcardExp),
+                                  QRegularExpression::CaseInsensitiveOption);
+            // Compile now, matching is then safe from any thread
+            re.optimize();
+            items.append({&glob, re});
         }
-        ++it;
     }
 
-    return QString();
+    void match(const QString &string, GlobMatch &match) const {
+        for (const auto &item : items) {
+            if (match.beats(*item.glob)) {
+                break; // sorted by rank
+            }
+            if (item.re.match(string).hasMatch()) {
+                match.offer(*item.glob);
+                break;
+            }
+        }
+    }
+
+  private:
+    struct Item {
+        const LanguageDbGlob *glob;
+        QRegularExpression re;
+    };
+    QList<Item> items;
+};
+
+QString searchFileNameGlobs(const QString &fileName) {
+    static const WildcardGlobs residualGlobs(residualFileNameGlobs);
+
+    auto lowerAt = [&fileName](qsizetype i) { return fileName[i].toLower().unicode(); };
+    auto reversedLowerAt = [&fileName](qsizetype i) {
+        return fileName[fileName.size() - 1 - i].toLower().unicode();
+    };
+
+    GlobMatch match;
+    matchPrefixes(fileNameGlobs, fileName.size(), lowerAt, true, match);
+    matchPrefixes(fileNameSuffixGlobs, fileName.size(), reversedLowerAt, false, match);
+    matchPrefixes(fileNamePrefixGlobs, fileName.size(), lowerAt, false, match);
+    residualGlobs.match(fileName, match);
+    return match.value();
 }
 
+QString searchFirstLineGlobs(const QString &firstLine) {
+    static const WildcardGlobs globs(firstLineGlobs);
+
+    GlobMatch match;
+    globs.match(firstLine, match);
+    return match.value();
+}
+
+} // namespace
+
 QString chooseLanguageXmlFileName(const QString &mimeType, const QString &languageName,
                                   const QString &sourceFilePath, const QString &firstLine) {
     if (!mimeType.isNull()) {
-        if (mimeTypeToXmlFileName.contains(mimeType)) {
-            return mimeTypeToXmlFileName[mimeType];
+        QString xmlName = findValue(mimeTypeToXmlFileName, mimeType);
+        if (!xmlName.isNull()) {
+            return xmlName;
         }
     }
 
     if (!languageName.isNull()) {
-        if (languageNameToXmlFileName.contains(languageName)) {
-            return languageNameToXmlFileName[languageName];
+        QString xmlName = findValue(languageNameToXmlFileName, languageName);
+        if (!xmlName.isNull()) {
+            return xmlName;
         }
     }
 
     if (!sourceFilePath.isNull()) {
-        QString fileName = QFileInfo(sourceFilePath).fileName();
-        QString xmlName = searchInGlobMap(extensionToXmlFileName, fileName);
+        QString xmlName = searchFileNameGlobs(QFileInfo(sourceFilePath).fileName());
         if (!xmlName.isNull()) {
             return xmlName;
         }
     }
 
     if (!firstLine.isNull()) {
-        QString xmlName = searchInGlobMap(firstLineToXmlFileName, firstLine);
+        QString xmlName = searchFirstLineGlobs(firstLine);
         if (!xmlName.isNull()) {
             return xmlName;
         }
@@ -108,8 +217,13 @@ LangInfo chooseLanguage(const QString &mimeType, const QString &languageName,
     if (xmlName.isNull()) {
         return LangInfo();
     } else {
-        QList<QString> langNames = languageNameToXmlFileName.keys(xmlName);
-        IndentAlg indentAlg = convertIndenter(xmlFileNameToIndenter[xmlName]);
+        QList<QString> langNames;
+        auto range = std::equal_range(xmlFileNameToLanguageNames.begin(),
+                                      xmlFileNameToLanguageNames.end(), xmlName, KeyLess());
+        for (auto it = range.first; it != range.second; ++it) {
+            langNames.append(QString::fromLatin1(it->value));
+        }
+        IndentAlg indentAlg = convertIndenter(findValue(xmlFileNameToIndenter, xmlName));
         return LangInfo(xmlName, langNames, indentAlg);
     }
 }
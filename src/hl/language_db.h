@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace Qutepart {
+
+/* The language DB, generated from the syntax files by regenerate-language-db.py to
+ * language_db_generated.cpp.
+ *
+ * All the tables are constant data, sorted by key. Nothing is built when the library is loaded
+ */
+struct LanguageDbEntry {
+    const char *key;
+    const char *value;
+};
+
+/* A glob of the file name or first line tables.
+ * rank is the position of the original glob in the sorted list of all the globs of the table.
+ * If several globs match, the lowest rank wins
+ */
+struct LanguageDbGlob {
+    const char *pattern;
+    const char *value;
+    int rank;
+};
+
+template <typename T> struct LanguageDbTable {
+    const T *entries;
+    size_t size;
+
+    const T *begin() const { return entries; }
+    const T *end() const { return entries + size; }
+};
+
+extern const LanguageDbTable<LanguageDbEntry> languageNameToXmlFileName;
+extern const LanguageDbTable<LanguageDbEntry> mimeTypeToXmlFileName;
+extern const LanguageDbTable<LanguageDbEntry> xmlFileNameToIndenter;
+// (XML file name, language name), a language might have several names
+extern const LanguageDbTable<LanguageDbEntry> xmlFileNameToLanguageNames;
+
+/* File name globs, split by their shape. Matching is not case sensitive, the patterns of the
+ * first 3 tables are in lower case:
+ *
+ *     fileNameGlobs            "name", no wildcards
+ *     fileNameSuffixGlobs      "*.ext" and "*name". The pattern is the literal part reversed
+ *     fileNamePrefixGlobs      "name*"
+ *     residualFileNameGlobs    everything else, matched as wildcards, sorted by rank
+ */
+extern const LanguageDbTable<LanguageDbGlob> fileNameGlobs;
+extern const LanguageDbTable<LanguageDbGlob> fileNameSuffixGlobs;
+extern const LanguageDbTable<LanguageDbGlob> fileNamePrefixGlobs;
+extern const LanguageDbTable<LanguageDbGlob> residualFileNameGlobs;
+
+// Matched as wildcards, sorted by rank
+extern const LanguageDbTable<LanguageDbGlob> firstLineGlobs;
+
+} // namespace Qutepart
@@ -1,1478 +1,1816 @@
 // This file is autogenerated by regenerate-language-db.py
 // Do not edit it
 
-#include <QMap>
-#include <QString>
+#include <iterator>
+
+#include "language_db.h"
 
 namespace Qutepart {
 
-QMap<QString, QString> create_languageNameToXmlFileName() {
-    QMap<QString, QString> languageNameToXmlFileName;
-    languageNameToXmlFileName["GLSL"] = "glsl.xml";
-    languageNameToXmlFileName["ABAP"] = "abap.xml";
-    languageNameToXmlFileName["ILERPG"] = "ilerpg.xml";
-    languageNameToXmlFileName["FSharp"] = "fsharp.xml";
-    languageNameToXmlFileName["LLVM"] = "llvm.xml";
-    languageNameToXmlFileName["Cg"] = "cg.xml";
-    languageNameToXmlFileName["Klipper Config"] = "klipper-config.xml";
-    languageNameToXmlFileName["QMake"] = "qmake.xml";
-    languageNameToXmlFileName["Git Ignore"] = "git-ignore.xml";
-    languageNameToXmlFileName["noweb"] = "noweb.xml";
-    languageNameToXmlFileName["UnrealScript"] = "uscript.xml";
-    languageNameToXmlFileName["INI Files"] = "ini.xml";
-    languageNameToXmlFileName["CubeScript"] = "cubescript.xml";
-    languageNameToXmlFileName["MAB-DB"] = "mab.xml";
-    languageNameToXmlFileName["G-Code"] = "gcode.xml";
-    languageNameToXmlFileName["Robot"] = "robot.xml";
-    languageNameToXmlFileName["mergetag text"] = "mergetagtext.xml";
-    languageNameToXmlFileName["4DOS BatchToMemory"] = "4dos.xml";
-    languageNameToXmlFileName["Cisco"] = "cisco.xml";
-    languageNameToXmlFileName["Logcat"] = "logcat.xml";
-    languageNameToXmlFileName["Valgrind Suppression"] = "valgrind-suppression.xml";
-    languageNameToXmlFileName["YAML"] = "yaml.xml";
-    languageNameToXmlFileName["CoffeeScript"] = "coffee.xml";
-    languageNameToXmlFileName["nesC"] = "nesc.xml";
-    languageNameToXmlFileName["POV-Ray"] = "povray.xml";
-    languageNameToXmlFileName["Django HTML Template"] = "djangotemplate.xml";
-    languageNameToXmlFileName["x.org Configuration"] = "xorg.xml";
-    languageNameToXmlFileName["Jsonnet"] = "jsonnet.xml";
-    languageNameToXmlFileName["J"] = "j.xml";
-    languageNameToXmlFileName["CMake"] = "cmake.xml";
-    languageNameToXmlFileName["Pike"] = "pike.xml";
-    languageNameToXmlFileName["Jam"] = "jam.xml";
-    languageNameToXmlFileName["Mason"] = "mason.xml";
-    languageNameToXmlFileName["Fluent"] = "fluent.xml";
-    languageNameToXmlFileName["MapCSS"] = "mapcss.xml";
-    languageNameToXmlFileName["Haxe"] = "haxe.xml";
-    languageNameToXmlFileName["Varnish 4 Configuration Language"] = "varnish4.xml";
-    languageNameToXmlFileName["Dart"] = "dart.xml";
-    languageNameToXmlFileName["ferite"] = "ferite.xml";
-    languageNameToXmlFileName["Julia"] = "julia.xml";
-    languageNameToXmlFileName["ANS-Forth94"] = "ansforth94.xml";
-    languageNameToXmlFileName["Octave"] = "octave.xml";
-    languageNameToXmlFileName["TypeScript React (TSX)"] = "typescript-react.xml";
-    languageNameToXmlFileName["M3U"] = "m3u.xml";
-    languageNameToXmlFileName["Puppet"] = "puppet.xml";
-    languageNameToXmlFileName["Elvish"] = "elvish.xml";
-    languageNameToXmlFileName["AppArmor Security Profile"] = "apparmor.xml";
-    languageNameToXmlFileName["PostScript Printer Description"] = "ppd.xml";
-    languageNameToXmlFileName["Lua"] = "lua.xml";
-    languageNameToXmlFileName["Pango"] = "pango.xml";
-    languageNameToXmlFileName["LDIF"] = "ldif.xml";
-    languageNameToXmlFileName["MEL"] = "mel.xml";
-    languageNameToXmlFileName["SQL (PostgreSQL)"] = "sql-postgresql.xml";
-    languageNameToXmlFileName["MS-DOS Batch"] = "dosbat.xml";
-    languageNameToXmlFileName["Asm6502"] = "asm6502.xml";
-    languageNameToXmlFileName["CGiS"] = "cgis.xml";
-    languageNameToXmlFileName["Mustache/Handlebars (HTML)"] = "mustache.xml";
-    languageNameToXmlFileName["CSV (whitespace)"] = "csv-whitespace.xml";
-    languageNameToXmlFileName["Matlab"] = "matlab.xml";
-    languageNameToXmlFileName["Java Module"] = "java-module.xml";
-    languageNameToXmlFileName["CSS"] = "css.xml";
-    languageNameToXmlFileName["Fortran (Fixed Format)"] = "fortran-fixed.xml";
-    languageNameToXmlFileName["LESSCSS"] = "less.xml";
-    languageNameToXmlFileName["Varnish 3 module spec file"] = "varnishcc.xml";
-    languageNameToXmlFileName["ActionScript 2.0"] = "actionscript.xml";
-    languageNameToXmlFileName["Vera"] = "vera.xml";
-    languageNameToXmlFileName["JavaScript React (JSX)"] = "javascript-react.xml";
-    languageNameToXmlFileName["CSV (pipe)"] = "csv-pipe.xml";
-    languageNameToXmlFileName["Haml"] = "haml.xml";
-    languageNameToXmlFileName["SGML"] = "sgml.xml";
-    languageNameToXmlFileName["Nagios"] = "nagios.xml";
-    languageNameToXmlFileName["CartoCSS MML"] = "carto-css-mml.xml";
-    languageNameToXmlFileName["Smali"] = "smali.xml";
-    languageNameToXmlFileName["Tcsh"] = "tcsh.xml";
-    languageNameToXmlFileName["Objective-C++"] = "objectivecpp.xml";
-    languageNameToXmlFileName["LaTeX"] = "latex.xml";
-    languageNameToXmlFileName["NSIS"] = "nsis.xml";
-    languageNameToXmlFileName["Nemerle"] = "nemerle.xml";
-    languageNameToXmlFileName["RenderMan RIB"] = "rib.xml";
-    languageNameToXmlFileName["Rich Text Format"] = "rtf.xml";
-    languageNameToXmlFileName["Pig"] = "pig.xml";
-    languageNameToXmlFileName["GPRBuild"] = "gpr.xml";
-    languageNameToXmlFileName["Elixir"] = "elixir.xml";
-    languageNameToXmlFileName["TLA+"] = "tlaplus.xml";
-    languageNameToXmlFileName["Viper"] = "viper.xml";
-    languageNameToXmlFileName["Pure"] = "pure.xml";
-    languageNameToXmlFileName["MIB"] = "mib.xml";
-    languageNameToXmlFileName["Hare"] = "hare.xml";
-    languageNameToXmlFileName["Snort/Suricata"] = "snort_suricata.xml";
-    languageNameToXmlFileName["Protobuf"] = "protobuf.xml";
-    languageNameToXmlFileName["Cucumber Gherkin feature"] = "gherkin.xml";
-    languageNameToXmlFileName["AsciiDoc"] = "asciidoc.xml";
-    languageNameToXmlFileName["Ada"] = "ada.xml";
-    languageNameToXmlFileName["XUL"] = "xul.xml";
-    languageNameToXmlFileName["JCL"] = "jcl.xml";
-    languageNameToXmlFileName["fstab"] = "fstab.xml";
-    languageNameToXmlFileName["RSI IDL"] = "rsiidl.xml";
-    languageNameToXmlFileName["Zig"] = "zig.xml";
-    languageNameToXmlFileName["ISO C++"] = "isocpp.xml";
-    languageNameToXmlFileName["JavaScript/PHP"] = "javascript-php.xml";
-    languageNameToXmlFileName["Zonnon"] = "zonnon.xml";
-    languageNameToXmlFileName["Nix"] = "nix.xml";
-    languageNameToXmlFileName["Chicken"] = "chicken.xml";
-    languageNameToXmlFileName["Kconfig"] = "kconfig.xml";
-    languageNameToXmlFileName["CashScript"] = "cashscript.xml";
-    languageNameToXmlFileName["SCSS"] = "scss.xml";
-    languageNameToXmlFileName[".desktop"] = "desktop.xml";
-    languageNameToXmlFileName["reStructuredText"] = "rest.xml";
-    languageNameToXmlFileName["Intel HEX"] = "intelhex.xml";
-    languageNameToXmlFileName["Modula-2"] = "modula-2.xml";
-    languageNameToXmlFileName["GNU Linker Script"] = "ld.xml";
-    languageNameToXmlFileName["Motorola 68k (VASM/Devpac)"] = "asm-m68k.xml";
-    languageNameToXmlFileName["Log File (simplified)"] = "logfile.xml";
-    languageNameToXmlFileName["kdesrc-buildrc"] = "kdesrc-buildrc.xml";
-    languageNameToXmlFileName["txt2tags"] = "txt2tags.xml";
-    languageNameToXmlFileName["Gitolite"] = "gitolite.xml";
-    languageNameToXmlFileName["KBasic"] = "kbasic.xml";
-    languageNameToXmlFileName["WINE Config"] = "winehq.xml";
-    languageNameToXmlFileName["GNU Gettext"] = "gettext.xml";
-    languageNameToXmlFileName["Music Publisher"] = "mup.xml";
-    languageNameToXmlFileName["TSV"] = "tsv.xml";
-    languageNameToXmlFileName["Crystal"] = "crystal.xml";
-    languageNameToXmlFileName["DoxygenLua"] = "doxygenlua.xml";
-    languageNameToXmlFileName["JSON"] = "json.xml";
-    languageNameToXmlFileName["SystemVerilog"] = "systemverilog.xml";
-    languageNameToXmlFileName["Apache Configuration"] = "apache.xml";
-    languageNameToXmlFileName["Inform"] = "inform.xml";
-    languageNameToXmlFileName["Roff"] = "roff.xml";
-    languageNameToXmlFileName["SELinux File Contexts"] = "selinux-fc.xml";
-    languageNameToXmlFileName["Intel x86 (NASM)"] = "nasm.xml";
-    languageNameToXmlFileName["RenPy"] = "renpy.xml";
-    languageNameToXmlFileName["Common Lisp"] = "commonlisp.xml";
-    languageNameToXmlFileName["COBOL"] = "cobol.xml";
-    languageNameToXmlFileName["CSV"] = "csv.xml";
-    languageNameToXmlFileName["Velocity"] = "velocity.xml";
-    languageNameToXmlFileName["Euphoria"] = "euphoria.xml";
-    languageNameToXmlFileName["ANSI C89"] = "ansic89.xml";
-    languageNameToXmlFileName["ColdFusion"] = "coldfusion.xml";
-    languageNameToXmlFileName["TextProto"] = "textproto.xml";
-    languageNameToXmlFileName["Praat"] = "praat.xml";
-    languageNameToXmlFileName["xslt"] = "xslt.xml";
-    languageNameToXmlFileName["Fortran (Free Format)"] = "fortran-free.xml";
-    languageNameToXmlFileName["Email"] = "email.xml";
-    languageNameToXmlFileName["RPM Spec"] = "rpmspec.xml";
-    languageNameToXmlFileName["DTD"] = "dtd.xml";
-    languageNameToXmlFileName["GNU Assembler"] = "gnuassembler.xml";
-    languageNameToXmlFileName["ASN.1"] = "asn1.xml";
-    languageNameToXmlFileName["Typst"] = "typst.xml";
-    languageNameToXmlFileName["PGN"] = "pgn.xml";
-    languageNameToXmlFileName["Hunspell Affix File"] = "hunspell-aff.xml";
-    languageNameToXmlFileName["Spice"] = "spice.xml";
-    languageNameToXmlFileName["q"] = "q.xml";
-    languageNameToXmlFileName["Perl"] = "perl.xml";
-    languageNameToXmlFileName["Klipper G-Code"] = "klipper-gcode.xml";
-    languageNameToXmlFileName["D"] = "d.xml";
-    languageNameToXmlFileName["LSL"] = "lsl.xml";
-    languageNameToXmlFileName["R Markdown"] = "rmarkdown.xml";
-    languageNameToXmlFileName["Doxyfile"] = "doxyfile.xml";
-    languageNameToXmlFileName["Zsh"] = "zsh.xml";
-    languageNameToXmlFileName["V"] = "v.xml";
-    languageNameToXmlFileName["MonoBasic"] = "monobasic.xml";
-    languageNameToXmlFileName["GDB Init"] = "gdbinit.xml";
-    languageNameToXmlFileName["ANTLR"] = "antlr.xml";
-    languageNameToXmlFileName["RapidQ"] = "rapidq.xml";
-    languageNameToXmlFileName["Odin"] = "odin.xml";
-    languageNameToXmlFileName["Wesnoth Markup Language"] = "wml.xml";
-    languageNameToXmlFileName["vCard, vCalendar, iCalendar"] = "vcard.xml";
-    languageNameToXmlFileName["Groovy"] = "groovy.xml";
-    languageNameToXmlFileName["FASTQ"] = "fastq.xml";
-    languageNameToXmlFileName["SASS"] = "sass.xml";
-    languageNameToXmlFileName["TaskJuggler"] = "taskjuggler.xml";
-    languageNameToXmlFileName["Java Properties"] = "java-properties.xml";
-    languageNameToXmlFileName["OORS"] = "oors.xml";
-    languageNameToXmlFileName["Rust"] = "rust.xml";
-    languageNameToXmlFileName["AWK"] = "awk.xml";
-    languageNameToXmlFileName["TypeScript"] = "typescript.xml";
-    languageNameToXmlFileName["Alerts"] = "alert.xml";
-    languageNameToXmlFileName["Fish"] = "fish.xml";
-    languageNameToXmlFileName["C"] = "c.xml";
-    languageNameToXmlFileName["Gnuplot"] = "gnuplot.xml";
-    languageNameToXmlFileName["Dockerfile"] = "dockerfile.xml";
-    languageNameToXmlFileName["YARA"] = "yara.xml";
-    languageNameToXmlFileName["Prolog"] = "prolog.xml";
-    languageNameToXmlFileName["opsi-script"] = "opsiscript.xml";
-    languageNameToXmlFileName["ConTeXt"] = "context.xml";
-    languageNameToXmlFileName["yacas"] = "yacas.xml";
-    languageNameToXmlFileName["Jira"] = "jira.xml";
-    languageNameToXmlFileName["Ansys"] = "ansys.xml";
-    languageNameToXmlFileName["Wavefront OBJ"] = "wavefront-obj.xml";
-    languageNameToXmlFileName["AHDL"] = "ahdl.xml";
-    languageNameToXmlFileName["Doxygen"] = "doxygen.xml";
-    languageNameToXmlFileName["Metapost/Metafont"] = "metafont.xml";
-    languageNameToXmlFileName["E Language"] = "e.xml";
-    languageNameToXmlFileName["SubRip Subtitles"] = "subrip-subtitles.xml";
-    languageNameToXmlFileName["YANG"] = "yang.xml";
-    languageNameToXmlFileName["Modelines"] = "modelines.xml";
-    languageNameToXmlFileName["PowerShell"] = "powershell.xml";
-    languageNameToXmlFileName["Diff"] = "diff.xml";
-    languageNameToXmlFileName["STL"] = "stl.xml";
-    languageNameToXmlFileName["Org Mode"] = "orgmode.xml";
-    languageNameToXmlFileName["TOML"] = "toml.xml";
-    languageNameToXmlFileName["Cabal"] = "cabal.xml";
-    languageNameToXmlFileName["JavaScript"] = "javascript.xml";
-    languageNameToXmlFileName["Hamlet"] = "hamlet.xml";
-    languageNameToXmlFileName["Vala"] = "vala.xml";
-    languageNameToXmlFileName["Ninja"] = "ninja.xml";
-    languageNameToXmlFileName["Mathematica"] = "mathematica.xml";
-    languageNameToXmlFileName["Ruby/Rails/RHTML"] = "rhtml.xml";
-    languageNameToXmlFileName["Bash"] = "bash.xml";
-    languageNameToXmlFileName["FlatBuffers"] = "flatbuffers.xml";
-    languageNameToXmlFileName["PHP (HTML)"] = "html-php.xml";
-    languageNameToXmlFileName["InnoSetup"] = "innosetup.xml";
-    languageNameToXmlFileName["Objective Caml Ocamlyacc"] = "ocamlyacc.xml";
-    languageNameToXmlFileName["Scala"] = "scala.xml";
-    languageNameToXmlFileName["Objective Caml"] = "ocaml.xml";
-    languageNameToXmlFileName["Solidity"] = "solidity.xml";
-    languageNameToXmlFileName["Curry"] = "curry.xml";
-    languageNameToXmlFileName["GAP"] = "gap.xml";
-    languageNameToXmlFileName["Intel x86 (FASM)"] = "fasm.xml";
-    languageNameToXmlFileName["MediaWiki"] = "mediawiki.xml";
-    languageNameToXmlFileName["FTL"] = "ftl.xml";
-    languageNameToXmlFileName["Overpass QL"] = "overpassql.xml";
-    languageNameToXmlFileName["SQL (MySQL)"] = "sql-mysql.xml";
-    languageNameToXmlFileName["TT2"] = "template-toolkit.xml";
-    languageNameToXmlFileName["nginx Configuration"] = "nginx.xml";
-    languageNameToXmlFileName["Godot"] = "gd-script.xml";
-    languageNameToXmlFileName["Swift"] = "swift.xml";
-    languageNameToXmlFileName["Erlang"] = "erlang.xml";
-    languageNameToXmlFileName["Clipper"] = "clipper.xml";
-    languageNameToXmlFileName["Hunspell Thesaurus File"] = "hunspell-dat.xml";
-    languageNameToXmlFileName["GDB"] = "gdb.xml";
-    languageNameToXmlFileName["RELAX NG"] = "relaxng.xml";
-    languageNameToXmlFileName["PureScript"] = "purescript.xml";
-    languageNameToXmlFileName["Magma"] = "magma.xml";
-    languageNameToXmlFileName["CLIST"] = "clist.xml";
-    languageNameToXmlFileName["Asterisk"] = "asterisk.xml";
-    languageNameToXmlFileName["ABC"] = "abc.xml";
-    languageNameToXmlFileName["Makefile"] = "makefile.xml";
-    languageNameToXmlFileName["SELinux Policy"] = "selinux.xml";
-    languageNameToXmlFileName["Wayland Trace"] = "wayland-trace.xml";
-    languageNameToXmlFileName["Scheme"] = "scheme.xml";
-    languageNameToXmlFileName["ChangeLog"] = "changelog.xml";
-    languageNameToXmlFileName["Troff Mandoc"] = "mandoc.xml";
-    languageNameToXmlFileName["Replicode"] = "replicode.xml";
-    languageNameToXmlFileName["QFace"] = "qface.xml";
-    languageNameToXmlFileName["GDB Backtrace"] = "gdb-bt.xml";
-    languageNameToXmlFileName["Debian Control"] = "debiancontrol.xml";
-    languageNameToXmlFileName["Varnish 4 module spec file"] = "varnishcc4.xml";
-    languageNameToXmlFileName["R documentation"] = "rdoc.xml";
-    languageNameToXmlFileName["Go"] = "go.xml";
-    languageNameToXmlFileName["B-Method"] = "bmethod.xml";
-    languageNameToXmlFileName["AutoHotKey"] = "ahk.xml";
-    languageNameToXmlFileName["k"] = "k.xml";
-    languageNameToXmlFileName["CSS/PHP"] = "css-php.xml";
-    languageNameToXmlFileName["Varnish Test Case language"] = "varnishtest.xml";
-    languageNameToXmlFileName["Raku"] = "raku.xml";
-    languageNameToXmlFileName["Quake Script"] = "idconsole.xml";
-    languageNameToXmlFileName["SQL"] = "sql.xml";
-    languageNameToXmlFileName["Clojure"] = "clojure.xml";
-    languageNameToXmlFileName["Texinfo"] = "texinfo.xml";
-    languageNameToXmlFileName["PicAsm"] = "picsrc.xml";
-    languageNameToXmlFileName["PHP/PHP"] = "php.xml";
-    languageNameToXmlFileName["Component-Pascal"] = "component-pascal.xml";
-    languageNameToXmlFileName["Meson"] = "meson.xml";
-    languageNameToXmlFileName["Haskell"] = "haskell.xml";
-    languageNameToXmlFileName["sed"] = "sed.xml";
-    languageNameToXmlFileName["Varnish 4 Test Case language"] = "varnishtest4.xml";
-    languageNameToXmlFileName["Markdown"] = "markdown.xml";
-    languageNameToXmlFileName["Stan"] = "stan.xml";
-    languageNameToXmlFileName["Logtalk"] = "logtalk.xml";
-    languageNameToXmlFileName["Hunspell Dictionary File"] = "hunspell-dic.xml";
-    languageNameToXmlFileName["Common Intermediate Language (CIL)"] = "cil.xml";
-    languageNameToXmlFileName["GraphQL"] = "graphql.xml";
-    languageNameToXmlFileName["4GL-PER"] = "fgl-per.xml";
-    languageNameToXmlFileName["KDev-PG[-Qt] Grammar"] = "grammar.xml";
-    languageNameToXmlFileName["Tcl/Tk"] = "tcl.xml";
-    languageNameToXmlFileName["Twig/Twig"] = "twig.xml";
-    languageNameToXmlFileName["Tiger"] = "tiger.xml";
-    languageNameToXmlFileName["Modula-2 (R10 only)"] = "modula-2-r10-only.xml";
-    languageNameToXmlFileName["Todo.txt"] = "todo.xml";
-    languageNameToXmlFileName["Varnish Configuration Language"] = "varnish.xml";
-    languageNameToXmlFileName["Xonotic Script"] = "xonotic-console.xml";
-    languageNameToXmlFileName["Lex/Flex"] = "lex.xml";
-    languageNameToXmlFileName["Metamath"] = "metamath.xml";
-    languageNameToXmlFileName["Agda"] = "agda.xml";
-    languageNameToXmlFileName["Textile"] = "textile.xml";
-    languageNameToXmlFileName["GlossTex"] = "glosstex.xml";
-    languageNameToXmlFileName["Bitbake"] = "bitbake.xml";
-    languageNameToXmlFileName["Kotlin"] = "kotlin.xml";
-    languageNameToXmlFileName["Crack"] = "crk.xml";
-    languageNameToXmlFileName["Maxima"] = "maxima.xml";
-    languageNameToXmlFileName["SiSU"] = "sisu.xml";
-    languageNameToXmlFileName["VRML"] = "vrml.xml";
-    languageNameToXmlFileName["PureBasic"] = "purebasic.xml";
-    languageNameToXmlFileName["JSP"] = "jsp.xml";
-    languageNameToXmlFileName["Boo"] = "boo.xml";
-    languageNameToXmlFileName["Idris"] = "idris.xml";
-    languageNameToXmlFileName["Verilog"] = "verilog.xml";
-    languageNameToXmlFileName["SELinux CIL Policy"] = "selinux-cil.xml";
-    languageNameToXmlFileName["scilab"] = "sci.xml";
-    languageNameToXmlFileName["Pascal"] = "pascal.xml";
-    languageNameToXmlFileName["RelaxNG-Compact"] = "relaxngcompact.xml";
-    languageNameToXmlFileName["CleanCSS"] = "ccss.xml";
-    languageNameToXmlFileName["MIPS Assembler"] = "mips.xml";
-    languageNameToXmlFileName["CartoCSS"] = "carto-css.xml";
-    languageNameToXmlFileName["PostScript"] = "postscript.xml";
-    languageNameToXmlFileName["Modula-2 (ISO only)"] = "modula-2-iso-only.xml";
-    languageNameToXmlFileName["SML"] = "sml.xml";
-    languageNameToXmlFileName["Python"] = "python.xml";
-    languageNameToXmlFileName["ATS"] = "ats.xml";
-    languageNameToXmlFileName["AMPLE"] = "ample.xml";
-    languageNameToXmlFileName["REXX"] = "rexx.xml";
-    languageNameToXmlFileName["TADS 3"] = "tads3.xml";
-    languageNameToXmlFileName["Modula-2 (PIM only)"] = "modula-2-pim-only.xml";
-    languageNameToXmlFileName["Debian Changelog"] = "debianchangelog.xml";
-    languageNameToXmlFileName["Mako"] = "mako.xml";
-    languageNameToXmlFileName["Log File (advanced)"] = "logfile-advanced.xml";
-    languageNameToXmlFileName["Elm"] = "elm.xml";
-    languageNameToXmlFileName["Racket"] = "racket.xml";
-    languageNameToXmlFileName["VHDL"] = "vhdl.xml";
-    languageNameToXmlFileName["Vue"] = "vue.xml";
-    languageNameToXmlFileName["SPDX-Comments"] = "spdx-comments.xml";
-    languageNameToXmlFileName["Java"] = "java.xml";
-    languageNameToXmlFileName["QDoc Configuration"] = "qdocconf.xml";
-    languageNameToXmlFileName["Literate Curry"] = "literate-curry.xml";
-    languageNameToXmlFileName["BrightScript"] = "brightscript.xml";
-    languageNameToXmlFileName["PLY"] = "ply.xml";
-    languageNameToXmlFileName["LilyPond"] = "lilypond.xml";
-    languageNameToXmlFileName["Adblock Plus"] = "adblock.xml";
-    languageNameToXmlFileName["XML"] = "xml.xml";
-    languageNameToXmlFileName["Ruby"] = "ruby.xml";
-    languageNameToXmlFileName["Pug"] = "pug.xml";
-    languageNameToXmlFileName["Sieve"] = "sieve.xml";
-    languageNameToXmlFileName["Stata"] = "stata.xml";
-    languageNameToXmlFileName["OpenSCAD"] = "openscad.xml";
-    languageNameToXmlFileName["Motorola DSP56k"] = "asm-dsp56k.xml";
-    languageNameToXmlFileName["Modula-3"] = "modula-3.xml";
-    languageNameToXmlFileName["GCCExtensions"] = "gcc.xml";
-    languageNameToXmlFileName["Modelica"] = "modelica.xml";
-    languageNameToXmlFileName["systemd unit"] = "systemd-unit.xml";
-    languageNameToXmlFileName["SystemC"] = "systemc.xml";
-    languageNameToXmlFileName["Comments"] = "comments.xml";
-    languageNameToXmlFileName["Earthfile"] = "earthfile.xml";
-    languageNameToXmlFileName["CSV (semicolon)"] = "csv-semicolon.xml";
-    languageNameToXmlFileName["xHarbour"] = "xharbour.xml";
-    languageNameToXmlFileName["GNU M4"] = "m4.xml";
-    languageNameToXmlFileName["ASP"] = "asp.xml";
-    languageNameToXmlFileName["AVR Assembler"] = "asm-avr.xml";
-    languageNameToXmlFileName["FreeBASIC"] = "freebasic.xml";
-    languageNameToXmlFileName["4GL"] = "fgl-4gl.xml";
-    languageNameToXmlFileName["QML"] = "qml.xml";
-    languageNameToXmlFileName["Fortran"] = "fortran.xml";
-    languageNameToXmlFileName["PL/I"] = "pli.xml";
-    languageNameToXmlFileName["OPAL"] = "opal.xml";
-    languageNameToXmlFileName["Nim"] = "nim.xml";
-    languageNameToXmlFileName["LPC"] = "lpc.xml";
-    languageNameToXmlFileName["progress"] = "progress.xml";
-    languageNameToXmlFileName["Kate Config"] = "kateconfig.xml";
-    languageNameToXmlFileName["Terraform"] = "terraform.xml";
-    languageNameToXmlFileName["C#"] = "cs.xml";
-    languageNameToXmlFileName["Sather"] = "sather.xml";
-    languageNameToXmlFileName["Javadoc"] = "javadoc.xml";
-    languageNameToXmlFileName["TI Basic"] = "tibasic.xml";
-    languageNameToXmlFileName["R Script"] = "r.xml";
-    languageNameToXmlFileName["RETRO"] = "retro.xml";
-    languageNameToXmlFileName["Literate Haskell"] = "literate-haskell.xml";
-    languageNameToXmlFileName["Alerts_indent"] = "alert_indent.xml";
-    languageNameToXmlFileName["CUE Sheet"] = "cue.xml";
-    languageNameToXmlFileName["C++"] = "cpp.xml";
-    languageNameToXmlFileName["XML (Debug)"] = "xmldebug.xml";
-    languageNameToXmlFileName["Eiffel"] = "eiffel.xml";
-    languageNameToXmlFileName["Pony"] = "pony.xml";
-    languageNameToXmlFileName["Git Rebase"] = "git-rebase.xml";
-    languageNameToXmlFileName["Objective Caml Ocamllex"] = "ocamllex.xml";
-    languageNameToXmlFileName["IDL"] = "idl.xml";
-    languageNameToXmlFileName["SQL (Oracle)"] = "sql-oracle.xml";
-    languageNameToXmlFileName["OpenCL"] = "opencl.xml";
-    languageNameToXmlFileName["HTML"] = "html.xml";
-    languageNameToXmlFileName["dot"] = "dot.xml";
-    languageNameToXmlFileName["BibTeX"] = "bibtex.xml";
-    languageNameToXmlFileName["GDL"] = "gdl.xml";
-    languageNameToXmlFileName["Gleam"] = "gleam.xml";
-    languageNameToXmlFileName["Yacc/Bison"] = "yacc.xml";
-    languageNameToXmlFileName["Hunspell Thesaurus Index File"] = "hunspell-idx.xml";
-    languageNameToXmlFileName["Objective-C"] = "objectivec.xml";
-    return languageNameToXmlFileName;
-}
-QMap<QString, QString> languageNameToXmlFileName = create_languageNameToXmlFileName();
+namespace {
+
+constexpr LanguageDbEntry languageNameToXmlFileNameEntries[] = {
+    {".desktop", "desktop.xml"},
+    {"4DOS BatchToMemory", "4dos.xml"},
+    {"4GL", "fgl-4gl.xml"},
+    {"4GL-PER", "fgl-per.xml"},
+    {"ABAP", "abap.xml"},
+    {"ABC", "abc.xml"},
+    {"AHDL", "ahdl.xml"},
+    {"AMPLE", "ample.xml"},
+    {"ANS-Forth94", "ansforth94.xml"},
+    {"ANSI C89", "ansic89.xml"},
+    {"ANTLR", "antlr.xml"},
+    {"ASN.1", "asn1.xml"},
+    {"ASP", "asp.xml"},
+    {"ATS", "ats.xml"},
+    {"AVR Assembler", "asm-avr.xml"},
+    {"AWK", "awk.xml"},
+    {"ActionScript 2.0", "actionscript.xml"},
+    {"Ada", "ada.xml"},
+    {"Adblock Plus", "adblock.xml"},
+    {"Agda", "agda.xml"},
+    {"Alerts", "alert.xml"},
+    {"Alerts_indent", "alert_indent.xml"},
+    {"Ansys", "ansys.xml"},
+    {"Apache Configuration", "apache.xml"},
+    {"AppArmor Security Profile", "apparmor.xml"},
+    {"AsciiDoc", "asciidoc.xml"},
+    {"Asm6502", "asm6502.xml"},
+    {"Asterisk", "asterisk.xml"},
+    {"AutoHotKey", "ahk.xml"},
+    {"B-Method", "bmethod.xml"},
+    {"Bash", "bash.xml"},
+    {"BibTeX", "bibtex.xml"},
+    {"Bitbake", "bitbake.xml"},
+    {"Boo", "boo.xml"},
+    {"BrightScript", "brightscript.xml"},
+    {"C", "c.xml"},
+    {"C#", "cs.xml"},
+    {"C++", "cpp.xml"},
+    {"CGiS", "cgis.xml"},
+    {"CLIST", "clist.xml"},
+    {"CMake", "cmake.xml"},
+    {"COBOL", "cobol.xml"},
+    {"CSS", "css.xml"},
+    {"CSS/PHP", "css-php.xml"},
+    {"CSV", "csv.xml"},
+    {"CSV (pipe)", "csv-pipe.xml"},
+    {"CSV (semicolon)", "csv-semicolon.xml"},
+    {"CSV (whitespace)", "csv-whitespace.xml"},
+    {"CUE Sheet", "cue.xml"},
+    {"Cabal", "cabal.xml"},
+    {"CartoCSS", "carto-css.xml"},
+    {"CartoCSS MML", "carto-css-mml.xml"},
+    {"CashScript", "cashscript.xml"},
+    {"Cg", "cg.xml"},
+    {"ChangeLog", "changelog.xml"},
+    {"Chicken", "chicken.xml"},
+    {"Cisco", "cisco.xml"},
+    {"CleanCSS", "ccss.xml"},
+    {"Clipper", "clipper.xml"},
+    {"Clojure", "clojure.xml"},
+    {"CoffeeScript", "coffee.xml"},
+    {"ColdFusion", "coldfusion.xml"},
+    {"Comments", "comments.xml"},
+    {"Common Intermediate Language (CIL)", "cil.xml"},
+    {"Common Lisp", "commonlisp.xml"},
+    {"Component-Pascal", "component-pascal.xml"},
+    {"ConTeXt", "context.xml"},
+    {"Crack", "crk.xml"},
+    {"Crystal", "crystal.xml"},
+    {"CubeScript", "cubescript.xml"},
+    {"Cucumber Gherkin feature", "gherkin.xml"},
+    {"Curry", "curry.xml"},
+    {"D", "d.xml"},
+    {"DTD", "dtd.xml"},
+    {"Dart", "dart.xml"},
+    {"Debian Changelog", "debianchangelog.xml"},
+    {"Debian Control", "debiancontrol.xml"},
+    {"Diff", "diff.xml"},
+    {"Django HTML Template", "djangotemplate.xml"},
+    {"Dockerfile", "dockerfile.xml"},
+    {"Doxyfile", "doxyfile.xml"},
+    {"Doxygen", "doxygen.xml"},
+    {"DoxygenLua", "doxygenlua.xml"},
+    {"E Language", "e.xml"},
+    {"Earthfile", "earthfile.xml"},
+    {"Eiffel", "eiffel.xml"},
+    {"Elixir", "elixir.xml"},
+    {"Elm", "elm.xml"},
+    {"Elvish", "elvish.xml"},
+    {"Email", "email.xml"},
+    {"Erlang", "erlang.xml"},
+    {"Euphoria", "euphoria.xml"},
+    {"FASTQ", "fastq.xml"},
+    {"FSharp", "fsharp.xml"},
+    {"FTL", "ftl.xml"},
+    {"Fish", "fish.xml"},
+    {"FlatBuffers", "flatbuffers.xml"},
+    {"Fluent", "fluent.xml"},
+    {"Fortran", "fortran.xml"},
+    {"Fortran (Fixed Format)", "fortran-fixed.xml"},
+    {"Fortran (Free Format)", "fortran-free.xml"},
+    {"FreeBASIC", "freebasic.xml"},
+    {"G-Code", "gcode.xml"},
+    {"GAP", "gap.xml"},
+    {"GCCExtensions", "gcc.xml"},
+    {"GDB", "gdb.xml"},
+    {"GDB Backtrace", "gdb-bt.xml"},
+    {"GDB Init", "gdbinit.xml"},
+    {"GDL", "gdl.xml"},
+    {"GLSL", "glsl.xml"},
+    {"GNU Assembler", "gnuassembler.xml"},
+    {"GNU Gettext", "gettext.xml"},
+    {"GNU Linker Script", "ld.xml"},
+    {"GNU M4", "m4.xml"},
+    {"GPRBuild", "gpr.xml"},
+    {"Git Ignore", "git-ignore.xml"},
+    {"Git Rebase", "git-rebase.xml"},
+    {"Gitolite", "gitolite.xml"},
+    {"Gleam", "gleam.xml"},
+    {"GlossTex", "glosstex.xml"},
+    {"Gnuplot", "gnuplot.xml"},
+    {"Go", "go.xml"},
+    {"Godot", "gd-script.xml"},
+    {"GraphQL", "graphql.xml"},
+    {"Groovy", "groovy.xml"},
+    {"HTML", "html.xml"},
+    {"Haml", "haml.xml"},
+    {"Hamlet", "hamlet.xml"},
+    {"Hare", "hare.xml"},
+    {"Haskell", "haskell.xml"},
+    {"Haxe", "haxe.xml"},
+    {"Hunspell Affix File", "hunspell-aff.xml"},
+    {"Hunspell Dictionary File", "hunspell-dic.xml"},
+    {"Hunspell Thesaurus File", "hunspell-dat.xml"},
+    {"Hunspell Thesaurus Index File", "hunspell-idx.xml"},
+    {"IDL", "idl.xml"},
+    {"ILERPG", "ilerpg.xml"},
+    {"INI Files", "ini.xml"},
+    {"ISO C++", "isocpp.xml"},
+    {"Idris", "idris.xml"},
+    {"Inform", "inform.xml"},
+    {"InnoSetup", "innosetup.xml"},
+    {"Intel HEX", "intelhex.xml"},
+    {"Intel x86 (FASM)", "fasm.xml"},
+    {"Intel x86 (NASM)", "nasm.xml"},
+    {"J", "j.xml"},
+    {"JCL", "jcl.xml"},
+    {"JSON", "json.xml"},
+    {"JSP", "jsp.xml"},
+    {"Jam", "jam.xml"},
+    {"Java", "java.xml"},
+    {"Java Module", "java-module.xml"},
+    {"Java Properties", "java-properties.xml"},
+    {"JavaScript", "javascript.xml"},
+    {"JavaScript React (JSX)", "javascript-react.xml"},
+    {"JavaScript/PHP", "javascript-php.xml"},
+    {"Javadoc", "javadoc.xml"},
+    {"Jira", "jira.xml"},
+    {"Jsonnet", "jsonnet.xml"},
+    {"Julia", "julia.xml"},
+    {"KBasic", "kbasic.xml"},
+    {"KDev-PG[-Qt] Grammar", "grammar.xml"},
+    {"Kate Config", "kateconfig.xml"},
+    {"Kconfig", "kconfig.xml"},
+    {"Klipper Config", "klipper-config.xml"},
+    {"Klipper G-Code", "klipper-gcode.xml"},
+    {"Kotlin", "kotlin.xml"},
+    {"LDIF", "ldif.xml"},
+    {"LESSCSS", "less.xml"},
+    {"LLVM", "llvm.xml"},
+    {"LPC", "lpc.xml"},
+    {"LSL", "lsl.xml"},
+    {"LaTeX", "latex.xml"},
+    {"Lex/Flex", "lex.xml"},
+    {"LilyPond", "lilypond.xml"},
+    {"Literate Curry", "literate-curry.xml"},
+    {"Literate Haskell", "literate-haskell.xml"},
+    {"Log File (advanced)", "logfile-advanced.xml"},
+    {"Log File (simplified)", "logfile.xml"},
+    {"Logcat", "logcat.xml"},
+    {"Logtalk", "logtalk.xml"},
+    {"Lua", "lua.xml"},
+    {"M3U", "m3u.xml"},
+    {"MAB-DB", "mab.xml"},
+    {"MEL", "mel.xml"},
+    {"MIB", "mib.xml"},
+    {"MIPS Assembler", "mips.xml"},
+    {"MS-DOS Batch", "dosbat.xml"},
+    {"Magma", "magma.xml"},
+    {"Makefile", "makefile.xml"},
+    {"Mako", "mako.xml"},
+    {"MapCSS", "mapcss.xml"},
+    {"Markdown", "markdown.xml"},
+    {"Mason", "mason.xml"},
+    {"Mathematica", "mathematica.xml"},
+    {"Matlab", "matlab.xml"},
+    {"Maxima", "maxima.xml"},
+    {"MediaWiki", "mediawiki.xml"},
+    {"Meson", "meson.xml"},
+    {"Metamath", "metamath.xml"},
+    {"Metapost/Metafont", "metafont.xml"},
+    {"Modelica", "modelica.xml"},
+    {"Modelines", "modelines.xml"},
+    {"Modula-2", "modula-2.xml"},
+    {"Modula-2 (ISO only)", "modula-2-iso-only.xml"},
+    {"Modula-2 (PIM only)", "modula-2-pim-only.xml"},
+    {"Modula-2 (R10 only)", "modula-2-r10-only.xml"},
+    {"Modula-3", "modula-3.xml"},
+    {"MonoBasic", "monobasic.xml"},
+    {"Motorola 68k (VASM/Devpac)", "asm-m68k.xml"},
+    {"Motorola DSP56k", "asm-dsp56k.xml"},
+    {"Music Publisher", "mup.xml"},
+    {"Mustache/Handlebars (HTML)", "mustache.xml"},
+    {"NSIS", "nsis.xml"},
+    {"Nagios", "nagios.xml"},
+    {"Nemerle", "nemerle.xml"},
+    {"Nim", "nim.xml"},
+    {"Ninja", "ninja.xml"},
+    {"Nix", "nix.xml"},
+    {"OORS", "oors.xml"},
+    {"OPAL", "opal.xml"},
+    {"Objective Caml", "ocaml.xml"},
+    {"Objective Caml Ocamllex", "ocamllex.xml"},
+    {"Objective Caml Ocamlyacc", "ocamlyacc.xml"},
+    {"Objective-C", "objectivec.xml"},
+    {"Objective-C++", "objectivecpp.xml"},
+    {"Octave", "octave.xml"},
+    {"Odin", "odin.xml"},
+    {"OpenCL", "opencl.xml"},
+    {"OpenSCAD", "openscad.xml"},
+    {"Org Mode", "orgmode.xml"},
+    {"Overpass QL", "overpassql.xml"},
+    {"PGN", "pgn.xml"},
+    {"PHP (HTML)", "html-php.xml"},
+    {"PHP/PHP", "php.xml"},
+    {"PL/I", "pli.xml"},
+    {"PLY", "ply.xml"},
+    {"POV-Ray", "povray.xml"},
+    {"Pango", "pango.xml"},
+    {"Pascal", "pascal.xml"},
+    {"Perl", "perl.xml"},
+    {"PicAsm", "picsrc.xml"},
+    {"Pig", "pig.xml"},
+    {"Pike", "pike.xml"},
+    {"Pony", "pony.xml"},
+    {"PostScript", "postscript.xml"},
+    {"PostScript Printer Description", "ppd.xml"},
+    {"PowerShell", "powershell.xml"},
+    {"Praat", "praat.xml"},
+    {"Prolog", "prolog.xml"},
+    {"Protobuf", "protobuf.xml"},
+    {"Pug", "pug.xml"},
+    {"Puppet", "puppet.xml"},
+    {"Pure", "pure.xml"},
+    {"PureBasic", "purebasic.xml"},
+    {"PureScript", "purescript.xml"},
+    {"Python", "python.xml"},
+    {"QDoc Configuration", "qdocconf.xml"},
+    {"QFace", "qface.xml"},
+    {"QML", "qml.xml"},
+    {"QMake", "qmake.xml"},
+    {"Quake Script", "idconsole.xml"},
+    {"R Markdown", "rmarkdown.xml"},
+    {"R Script", "r.xml"},
+    {"R documentation", "rdoc.xml"},
+    {"RELAX NG", "relaxng.xml"},
+    {"RETRO", "retro.xml"},
+    {"REXX", "rexx.xml"},
+    {"RPM Spec", "rpmspec.xml"},
+    {"RSI IDL", "rsiidl.xml"},
+    {"Racket", "racket.xml"},
+    {"Raku", "raku.xml"},
+    {"RapidQ", "rapidq.xml"},
+    {"RelaxNG-Compact", "relaxngcompact.xml"},
+    {"RenPy", "renpy.xml"},
+    {"RenderMan RIB", "rib.xml"},
+    {"Replicode", "replicode.xml"},
+    {"Rich Text Format", "rtf.xml"},
+    {"Robot", "robot.xml"},
+    {"Roff", "roff.xml"},
+    {"Ruby", "ruby.xml"},
+    {"Ruby/Rails/RHTML", "rhtml.xml"},
+    {"Rust", "rust.xml"},
+    {"SASS", "sass.xml"},
+    {"SCSS", "scss.xml"},
+    {"SELinux CIL Policy", "selinux-cil.xml"},
+    {"SELinux File Contexts", "selinux-fc.xml"},
+    {"SELinux Policy", "selinux.xml"},
+    {"SGML", "sgml.xml"},
+    {"SML", "sml.xml"},
+    {"SPDX-Comments", "spdx-comments.xml"},
+    {"SQL", "sql.xml"},
+    {"SQL (MySQL)", "sql-mysql.xml"},
+    {"SQL (Oracle)", "sql-oracle.xml"},
+    {"SQL (PostgreSQL)", "sql-postgresql.xml"},
+    {"STL", "stl.xml"},
+    {"Sather", "sather.xml"},
+    {"Scala", "scala.xml"},
+    {"Scheme", "scheme.xml"},
+    {"SiSU", "sisu.xml"},
+    {"Sieve", "sieve.xml"},
+    {"Smali", "smali.xml"},
+    {"Snort/Suricata", "snort_suricata.xml"},
+    {"Solidity", "solidity.xml"},
+    {"Spice", "spice.xml"},
+    {"Stan", "stan.xml"},
+    {"Stata", "stata.xml"},
+    {"SubRip Subtitles", "subrip-subtitles.xml"},
+    {"Swift", "swift.xml"},
+    {"SystemC", "systemc.xml"},
+    {"SystemVerilog", "systemverilog.xml"},
+    {"TADS 3", "tads3.xml"},
+    {"TI Basic", "tibasic.xml"},
+    {"TLA+", "tlaplus.xml"},
+    {"TOML", "toml.xml"},
+    {"TSV", "tsv.xml"},
+    {"TT2", "template-toolkit.xml"},
+    {"TaskJuggler", "taskjuggler.xml"},
+    {"Tcl/Tk", "tcl.xml"},
+    {"Tcsh", "tcsh.xml"},
+    {"Terraform", "terraform.xml"},
+    {"Texinfo", "texinfo.xml"},
+    {"TextProto", "textproto.xml"},
+    {"Textile", "textile.xml"},
+    {"Tiger", "tiger.xml"},
+    {"Todo.txt", "todo.xml"},
+    {"Troff Mandoc", "mandoc.xml"},
+    {"Twig/Twig", "twig.xml"},
+    {"TypeScript", "typescript.xml"},
+    {"TypeScript React (TSX)", "typescript-react.xml"},
+    {"Typst", "typst.xml"},
+    {"UnrealScript", "uscript.xml"},
+    {"V", "v.xml"},
+    {"VHDL", "vhdl.xml"},
+    {"VRML", "vrml.xml"},
+    {"Vala", "vala.xml"},
+    {"Valgrind Suppression", "valgrind-suppression.xml"},
+    {"Varnish 3 module spec file", "varnishcc.xml"},
+    {"Varnish 4 Configuration Language", "varnish4.xml"},
+    {"Varnish 4 Test Case language", "varnishtest4.xml"},
+    {"Varnish 4 module spec file", "varnishcc4.xml"},
+    {"Varnish Configuration Language", "varnish.xml"},
+    {"Varnish Test Case language", "varnishtest.xml"},
+    {"Velocity", "velocity.xml"},
+    {"Vera", "vera.xml"},
+    {"Verilog", "verilog.xml"},
+    {"Viper", "viper.xml"},
+    {"Vue", "vue.xml"},
+    {"WINE Config", "winehq.xml"},
+    {"Wavefront OBJ", "wavefront-obj.xml"},
+    {"Wayland Trace", "wayland-trace.xml"},
+    {"Wesnoth Markup Language", "wml.xml"},
+    {"XML", "xml.xml"},
+    {"XML (Debug)", "xmldebug.xml"},
+    {"XUL", "xul.xml"},
+    {"Xonotic Script", "xonotic-console.xml"},
+    {"YAML", "yaml.xml"},
+    {"YANG", "yang.xml"},
+    {"YARA", "yara.xml"},
+    {"Yacc/Bison", "yacc.xml"},
+    {"Zig", "zig.xml"},
+    {"Zonnon", "zonnon.xml"},
+    {"Zsh", "zsh.xml"},
+    {"dot", "dot.xml"},
+    {"ferite", "ferite.xml"},
+    {"fstab", "fstab.xml"},
+    {"k", "k.xml"},
+    {"kdesrc-buildrc", "kdesrc-buildrc.xml"},
+    {"mergetag text", "mergetagtext.xml"},
+    {"nesC", "nesc.xml"},
+    {"nginx Configuration", "nginx.xml"},
+    {"noweb", "noweb.xml"},
+    {"opsi-script", "opsiscript.xml"},
+    {"progress", "progress.xml"},
+    {"q", "q.xml"},
+    {"reStructuredText", "rest.xml"},
+    {"scilab", "sci.xml"},
+    {"sed", "sed.xml"},
+    {"systemd unit", "systemd-unit.xml"},
+    {"txt2tags", "txt2tags.xml"},
+    {"vCard, vCalendar, iCalendar", "vcard.xml"},
+    {"x.org Configuration", "xorg.xml"},
+    {"xHarbour", "xharbour.xml"},
+    {"xslt", "xslt.xml"},
+    {"yacas", "yacas.xml"},
+};
+
+constexpr LanguageDbEntry mimeTypeToXmlFileNameEntries[] = {
+    {"application/directory", "ldif.xml"},
+    {"application/javascript", "javascript.xml"},
+    {"application/json", "json.xml"},
+    {"application/jsx", "javascript-react.xml"},
+    {"application/postscript", "postscript.xml"},
+    {"application/rss+xml", "xml.xml"},
+    {"application/rtf", "rtf.xml"},
+    {"application/scxml+xml", "xml.xml"},
+    {"application/sieve", "sieve.xml"},
+    {"application/sla", "stl.xml"},
+    {"application/tsx", "typescript-react.xml"},
+    {"application/typescript", "typescript.xml"},
+    {"application/vnd.coffeescript", "coffee.xml"},
+    {"application/vnd.cups-ppd", "ppd.xml"},
+    {"application/x-coffeescript", "coffee.xml"},
+    {"application/x-crystal", "crystal.xml"},
+    {"application/x-csh", "tcsh.xml"},
+    {"application/x-cue", "cue.xml"},
+    {"application/x-designer", "xml.xml"},
+    {"application/x-desktop", "desktop.xml"},
+    {"application/x-dos", "dosbat.xml"},
+    {"application/x-fish", "fish.xml"},
+    {"application/x-javascript", "javascript.xml"},
+    {"application/x-jsx", "javascript-react.xml"},
+    {"application/x-mup", "mup.xml"},
+    {"application/x-perl", "perl.xml"},
+    {"application/x-php", "html-php.xml"},
+    {"application/x-pig", "pig.xml"},
+    {"application/x-pike", "pike.xml"},
+    {"application/x-puppet", "puppet.xml"},
+    {"application/x-python", "python.xml"},
+    {"application/x-qface", "qface.xml"},
+    {"application/x-qml", "qml.xml"},
+    {"application/x-ruby", "ruby.xml"},
+    {"application/x-shellscript", "zsh.xml"},
+    {"application/x-subrip", "subrip-subtitles.xml"},
+    {"application/x-texinfo", "texinfo.xml"},
+    {"application/x-tsx", "typescript-react.xml"},
+    {"application/x-typescript", "typescript.xml"},
+    {"application/x-xbel", "xml.xml"},
+    {"application/xml", "xml.xml"},
+    {"application/xml-dtd", "dtd.xml"},
+    {"application/xspf+xml", "xml.xml"},
+    {"audio/x-mpegurl", "m3u.xml"},
+    {"audio/x-mup", "mup.xml"},
+    {"audio/x-notes", "mup.xml"},
+    {"image/svg+xml", "xml.xml"},
+    {"message/rfc822", "email.xml"},
+    {"model/vrml", "vrml.xml"},
+    {"text/asciidoc", "asciidoc.xml"},
+    {"text/book", "xml.xml"},
+    {"text/calendar", "vcard.xml"},
+    {"text/cisco", "cisco.xml"},
+    {"text/css", "css.xml"},
+    {"text/csv", "csv.xml"},
+    {"text/daml", "xml.xml"},
+    {"text/gap", "gap.xml"},
+    {"text/html", "vue.xml"},
+    {"text/javascript", "javascript.xml"},
+    {"text/jsx", "javascript-react.xml"},
+    {"text/mfile", "matlab.xml"},
+    {"text/ngc", "gcode.xml"},
+    {"text/octave", "octave.xml"},
+    {"text/rdf", "xml.xml"},
+    {"text/rtf", "rtf.xml"},
+    {"text/rust", "rust.xml"},
+    {"text/sgml", "sgml.xml"},
+    {"text/spice", "spice.xml"},
+    {"text/tsx", "typescript-react.xml"},
+    {"text/txt2tags", "txt2tags.xml"},
+    {"text/typescript", "typescript.xml"},
+    {"text/vcard", "vcard.xml"},
+    {"text/vnd.abc", "abc.xml"},
+    {"text/vnd.git.rebase", "git-rebase.xml"},
+    {"text/vnd.wap.wml", "html-php.xml"},
+    {"text/x-4glerr", "fgl-4gl.xml"},
+    {"text/x-4glper", "fgl-per.xml"},
+    {"text/x-4glpererr", "fgl-per.xml"},
+    {"text/x-4glsrc", "fgl-4gl.xml"},
+    {"text/x-Jambase", "jam.xml"},
+    {"text/x-Jamfile", "jam.xml"},
+    {"text/x-Jamrules", "jam.xml"},
+    {"text/x-PicHdr", "picsrc.xml"},
+    {"text/x-PicSrc", "picsrc.xml"},
+    {"text/x-abap-src", "abap.xml"},
+    {"text/x-actionscript", "actionscript.xml"},
+    {"text/x-adasrc", "gpr.xml"},
+    {"text/x-agda", "agda.xml"},
+    {"text/x-ahdl", "ahdl.xml"},
+    {"text/x-amplesrc", "ample.xml"},
+    {"text/x-asm", "gnuassembler.xml"},
+    {"text/x-asm-avr", "asm-avr.xml"},
+    {"text/x-asm6502", "asm6502.xml"},
+    {"text/x-asp-src", "asp.xml"},
+    {"text/x-awk", "awk.xml"},
+    {"text/x-bib", "bibtex.xml"},
+    {"text/x-bison", "yacc.xml"},
+    {"text/x-boo", "boo.xml"},
+    {"text/x-c++hdr", "cpp.xml"},
+    {"text/x-c++src", "cpp.xml"},
+    {"text/x-c-hdr", "objectivecpp.xml"},
+    {"text/x-cgsrc", "cg.xml"},
+    {"text/x-chdr", "cpp.xml"},
+    {"text/x-clipper-src", "clipper.xml"},
+    {"text/x-clsrc", "opencl.xml"},
+    {"text/x-cmake", "cmake.xml"},
+    {"text/x-coffeescript", "coffee.xml"},
+    {"text/x-coldfusion", "coldfusion.xml"},
+    {"text/x-component-pascal", "component-pascal.xml"},
+    {"text/x-csharp-hde", "cs.xml"},
+    {"text/x-csharp-src", "cs.xml"},
+    {"text/x-csrc", "c.xml"},
+    {"text/x-curry", "curry.xml"},
+    {"text/x-dart", "dart.xml"},
+    {"text/x-dot", "dot.xml"},
+    {"text/x-doxygen", "doxygen.xml"},
+    {"text/x-dsrc", "d.xml"},
+    {"text/x-e-src", "e.xml"},
+    {"text/x-eiffel-src", "eiffel.xml"},
+    {"text/x-elixir", "elixir.xml"},
+    {"text/x-euphoria", "euphoria.xml"},
+    {"text/x-fastq", "fastq.xml"},
+    {"text/x-ferite-src", "ferite.xml"},
+    {"text/x-fluent-translation", "fluent.xml"},
+    {"text/x-fortran-src", "fortran-free.xml"},
+    {"text/x-freebasic", "freebasic.xml"},
+    {"text/x-gdf", "glosstex.xml"},
+    {"text/x-gettext-translation", "gettext.xml"},
+    {"text/x-gherkin", "gherkin.xml"},
+    {"text/x-git-ignore", "git-ignore.xml"},
+    {"text/x-glslsrc", "glsl.xml"},
+    {"text/x-haml", "haml.xml"},
+    {"text/x-haskell", "haskell.xml"},
+    {"text/x-hxsrc", "haxe.xml"},
+    {"text/x-idl-src", "idl.xml"},
+    {"text/x-ilerpg-src", "ilerpg.xml"},
+    {"text/x-inform-src", "inform.xml"},
+    {"text/x-j", "j.xml"},
+    {"text/x-jam", "jam.xml"},
+    {"text/x-java", "java.xml"},
+    {"text/x-javascript", "javascript.xml"},
+    {"text/x-jsrc", "j.xml"},
+    {"text/x-jsx", "javascript-react.xml"},
+    {"text/x-kbasic-src", "kbasic.xml"},
+    {"text/x-lilypond", "lilypond.xml"},
+    {"text/x-logcat", "logcat.xml"},
+    {"text/x-logtalk", "logtalk.xml"},
+    {"text/x-lsl", "lsl.xml"},
+    {"text/x-lua", "lua.xml"},
+    {"text/x-mab", "mab.xml"},
+    {"text/x-magma", "magma.xml"},
+    {"text/x-makefile", "makefile.xml"},
+    {"text/x-meson", "meson.xml"},
+    {"text/x-metapost", "metafont.xml"},
+    {"text/x-mips", "mips.xml"},
+    {"text/x-modula-2", "modula-2.xml"},
+    {"text/x-modula-3", "modula-3.xml"},
+    {"text/x-modula2", "modula-2-pim-only.xml"},
+    {"text/x-mup", "mup.xml"},
+    {"text/x-ncsrc", "nesc.xml"},
+    {"text/x-nemerle", "nemerle.xml"},
+    {"text/x-nim", "nim.xml"},
+    {"text/x-nsis", "nsis.xml"},
+    {"text/x-objc-src", "objectivec.xml"},
+    {"text/x-objcpp-src", "objectivecpp.xml"},
+    {"text/x-ocaml", "ocaml.xml"},
+    {"text/x-openscad-src", "openscad.xml"},
+    {"text/x-pascal", "pascal.xml"},
+    {"text/x-patch", "diff.xml"},
+    {"text/x-perl", "perl.xml"},
+    {"text/x-php3-src", "html-php.xml"},
+    {"text/x-php4-src", "html-php.xml"},
+    {"text/x-pig", "pig.xml"},
+    {"text/x-pike", "pike.xml"},
+    {"text/x-pli", "pli.xml"},
+    {"text/x-pony", "pony.xml"},
+    {"text/x-povray-include", "povray.xml"},
+    {"text/x-povray-script", "povray.xml"},
+    {"text/x-prolog", "prolog.xml"},
+    {"text/x-protobuf", "protobuf.xml"},
+    {"text/x-purebasic", "purebasic.xml"},
+    {"text/x-python", "python.xml"},
+    {"text/x-python3", "python.xml"},
+    {"text/x-qface", "qface.xml"},
+    {"text/x-qml", "qml.xml"},
+    {"text/x-r-markdown", "rmarkdown.xml"},
+    {"text/x-renpy", "renpy.xml"},
+    {"text/x-rpm-spec", "rpmspec.xml"},
+    {"text/x-rsiidl-src", "rsiidl.xml"},
+    {"text/x-rst", "rest.xml"},
+    {"text/x-sather-src", "sather.xml"},
+    {"text/x-scala", "scala.xml"},
+    {"text/x-scheme", "scheme.xml"},
+    {"text/x-sci", "sci.xml"},
+    {"text/x-sed", "sed.xml"},
+    {"text/x-smali", "smali.xml"},
+    {"text/x-sql", "sql-postgresql.xml"},
+    {"text/x-systemd-unit", "systemd-unit.xml"},
+    {"text/x-systemverilog-src", "systemverilog.xml"},
+    {"text/x-tcl", "tcl.xml"},
+    {"text/x-terraform", "terraform.xml"},
+    {"text/x-tex", "latex.xml"},
+    {"text/x-tlaplus", "tlaplus.xml"},
+    {"text/x-toml", "toml.xml"},
+    {"text/x-tsx", "typescript-react.xml"},
+    {"text/x-twig", "twig.xml"},
+    {"text/x-typescript", "typescript.xml"},
+    {"text/x-uscript", "uscript.xml"},
+    {"text/x-vala", "vala.xml"},
+    {"text/x-velocity-src", "velocity.xml"},
+    {"text/x-vera-src", "vera.xml"},
+    {"text/x-verilog-src", "verilog.xml"},
+    {"text/x-vhdl", "vhdl.xml"},
+    {"text/x-vlang", "v.xml"},
+    {"text/x-vm-src", "velocity.xml"},
+    {"text/x-vpr", "viper.xml"},
+    {"text/x-xharbour-src", "xharbour.xml"},
+    {"text/x-yacassrc", "yacas.xml"},
+    {"text/x-yacc", "yacc.xml"},
+    {"text/x-zig", "zig.xml"},
+    {"text/x-zonnon", "zonnon.xml"},
+    {"text/xml", "xml.xml"},
+    {"text/xul", "xul.xml"},
+    {"text/yaml", "yaml.xml"},
+};
+
+constexpr LanguageDbEntry xmlFileNameToIndenterEntries[] = {
+    {"ada.xml", "ada"},
+    {"ahk.xml", "cstyle"},
+    {"ansic89.xml", "cstyle"},
+    {"awk.xml", "cstyle"},
+    {"c.xml", "cstyle"},
+    {"cashscript.xml", "cstyle"},
+    {"chicken.xml", "lisp"},
+    {"coffee.xml", "python"},
+    {"commonlisp.xml", "lisp"},
+    {"cpp.xml", "cstyle"},
+    {"crystal.xml", "ruby"},
+    {"css-php.xml", "cstyle"},
+    {"css.xml", "cstyle"},
+    {"cubescript.xml", "normal"},
+    {"curry.xml", "haskell"},
+    {"dart.xml", "cstyle"},
+    {"elixir.xml", "elixir"},
+    {"flatbuffers.xml", "cstyle"},
+    {"gd-script.xml", "python"},
+    {"gherkin.xml", "normal"},
+    {"gleam.xml", "cstyle"},
+    {"go.xml", "cstyle"},
+    {"gpr.xml", "ada"},
+    {"hamlet.xml", "haskell"},
+    {"hare.xml", "cstyle"},
+    {"haskell.xml", "haskell"},
+    {"isocpp.xml", "cstyle"},
+    {"j.xml", "normal"},
+    {"javascript-php.xml", "cstyle"},
+    {"javascript-react.xml", "cstyle"},
+    {"javascript.xml", "cstyle"},
+    {"kotlin.xml", "cstyle"},
+    {"lilypond.xml", "lilypond"},
+    {"literate-curry.xml", "haskell"},
+    {"lua.xml", "lua"},
+    {"magma.xml", "cstyle"},
+    {"markdown.xml", "markdown"},
+    {"mathematica.xml", "cstyle"},
+    {"nginx.xml", "cstyle"},
+    {"nim.xml", "python"},
+    {"odin.xml", "cstyle"},
+    {"opencl.xml", "cstyle"},
+    {"pascal.xml", "pascal"},
+    {"php.xml", "cstyle"},
+    {"pli.xml", "pli"},
+    {"pony.xml", "ruby"},
+    {"puppet.xml", "cstyle"},
+    {"purescript.xml", "haskell"},
+    {"qface.xml", "cstyle"},
+    {"qml.xml", "cstyle"},
+    {"renpy.xml", "python"},
+    {"robot.xml", "python"},
+    {"ruby.xml", "ruby"},
+    {"sass.xml", "cstyle"},
+    {"scheme.xml", "scheme"},
+    {"scss.xml", "cstyle"},
+    {"solidity.xml", "cstyle"},
+    {"stan.xml", "cstyle"},
+    {"swift.xml", "cstyle"},
+    {"tads3.xml", "cstyle"},
+    {"terraform.xml", "normal"},
+    {"typescript-react.xml", "cstyle"},
+    {"typescript.xml", "cstyle"},
+    {"v.xml", "cstyle"},
+    {"vala.xml", "cstyle"},
+    {"viper.xml", "cstyle"},
+    {"yara.xml", "cstyle"},
+    {"zig.xml", "cstyle"},
+};
+
+constexpr LanguageDbEntry xmlFileNameToLanguageNamesEntries[] = {
+    {"4dos.xml", "4DOS BatchToMemory"},
+    {"abap.xml", "ABAP"},
+    {"abc.xml", "ABC"},
+    {"actionscript.xml", "ActionScript 2.0"},
+    {"ada.xml", "Ada"},
+    {"adblock.xml", "Adblock Plus"},
+    {"agda.xml", "Agda"},
+    {"ahdl.xml", "AHDL"},
+    {"ahk.xml", "AutoHotKey"},
+    {"alert.xml", "Alerts"},
+    {"alert_indent.xml", "Alerts_indent"},
+    {"ample.xml", "AMPLE"},
+    {"ansforth94.xml", "ANS-Forth94"},
+    {"ansic89.xml", "ANSI C89"},
+    {"ansys.xml", "Ansys"},
+    {"antlr.xml", "ANTLR"},
+    {"apache.xml", "Apache Configuration"},
+    {"apparmor.xml", "AppArmor Security Profile"},
+    {"asciidoc.xml", "AsciiDoc"},
+    {"asm-avr.xml", "AVR Assembler"},
+    {"asm-dsp56k.xml", "Motorola DSP56k"},
+    {"asm-m68k.xml", "Motorola 68k (VASM/Devpac)"},
+    {"asm6502.xml", "Asm6502"},
+    {"asn1.xml", "ASN.1"},
+    {"asp.xml", "ASP"},
+    {"asterisk.xml", "Asterisk"},
+    {"ats.xml", "ATS"},
+    {"awk.xml", "AWK"},
+    {"bash.xml", "Bash"},
+    {"bibtex.xml", "BibTeX"},
+    {"bitbake.xml", "Bitbake"},
+    {"bmethod.xml", "B-Method"},
+    {"boo.xml", "Boo"},
+    {"brightscript.xml", "BrightScript"},
+    {"c.xml", "C"},
+    {"cabal.xml", "Cabal"},
+    {"carto-css-mml.xml", "CartoCSS MML"},
+    {"carto-css.xml", "CartoCSS"},
+    {"cashscript.xml", "CashScript"},
+    {"ccss.xml", "CleanCSS"},
+    {"cg.xml", "Cg"},
+    {"cgis.xml", "CGiS"},
+    {"changelog.xml", "ChangeLog"},
+    {"chicken.xml", "Chicken"},
+    {"cil.xml", "Common Intermediate Language (CIL)"},
+    {"cisco.xml", "Cisco"},
+    {"clipper.xml", "Clipper"},
+    {"clist.xml", "CLIST"},
+    {"clojure.xml", "Clojure"},
+    {"cmake.xml", "CMake"},
+    {"cobol.xml", "COBOL"},
+    {"coffee.xml", "CoffeeScript"},
+    {"coldfusion.xml", "ColdFusion"},
+    {"comments.xml", "Comments"},
+    {"commonlisp.xml", "Common Lisp"},
+    {"component-pascal.xml", "Component-Pascal"},
+    {"context.xml", "ConTeXt"},
+    {"cpp.xml", "C++"},
+    {"crk.xml", "Crack"},
+    {"crystal.xml", "Crystal"},
+    {"cs.xml", "C#"},
+    {"css-php.xml", "CSS/PHP"},
+    {"css.xml", "CSS"},
+    {"csv-pipe.xml", "CSV (pipe)"},
+    {"csv-semicolon.xml", "CSV (semicolon)"},
+    {"csv-whitespace.xml", "CSV (whitespace)"},
+    {"csv.xml", "CSV"},
+    {"cubescript.xml", "CubeScript"},
+    {"cue.xml", "CUE Sheet"},
+    {"curry.xml", "Curry"},
+    {"d.xml", "D"},
+    {"dart.xml", "Dart"},
+    {"debianchangelog.xml", "Debian Changelog"},
+    {"debiancontrol.xml", "Debian Control"},
+    {"desktop.xml", ".desktop"},
+    {"diff.xml", "Diff"},
+    {"djangotemplate.xml", "Django HTML Template"},
+    {"dockerfile.xml", "Dockerfile"},
+    {"dosbat.xml", "MS-DOS Batch"},
+    {"dot.xml", "dot"},
+    {"doxyfile.xml", "Doxyfile"},
+    {"doxygen.xml", "Doxygen"},
+    {"doxygenlua.xml", "DoxygenLua"},
+    {"dtd.xml", "DTD"},
+    {"e.xml", "E Language"},
+    {"earthfile.xml", "Earthfile"},
+    {"eiffel.xml", "Eiffel"},
+    {"elixir.xml", "Elixir"},
+    {"elm.xml", "Elm"},
+    {"elvish.xml", "Elvish"},
+    {"email.xml", "Email"},
+    {"erlang.xml", "Erlang"},
+    {"euphoria.xml", "Euphoria"},
+    {"fasm.xml", "Intel x86 (FASM)"},
+    {"fastq.xml", "FASTQ"},
+    {"ferite.xml", "ferite"},
+    {"fgl-4gl.xml", "4GL"},
+    {"fgl-per.xml", "4GL-PER"},
+    {"fish.xml", "Fish"},
+    {"flatbuffers.xml", "FlatBuffers"},
+    {"fluent.xml", "Fluent"},
+    {"fortran-fixed.xml", "Fortran (Fixed Format)"},
+    {"fortran-free.xml", "Fortran (Free Format)"},
+    {"fortran.xml", "Fortran"},
+    {"freebasic.xml", "FreeBASIC"},
+    {"fsharp.xml", "FSharp"},
+    {"fstab.xml", "fstab"},
+    {"ftl.xml", "FTL"},
+    {"gap.xml", "GAP"},
+    {"gcc.xml", "GCCExtensions"},
+    {"gcode.xml", "G-Code"},
+    {"gd-script.xml", "Godot"},
+    {"gdb-bt.xml", "GDB Backtrace"},
+    {"gdb.xml", "GDB"},
+    {"gdbinit.xml", "GDB Init"},
+    {"gdl.xml", "GDL"},
+    {"gettext.xml", "GNU Gettext"},
+    {"gherkin.xml", "Cucumber Gherkin feature"},
+    {"git-ignore.xml", "Git Ignore"},
+    {"git-rebase.xml", "Git Rebase"},
+    {"gitolite.xml", "Gitolite"},
+    {"gleam.xml", "Gleam"},
+    {"glosstex.xml", "GlossTex"},
+    {"glsl.xml", "GLSL"},
+    {"gnuassembler.xml", "GNU Assembler"},
+    {"gnuplot.xml", "Gnuplot"},
+    {"go.xml", "Go"},
+    {"gpr.xml", "GPRBuild"},
+    {"grammar.xml", "KDev-PG[-Qt] Grammar"},
+    {"graphql.xml", "GraphQL"},
+    {"groovy.xml", "Groovy"},
+    {"haml.xml", "Haml"},
+    {"hamlet.xml", "Hamlet"},
+    {"hare.xml", "Hare"},
+    {"haskell.xml", "Haskell"},
+    {"haxe.xml", "Haxe"},
+    {"html-php.xml", "PHP (HTML)"},
+    {"html.xml", "HTML"},
+    {"hunspell-aff.xml", "Hunspell Affix File"},
+    {"hunspell-dat.xml", "Hunspell Thesaurus File"},
+    {"hunspell-dic.xml", "Hunspell Dictionary File"},
+    {"hunspell-idx.xml", "Hunspell Thesaurus Index File"},
+    {"idconsole.xml", "Quake Script"},
+    {"idl.xml", "IDL"},
+    {"idris.xml", "Idris"},
+    {"ilerpg.xml", "ILERPG"},
+    {"inform.xml", "Inform"},
+    {"ini.xml", "INI Files"},
+    {"innosetup.xml", "InnoSetup"},
+    {"intelhex.xml", "Intel HEX"},
+    {"isocpp.xml", "ISO C++"},
+    {"j.xml", "J"},
+    {"jam.xml", "Jam"},
+    {"java-module.xml", "Java Module"},
+    {"java-properties.xml", "Java Properties"},
+    {"java.xml", "Java"},
+    {"javadoc.xml", "Javadoc"},
+    {"javascript-php.xml", "JavaScript/PHP"},
+    {"javascript-react.xml", "JavaScript React (JSX)"},
+    {"javascript.xml", "JavaScript"},
+    {"jcl.xml", "JCL"},
+    {"jira.xml", "Jira"},
+    {"json.xml", "JSON"},
+    {"jsonnet.xml", "Jsonnet"},
+    {"jsp.xml", "JSP"},
+    {"julia.xml", "Julia"},
+    {"k.xml", "k"},
+    {"kateconfig.xml", "Kate Config"},
+    {"kbasic.xml", "KBasic"},
+    {"kconfig.xml", "Kconfig"},
+    {"kdesrc-buildrc.xml", "kdesrc-buildrc"},
+    {"klipper-config.xml", "Klipper Config"},
+    {"klipper-gcode.xml", "Klipper G-Code"},
+    {"kotlin.xml", "Kotlin"},
+    {"latex.xml", "LaTeX"},
+    {"ld.xml", "GNU Linker Script"},
+    {"ldif.xml", "LDIF"},
+    {"less.xml", "LESSCSS"},
+    {"lex.xml", "Lex/Flex"},
+    {"lilypond.xml", "LilyPond"},
+    {"literate-curry.xml", "Literate Curry"},
+    {"literate-haskell.xml", "Literate Haskell"},
+    {"llvm.xml", "LLVM"},
+    {"logcat.xml", "Logcat"},
+    {"logfile-advanced.xml", "Log File (advanced)"},
+    {"logfile.xml", "Log File (simplified)"},
+    {"logtalk.xml", "Logtalk"},
+    {"lpc.xml", "LPC"},
+    {"lsl.xml", "LSL"},
+    {"lua.xml", "Lua"},
+    {"m3u.xml", "M3U"},
+    {"m4.xml", "GNU M4"},
+    {"mab.xml", "MAB-DB"},
+    {"magma.xml", "Magma"},
+    {"makefile.xml", "Makefile"},
+    {"mako.xml", "Mako"},
+    {"mandoc.xml", "Troff Mandoc"},
+    {"mapcss.xml", "MapCSS"},
+    {"markdown.xml", "Markdown"},
+    {"mason.xml", "Mason"},
+    {"mathematica.xml", "Mathematica"},
+    {"matlab.xml", "Matlab"},
+    {"maxima.xml", "Maxima"},
+    {"mediawiki.xml", "MediaWiki"},
+    {"mel.xml", "MEL"},
+    {"mergetagtext.xml", "mergetag text"},
+    {"meson.xml", "Meson"},
+    {"metafont.xml", "Metapost/Metafont"},
+    {"metamath.xml", "Metamath"},
+    {"mib.xml", "MIB"},
+    {"mips.xml", "MIPS Assembler"},
+    {"modelica.xml", "Modelica"},
+    {"modelines.xml", "Modelines"},
+    {"modula-2-iso-only.xml", "Modula-2 (ISO only)"},
+    {"modula-2-pim-only.xml", "Modula-2 (PIM only)"},
+    {"modula-2-r10-only.xml", "Modula-2 (R10 only)"},
+    {"modula-2.xml", "Modula-2"},
+    {"modula-3.xml", "Modula-3"},
+    {"monobasic.xml", "MonoBasic"},
+    {"mup.xml", "Music Publisher"},
+    {"mustache.xml", "Mustache/Handlebars (HTML)"},
+    {"nagios.xml", "Nagios"},
+    {"nasm.xml", "Intel x86 (NASM)"},
+    {"nemerle.xml", "Nemerle"},
+    {"nesc.xml", "nesC"},
+    {"nginx.xml", "nginx Configuration"},
+    {"nim.xml", "Nim"},
+    {"ninja.xml", "Ninja"},
+    {"nix.xml", "Nix"},
+    {"noweb.xml", "noweb"},
+    {"nsis.xml", "NSIS"},
+    {"objectivec.xml", "Objective-C"},
+    {"objectivecpp.xml", "Objective-C++"},
+    {"ocaml.xml", "Objective Caml"},
+    {"ocamllex.xml", "Objective Caml Ocamllex"},
+    {"ocamlyacc.xml", "Objective Caml Ocamlyacc"},
+    {"octave.xml", "Octave"},
+    {"odin.xml", "Odin"},
+    {"oors.xml", "OORS"},
+    {"opal.xml", "OPAL"},
+    {"opencl.xml", "OpenCL"},
+    {"openscad.xml", "OpenSCAD"},
+    {"opsiscript.xml", "opsi-script"},
+    {"orgmode.xml", "Org Mode"},
+    {"overpassql.xml", "Overpass QL"},
+    {"pango.xml", "Pango"},
+    {"pascal.xml", "Pascal"},
+    {"perl.xml", "Perl"},
+    {"pgn.xml", "PGN"},
+    {"php.xml", "PHP/PHP"},
+    {"picsrc.xml", "PicAsm"},
+    {"pig.xml", "Pig"},
+    {"pike.xml", "Pike"},
+    {"pli.xml", "PL/I"},
+    {"ply.xml", "PLY"},
+    {"pony.xml", "Pony"},
+    {"postscript.xml", "PostScript"},
+    {"povray.xml", "POV-Ray"},
+    {"powershell.xml", "PowerShell"},
+    {"ppd.xml", "PostScript Printer Description"},
+    {"praat.xml", "Praat"},
+    {"progress.xml", "progress"},
+    {"prolog.xml", "Prolog"},
+    {"protobuf.xml", "Protobuf"},
+    {"pug.xml", "Pug"},
+    {"puppet.xml", "Puppet"},
+    {"pure.xml", "Pure"},
+    {"purebasic.xml", "PureBasic"},
+    {"purescript.xml", "PureScript"},
+    {"python.xml", "Python"},
+    {"q.xml", "q"},
+    {"qdocconf.xml", "QDoc Configuration"},
+    {"qface.xml", "QFace"},
+    {"qmake.xml", "QMake"},
+    {"qml.xml", "QML"},
+    {"r.xml", "R Script"},
+    {"racket.xml", "Racket"},
+    {"raku.xml", "Raku"},
+    {"rapidq.xml", "RapidQ"},
+    {"rdoc.xml", "R documentation"},
+    {"relaxng.xml", "RELAX NG"},
+    {"relaxngcompact.xml", "RelaxNG-Compact"},
+    {"renpy.xml", "RenPy"},
+    {"replicode.xml", "Replicode"},
+    {"rest.xml", "reStructuredText"},
+    {"retro.xml", "RETRO"},
+    {"rexx.xml", "REXX"},
+    {"rhtml.xml", "Ruby/Rails/RHTML"},
+    {"rib.xml", "RenderMan RIB"},
+    {"rmarkdown.xml", "R Markdown"},
+    {"robot.xml", "Robot"},
+    {"roff.xml", "Roff"},
+    {"rpmspec.xml", "RPM Spec"},
+    {"rsiidl.xml", "RSI IDL"},
+    {"rtf.xml", "Rich Text Format"},
+    {"ruby.xml", "Ruby"},
+    {"rust.xml", "Rust"},
+    {"sass.xml", "SASS"},
+    {"sather.xml", "Sather"},
+    {"scala.xml", "Scala"},
+    {"scheme.xml", "Scheme"},
+    {"sci.xml", "scilab"},
+    {"scss.xml", "SCSS"},
+    {"sed.xml", "sed"},
+    {"selinux-cil.xml", "SELinux CIL Policy"},
+    {"selinux-fc.xml", "SELinux File Contexts"},
+    {"selinux.xml", "SELinux Policy"},
+    {"sgml.xml", "SGML"},
+    {"sieve.xml", "Sieve"},
+    {"sisu.xml", "SiSU"},
+    {"smali.xml", "Smali"},
+    {"sml.xml", "SML"},
+    {"snort_suricata.xml", "Snort/Suricata"},
+    {"solidity.xml", "Solidity"},
+    {"spdx-comments.xml", "SPDX-Comments"},
+    {"spice.xml", "Spice"},
+    {"sql-mysql.xml", "SQL (MySQL)"},
+    {"sql-oracle.xml", "SQL (Oracle)"},
+    {"sql-postgresql.xml", "SQL (PostgreSQL)"},
+    {"sql.xml", "SQL"},
+    {"stan.xml", "Stan"},
+    {"stata.xml", "Stata"},
+    {"stl.xml", "STL"},
+    {"subrip-subtitles.xml", "SubRip Subtitles"},
+    {"swift.xml", "Swift"},
+    {"systemc.xml", "SystemC"},
+    {"systemd-unit.xml", "systemd unit"},
+    {"systemverilog.xml", "SystemVerilog"},
+    {"tads3.xml", "TADS 3"},
+    {"taskjuggler.xml", "TaskJuggler"},
+    {"tcl.xml", "Tcl/Tk"},
+    {"tcsh.xml", "Tcsh"},
+    {"template-toolkit.xml", "TT2"},
+    {"terraform.xml", "Terraform"},
+    {"texinfo.xml", "Texinfo"},
+    {"textile.xml", "Textile"},
+    {"textproto.xml", "TextProto"},
+    {"tibasic.xml", "TI Basic"},
+    {"tiger.xml", "Tiger"},
+    {"tlaplus.xml", "TLA+"},
+    {"todo.xml", "Todo.txt"},
+    {"toml.xml", "TOML"},
+    {"tsv.xml", "TSV"},
+    {"twig.xml", "Twig/Twig"},
+    {"txt2tags.xml", "txt2tags"},
+    {"typescript-react.xml", "TypeScript React (TSX)"},
+    {"typescript.xml", "TypeScript"},
+    {"typst.xml", "Typst"},
+    {"uscript.xml", "UnrealScript"},
+    {"v.xml", "V"},
+    {"vala.xml", "Vala"},
+    {"valgrind-suppression.xml", "Valgrind Suppression"},
+    {"varnish.xml", "Varnish Configuration Language"},
+    {"varnish4.xml", "Varnish 4 Configuration Language"},
+    {"varnishcc.xml", "Varnish 3 module spec file"},
+    {"varnishcc4.xml", "Varnish 4 module spec file"},
+    {"varnishtest.xml", "Varnish Test Case language"},
+    {"varnishtest4.xml", "Varnish 4 Test Case language"},
+    {"vcard.xml", "vCard, vCalendar, iCalendar"},
+    {"velocity.xml", "Velocity"},
+    {"vera.xml", "Vera"},
+    {"verilog.xml", "Verilog"},
+    {"vhdl.xml", "VHDL"},
+    {"viper.xml", "Viper"},
+    {"vrml.xml", "VRML"},
+    {"vue.xml", "Vue"},
+    {"wavefront-obj.xml", "Wavefront OBJ"},
+    {"wayland-trace.xml", "Wayland Trace"},
+    {"winehq.xml", "WINE Config"},
+    {"wml.xml", "Wesnoth Markup Language"},
+    {"xharbour.xml", "xHarbour"},
+    {"xml.xml", "XML"},
+    {"xmldebug.xml", "XML (Debug)"},
+    {"xonotic-console.xml", "Xonotic Script"},
+    {"xorg.xml", "x.org Configuration"},
+    {"xslt.xml", "xslt"},
+    {"xul.xml", "XUL"},
+    {"yacas.xml", "yacas"},
+    {"yacc.xml", "Yacc/Bison"},
+    {"yaml.xml", "YAML"},
+    {"yang.xml", "YANG"},
+    {"yara.xml", "YARA"},
+    {"zig.xml", "Zig"},
+    {"zonnon.xml", "Zonnon"},
+    {"zsh.xml", "Zsh"},
+};
+
+constexpr LanguageDbGlob fileNameSuffixGlobsEntries[] = {
+    {"++c.", "cpp.xml", 127},
+    {"++h.", "cpp.xml", 266},
+    {"++y.", "yacc.xml", 653},
+    {"09f.", "fortran-free.xml", 36},
+    {"1.", "mandoc.xml", 6},
+    {"1nsa.", "asn1.xml", 104},
+    {"1sp.", "powershell.xml", 478},
+    {"2.", "mandoc.xml", 8},
+    {"3.", "mandoc.xml", 9},
+    {"30f.", "fortran-free.xml", 34},
+    {"3i.", "modula-3.xml", 292},
+    {"3m.", "modula-3.xml", 366},
+    {"3php.", "html-php.xml", 445},
+    {"4.", "mandoc.xml", 11},
+    {"4g.", "antlr.xml", 243},
+    {"4m.", "m4.xml", 368},
+    {"5.", "mandoc.xml", 16},
+    {"59f.", "fortran-free.xml", 37},
+    {"6.", "mandoc.xml", 17},
+    {"6dop.", "raku.xml", 459},
+    {"6lp.", "raku.xml", 65},
+    {"6mp.", "raku.xml", 457},
+    {"6p.", "raku.xml", 431},
+    {"7.", "mandoc.xml", 18},
+    {"8.", "mandoc.xml", 19},
+    {"80f.", "fortran-free.xml", 35},
+    {"a.", "ada.xml", 83},
+    {"ada.", "ada.xml", 87},
+    {"adga.", "agda.xml", 92},
+    {"ah.", "hare.xml", 268},
+    {"ajnin.", "ninja.xml", 416},
+    {"alacs.", "scala.xml", 530},
+    {"alav.", "vala.xml", 616},
+    {"alt.", "tlaplus.xml", 603},
+    {"aray.", "yara.xml", 657},
+    {"arij.", "jira.xml", 320},
+    {"as.", "sather.xml", 525},
+    {"atacirus.", "snort_suricata.xml", 573},
+    {"atem.", "chicken.xml", 383},
+    {"aul.", "lua.xml", 362},
+    {"avaj.", "java.xml", 318},
+    {"avaj.ofni-eludom", "java-module.xml", 713},
+    {"bam.", "mab.xml", 57},
+    {"bat.", "tsv.xml", 581},
+    {"batm", "fstab.xml", 714},
+    {"batsf", "fstab.xml", 699},
+    {"bb.", "bitbake.xml", 114},
+    {"bcs.", "cobol.xml", 531},
+    {"bda.", "ada.xml", 88},
+    {"bdg.", "gdb.xml", 246},
+    {"bfi.", "vcard.xml", 302},
+    {"bib.", "bibtex.xml", 120},
+    {"bim.", "mib.xml", 387},
+    {"bir.", "rib.xml", 509},
+    {"bn.", "mathematica.xml", 409},
+    {"boc.", "cobol.xml", 154},
+    {"bp.", "purebasic.xml", 434},
+    {"bptxet.", "textproto.xml", 593},
+    {"bqr.", "rapidq.xml", 517},
+    {"bqs.", "cobol.xml", 559},
+    {"br.", "ruby.xml", 500},
+    {"bre.lmth.", "rhtml.xml", 284},
+    {"bre.lmx.", "ruby.xml", 646},
+    {"bre.sj.", "ruby.xml", 324},
+    {"bv.", "monobasic.xml", 617},
+    {"c.", "cpp.xml", 25},
+    {"cam.", "maxima.xml", 58},
+    {"camt.", "mandoc.xml", 604},
+    {"car.lmth.", "mustache.xml", 287},
+    {"cba.", "abc.xml", 21},
+    {"cc.", "cpp.xml", 132},
+    {"cch.", "cpp.xml", 274},
+    {"ccv.", "varnishcc4.xml", 621},
+    {"ceps.", "rpmspec.xml", 557},
+    {"cepsmeg.", "ruby.xml", 250},
+    {"cf.", "selinux-fc.xml", 225},
+    {"cfc.", "coldfusion.xml", 134},
+    {"cgfck.", "ini.xml", 335},
+    {"cgn.", "gcode.xml", 411},
+    {"cid.", "hunspell-dic.xml", 191},
+    {"cip.", "picsrc.xml", 63},
+    {"cisabk.", "kbasic.xml", 333},
+    {"cjlc.", "clojure.xml", 149},
+    {"cn.", "nesc.xml", 410},
+    {"cni.", "asm-dsp56k.xml", 51},
+    {"cniispo.", "opsiscript.xml", 426},
+    {"cnr.", "relaxngcompact.xml", 513},
+    {"coda.", "asciidoc.xml", 89},
+    {"codiicsa.", "asciidoc.xml", 100},
+    {"codukar.", "raku.xml", 497},
+    {"com.", "cpp.xml", 397},
+    {"corp.", "praat.xml", 472},
+    {"cps.", "sql-oracle.xml", 76},
+    {"cr.", "xml.xml", 501},
+    {"crdliub-crsedk", "kdesrc-buildrc.xml", 705},
+    {"crdliub-crsedk.", "kdesrc-buildrc.xml", 338},
+    {"crhsab.", "bash.xml", 112},
+    {"crhsc.", "tcsh.xml", 167},
+    {"crhsc.hsc", "tcsh.xml", 693},
+    {"crhsct.", "tcsh.xml", 586},
+    {"crhsz.", "zsh.xml", 668},
+    {"crq.", "xml.xml", 492},
+    {"crs.", "picsrc.xml", 78},
+    {"csp.", "praat.xml", 481},
+    {"ctv.", "varnishtest4.xml", 636},
+    {"cu.", "uscript.xml", 613},
+    {"d.", "d.xml", 28},
+    {"d1sp.", "powershell.xml", 479},
+    {"da.", "asciidoc.xml", 86},
+    {"dacs.", "openscad.xml", 529},
+    {"des.", "sed.xml", 539},
+    {"dg.", "gd-script.xml", 245},
+    {"dhv.", "vhdl.xml", 627},
+    {"dl.", "ld.xml", 345},
+    {"dliub.nosem", "meson.xml", 708},
+    {"dliube.", "bash.xml", 201},
+    {"dliubgkp", "bash.xml", 679},
+    {"dliubkpa", "bash.xml", 669},
+    {"dm.", "markdown.xml", 379},
+    {"dmm.", "markdown.xml", 394},
+    {"dmr.", "rmarkdown.xml", 70},
+    {"dneppabb.", "bitbake.xml", 115},
+    {"dom.", "modula-2-pim-only.xml", 398},
+    {"domukar.", "raku.xml", 498},
+    {"dpp.", "ppd.xml", 464},
+    {"dr.", "rdoc.xml", 72},
+    {"dracv.", "vcard.xml", 620},
+    {"dsx.", "xml.xml", 647},
+    {"dtd.", "dtd.xml", 198},
+    {"e.", "euphoria.xml", 200},
+    {"ead.", "xml.xml", 177},
+    {"ecafq.", "qface.xml", 489},
+    {"ecils.", "systemd-unit.xml", 549},
+    {"ecived.", "systemd-unit.xml", 189},
+    {"ecivres.", "systemd-unit.xml", 541},
+    {"ecs.", "sci.xml", 532},
+    {"edaj.", "pug.xml", 316},
+    {"edocg.", "klipper-gcode.xml", 244},
+    {"edocilper.", "replicode.xml", 505},
+    {"edp.", "cpp.xml", 439},
+    {"eeffoc.", "coffee.xml", 156},
+    {"ef.", "ferite.xml", 226},
+    {"ehcatsum.", "mustache.xml", 407},
+    {"ekamc.", "cmake.xml", 152},
+    {"ekamc.potksed.", "desktop.xml", 188},
+    {"ekar.", "ruby.xml", 495},
+    {"ekip.", "pike.xml", 450},
+    {"elbmin.", "nim.xml", 414},
+    {"eldarg.", "groovy.xml", 261},
+    {"elifekac", "coffee.xml", 671},
+    {"elifekam", "makefile.xml", 678},
+    {"elifekamung", "makefile.xml", 676},
+    {"elifekar", "ruby.xml", 680},
+    {"elifhtrae", "earthfile.xml", 675},
+    {"elifmeg", "ruby.xml", 677},
+    {"eliforp.", "zsh.xml", 473},
+    {"eliforp_hsab.", "bash.xml", 111},
+    {"eliforpz.", "zsh.xml", 666},
+    {"elifrekcod", "dockerfile.xml", 673},
+    {"eliftnargav", "ruby.xml", 683},
+    {"elifyxod", "doxyfile.xml", 674},
+    {"elitxet.", "textile.xml", 592},
+    {"eliug.", "scheme.xml", 264},
+    {"elpma.", "ample.xml", 96},
+    {"emehcs.", "scheme.xml", 533},
+    {"erup.", "pure.xml", 483},
+    {"erutaef.", "gherkin.xml", 227},
+    {"et.", "selinux.xml", 588},
+    {"etalpmet.stxetnoc_elif", "selinux-fc.xml", 698},
+    {"etalpmet_ridemoh", "selinux-fc.xml", 702},
+    {"euc.", "cue.xml", 173},
+    {"euv.", "vue.xml", 637},
+    {"evatco.", "octave.xml", 423},
+    {"eveis.", "sieve.xml", 546},
+    {"evitcar.", "mustache.xml", 494},
+    {"ezeerf.tcejorp.labac", "cabal.xml", 690},
+    {"f.", "fortran-fixed.xml", 33},
+    {"fbfi.", "vcard.xml", 295},
+    {"fcv.", "vcard.xml", 622},
+    {"fdg.", "glosstex.xml", 248},
+    {"fdr.", "xml.xml", 502},
+    {"fdt.", "ahdl.xml", 587},
+    {"fed.", "modula-2-pim-only.xml", 185},
+    {"fer.", "bmethod.xml", 503},
+    {"ffa.", "hunspell-aff.xml", 91},
+    {"ffid.", "diff.xml", 192},
+    {"fgp.", "latex.xml", 442},
+    {"fi.", "selinux.xml", 301},
+    {"fidl.", "ldif.xml", 346},
+    {"fm.", "metafont.xml", 384},
+    {"fni.", "inform.xml", 312},
+    {"fnoc.2dptth", "apache.xml", 704},
+    {"fnoc.2ehcapa", "apache.xml", 686},
+    {"fnoc.dptth", "apache.xml", 703},
+    {"fnoc.ehcapa", "apache.xml", 685},
+    {"fnoc.etilotig", "gitolite.xml", 701},
+    {"fnoc.grox", "xorg.xml", 724},
+    {"fnoc.xnign", "nginx.xml", 715},
+    {"fnoc.ycilop", "selinux.xml", 717},
+    {"fnoccodq.", "qdocconf.xml", 488},
+    {"fpsx.", "xml.xml", 650},
+    {"frp.", "qmake.xml", 468},
+    {"ft.", "terraform.xml", 595},
+    {"ftlg.", "json.xml", 255},
+    {"ftr.", "rtf.xml", 521},
+    {"g.", "gap.xml", 242},
+    {"gam.", "magma.xml", 371},
+    {"garf.", "glsl.xml", 235},
+    {"gc.", "cg.xml", 138},
+    {"gcd.", "prolog.xml", 183},
+    {"gcv.", "gdl.xml", 81},
+    {"ger.", "winehq.xml", 504},
+    {"gfc.", "wml.xml", 26},
+    {"gfck.", "xml.xml", 334},
+    {"gi.", "modula-3.xml", 303},
+    {"gifnoc.", "logtalk.xml", 157},
+    {"gifnoc.labac", "cabal.xml", 688},
+    {"gifnoccra.", "json.xml", 98},
+    {"gifnocetak.", "kateconfig.xml", 331},
+    {"gip.", "pig.xml", 449},
+    {"git.", "tiger.xml", 597},
+    {"giwt.", "twig.xml", 611},
+    {"giz.", "zig.xml", 662},
+    {"gm.", "modula-3.xml", 385},
+    {"gnay.", "yang.xml", 655},
+    {"gnr.", "relaxng.xml", 71},
+    {"gol.", "logfile.xml", 354},
+    {"golegnahc", "changelog.xml", 672},
+    {"golorp.", "prolog.xml", 474},
+    {"golsys", "logfile.xml", 721},
+    {"gro.", "orgmode.xml", 428},
+    {"grp.", "xharbour.xml", 66},
+    {"grt.", "sql-oracle.xml", 79},
+    {"gup.", "pug.xml", 482},
+    {"gvs.", "xml.xml", 575},
+    {"h.", "cpp.xml", 44},
+    {"hc.", "xharbour.xml", 141},
+    {"hcm.", "bmethod.xml", 378},
+    {"hctap", "diff.xml", 716},
+    {"hef.", "ferite.xml", 228},
+    {"hh.", "cpp.xml", 276},
+    {"hrv.", "vera.xml", 633},
+    {"hs.", "zsh.xml", 543},
+    {"hsab.", "bash.xml", 109},
+    {"hsac.", "cashscript.xml", 129},
+    {"hsarc.", "gdb-bt.xml", 163},
+    {"hsarck.", "gdb-bt.xml", 336},
+    {"hsc.", "tcsh.xml", 166},
+    {"hsct.", "tcsh.xml", 585},
+    {"hsif.", "fish.xml", 229},
+    {"hsv.", "v.xml", 635},
+    {"hsz.", "zsh.xml", 667},
+    {"ht4.", "ansforth94.xml", 13},
+    {"htap.", "systemd-unit.xml", 433},
+    {"htf.", "ansforth94.xml", 42},
+    {"hv.", "v.xml", 626},
+    {"hvs.", "systemverilog.xml", 576},
+    {"i.", "asm-m68k.xml", 47},
+    {"ia.", "postscript.xml", 95},
+    {"ib.", "freebasic.xml", 24},
+    {"ibp.", "purebasic.xml", 435},
+    {"ics.", "sci.xml", 534},
+    {"id.", "d.xml", 32},
+    {"ig.", "gap.xml", 252},
+    {"ijt.", "taskjuggler.xml", 600},
+    {"ikiwaidem.", "mediawiki.xml", 380},
+    {"ilams.", "smali.xml", 550},
+    {"ilm.", "ocaml.xml", 390},
+    {"ilp.", "pli.xml", 453},
+    {"im.", "modula-2.xml", 386},
+    {"ini.", "ini.xml", 313},
+    {"irp.", "qmake.xml", 470},
+    {"irv.", "vera.xml", 634},
+    {"isf.", "fsharp.xml", 238},
+    {"isn.", "nsis.xml", 419},
+    {"iss.", "sisu.xml", 564},
+    {"iu.", "xml.xml", 614},
+    {"ixet.", "texinfo.xml", 591},
+    {"iyl.", "lilypond.xml", 55},
+    {"jbo.", "wavefront-obj.xml", 422},
+    {"jlc.", "clojure.xml", 148},
+    {"k.", "k.xml", 330},
+    {"kam.", "mako.xml", 372},
+    {"kha.", "ahk.xml", 94},
+    {"khai.", "ahk.xml", 296},
+    {"kluh.", "mustache.xml", 288},
+    {"km.", "makefile.xml", 388},
+    {"knledk.", "desktop.xml", 337},
+    {"koobcod.", "xml.xml", 194},
+    {"krc.", "crk.xml", 164},
+    {"kt.", "tcl.xml", 602},
+    {"kwa.", "awk.xml", 107},
+    {"l.", "lex.xml", 342},
+    {"labac.", "cabal.xml", 128},
+    {"laci.", "vcard.xml", 293},
+    {"lacol.stxetnoc_elif", "selinux-fc.xml", 697},
+    {"lacol.tcejorp.labac", "cabal.xml", 691},
+    {"lacv.", "vcard.xml", 618},
+    {"lbc.", "cobol.xml", 130},
+    {"lbp.", "wml.xml", 60},
+    {"lbrcs.", "racket.xml", 536},
+    {"lbx.", "xul.xml", 643},
+    {"lc.", "opencl.xml", 146},
+    {"lcj.", "jcl.xml", 52},
+    {"lct.", "tcl.xml", 583},
+    {"lcv.", "varnish4.xml", 624},
+    {"ldd.", "sql-postgresql.xml", 30},
+    {"ldg.", "gdl.xml", 43},
+    {"ldha.", "ahdl.xml", 93},
+    {"ldhv.", "vhdl.xml", 628},
+    {"ldi.", "idl.xml", 298},
+    {"ldsw.", "xml.xml", 641},
+    {"lebx.", "xml.xml", 642},
+    {"lem.", "mel.xml", 381},
+    {"lg4.", "fgl-4gl.xml", 12},
+    {"li.", "cil.xml", 307},
+    {"liame.", "email.xml", 206},
+    {"lic.", "selinux-cil.xml", 144},
+    {"lj.", "julia.xml", 321},
+    {"ll.", "llvm.xml", 353},
+    {"llm.", "ocamllex.xml", 391},
+    {"lm.", "ocaml.xml", 389},
+    {"lmad.", "xml.xml", 178},
+    {"lmah.", "haml.xml", 269},
+    {"lmay.", "yaml.xml", 654},
+    {"lme.", "email.xml", 207},
+    {"lmfc.", "coldfusion.xml", 137},
+    {"lmgs.", "sgml.xml", 542},
+    {"lmm.", "carto-css-mml.xml", 395},
+    {"lmot.", "toml.xml", 605},
+    {"lmq.", "qml.xml", 490},
+    {"lms.", "sml.xml", 551},
+    {"lmth.", "html.xml", 283},
+    {"lmthp.", "html-php.xml", 447},
+    {"lmthr.", "rhtml.xml", 69},
+    {"lmths.", "html.xml", 545},
+    {"lmw.", "html-php.xml", 639},
+    {"lmx.", "xml.xml", 644},
+    {"lmxcs.", "xml.xml", 538},
+    {"lmxr.", "ruby.xml", 523},
+    {"lmy.", "yaml.xml", 658},
+    {"lortnoc", "debiancontrol.xml", 692},
+    {"los.", "solidity.xml", 554},
+    {"lp.", "perl.xml", 64},
+    {"lpmi.", "opal.xml", 310},
+    {"lqhparg.", "graphql.xml", 262},
+    {"lqs.", "sql-postgresql.xml", 77},
+    {"lqssaprevo.", "overpassql.xml", 429},
+    {"lre.", "erlang.xml", 210},
+    {"lrw.", "vrml.xml", 640},
+    {"lsl.", "lsl.xml", 358},
+    {"lslg.", "glsl.xml", 254},
+    {"lsx.", "xslt.xml", 648},
+    {"ltf.", "ftl.xml", 241},
+    {"lts.", "stl.xml", 570},
+    {"lux.", "xul.xml", 651},
+    {"lv.", "verilog.xml", 629},
+    {"m.", "octave.xml", 56},
+    {"m1.", "mandoc.xml", 7},
+    {"m1sp.", "powershell.xml", 480},
+    {"maelg.", "gleam.xml", 253},
+    {"maj.", "jam.xml", 317},
+    {"mbd.", "coldfusion.xml", 182},
+    {"mcs.", "scheme.xml", 535},
+    {"med.", "maxima.xml", 31},
+    {"mfc.", "coldfusion.xml", 136},
+    {"min.", "nim.xml", 413},
+    {"mle.", "elm.xml", 204},
+    {"mm.", "objectivecpp.xml", 393},
+    {"moeg.", "glsl.xml", 251},
+    {"mp.", "perl.xml", 456},
+    {"msa.", "picsrc.xml", 22},
+    {"msaf.", "fasm.xml", 221},
+    {"mss.", "sisu.xml", 565},
+    {"mtb.", "4dos.xml", 125},
+    {"mth.", "html.xml", 282},
+    {"mthp.", "html-php.xml", 446},
+    {"mths.", "html.xml", 544},
+    {"mv.", "velocity.xml", 630},
+    {"n.", "nemerle.xml", 408},
+    {"nagoh.", "mustache.xml", 277},
+    {"nats.", "stan.xml", 567},
+    {"negyxod.", "doxygen.xml", 197},
+    {"nekcihc.", "chicken.xml", 142},
+    {"ngis.", "opal.xml", 547},
+    {"ngp.", "pgn.xml", 62},
+    {"ni.ekamc.", "cmake.xml", 153},
+    {"nido.", "odin.xml", 424},
+    {"nigol.", "tcsh.xml", 357},
+    {"nigol.hsc", "tcsh.xml", 694},
+    {"nigol_hsab.", "bash.xml", 110},
+    {"nigolz.", "zsh.xml", 663},
+    {"nnz.", "zonnon.xml", 665},
+    {"nosc.", "coffee.xml", 168},
+    {"nosj.", "json.xml", 325},
+    {"nsa.", "asn1.xml", 103},
+    {"nwodkram.", "markdown.xml", 375},
+    {"o.", "lpc.xml", 421},
+    {"ococ.", "coffee.xml", 155},
+    {"ocp.", "cobol.xml", 438},
+    {"od.", "stata.xml", 193},
+    {"odot-esaber-tig", "git-rebase.xml", 700},
+    {"og.", "go.xml", 257},
+    {"okam.", "mako.xml", 373},
+    {"om.", "modelica.xml", 396},
+    {"oni.", "cpp.xml", 314},
+    {"oob.", "boo.xml", 121},
+    {"op.", "gettext.xml", 458},
+    {"orb.", "component-pascal.xml", 122},
+    {"orp.", "qmake.xml", 471},
+    {"orter.", "retro.xml", 506},
+    {"otorp.", "protobuf.xml", 476},
+    {"otorptxet.", "textproto.xml", 594},
+    {"p.", "pascal.xml", 430},
+    {"paba.", "abap.xml", 20},
+    {"paws.", "systemd-unit.xml", 577},
+    {"pc.", "component-pascal.xml", 159},
+    {"pg.", "gnuplot.xml", 258},
+    {"php.", "html-php.xml", 444},
+    {"pjt.", "taskjuggler.xml", 601},
+    {"pm.", "metafont.xml", 400},
+    {"pmi.", "bmethod.xml", 309},
+    {"potksed.", "desktop.xml", 187},
+    {"pp.", "puppet.xml", 463},
+    {"ppc.", "cpp.xml", 160},
+    {"ppf.", "fortran-fixed.xml", 39},
+    {"pph.", "cpp.xml", 278},
+    {"ppus.", "valgrind-suppression.xml", 572},
+    {"ppy.", "yacc.xml", 659},
+    {"ps.", "spice.xml", 555},
+    {"psa.", "asp.xml", 105},
+    {"psh.", "spice.xml", 281},
+    {"psil.", "commonlisp.xml", 352},
+    {"psj.", "jsp.xml", 53},
+    {"psl.", "commonlisp.xml", 359},
+    {"pum.", "mup.xml", 406},
+    {"putrats.", "ample.xml", 569},
+    {"pyt.", "typst.xml", 612},
+    {"q.", "q.xml", 487},
+    {"qes.", "ansforth94.xml", 75},
+    {"qf.", "fastq.xml", 233},
+    {"qtsaf.", "fastq.xml", 222},
+    {"r.", "r.xml", 68},
+    {"radnelaci.", "vcard.xml", 294},
+    {"radnelacv.", "vcard.xml", 619},
+    {"ray.", "yara.xml", 656},
+    {"rc.", "crystal.xml", 162},
+    {"rdi.", "idris.xml", 299},
+    {"remit.", "systemd-unit.xml", 599},
+    {"rep.", "fgl-per.xml", 61},
+    {"rof.", "fortran-fixed.xml", 38},
+    {"rpg.", "gpr.xml", 260},
+    {"rpv.", "viper.xml", 631},
+    {"rre.", "fgl-4gl.xml", 211},
+    {"rre.rep.", "fgl-per.xml", 441},
+    {"rv.", "vera.xml", 632},
+    {"rva-msa.", "asm-avr.xml", 102},
+    {"s.", "asm-m68k.xml", 74},
+    {"sa.", "actionscript.xml", 99},
+    {"sab.", "freebasic.xml", 23},
+    {"sap.", "pascal.xml", 432},
+    {"sbf.", "flatbuffers.xml", 224},
+    {"sbh.", "mustache.xml", 273},
+    {"sc.", "cs.xml", 165},
+    {"sci.", "vcard.xml", 297},
+    {"scm", "selinux.xml", 707},
+    {"sct.", "glsl.xml", 584},
+    {"sda.", "ada.xml", 90},
+    {"seitilibapac_ycilop", "selinux.xml", 718},
+    {"seitreporp.", "java-properties.xml", 475},
+    {"selur.", "snort_suricata.xml", 522},
+    {"sepytlmq.", "qml.xml", 491},
+    {"set.", "glsl.xml", 589},
+    {"sf.", "ansforth94.xml", 41},
+    {"sh.", "haskell.xml", 279},
+    {"shc.", "haskell.xml", 143},
+    {"shl.", "literate-haskell.xml", 350},
+    {"sic.", "cisco.xml", 145},
+    {"sigc.", "cgis.xml", 140},
+    {"sj.", "javascript.xml", 322},
+    {"sji.", "j.xml", 48},
+    {"sjlc.", "clojure.xml", 150},
+    {"sjr.", "ruby.xml", 510},
+    {"slc.", "latex.xml", 151},
+    {"slm", "selinux.xml", 710},
+    {"slp.", "ini.xml", 454},
+    {"smin.", "nim.xml", 415},
+    {"sna.", "ansys.xml", 97},
+    {"snoitcnufnats.", "stan.xml", 568},
+    {"sorcam_et", "selinux.xml", 722},
+    {"sorcam_slm", "selinux.xml", 711},
+    {"sp.", "postscript.xml", 477},
+    {"spe.", "postscript.xml", 209},
+    {"spm.", "metafont.xml", 402},
+    {"sr.", "rust.xml", 518},
+    {"srabeldnah.", "mustache.xml", 271},
+    {"sravft.", "terraform.xml", 596},
+    {"srb.", "brightscript.xml", 123},
+    {"sridemoh.stxetnoc_elif", "selinux-fc.xml", 696},
+    {"sroo.", "oors.xml", 425},
+    {"srotcev_ssecca", "selinux.xml", 684},
+    {"srup.", "purescript.xml", 484},
+    {"ss.", "scheme.xml", 563},
+    {"ssalcbb.", "bitbake.xml", 116},
+    {"ssalce.", "bash.xml", 202},
+    {"ssas.", "sass.xml", 526},
+    {"ssc.", "css.xml", 169},
+    {"sscc.", "ccss.xml", 133},
+    {"sscpam.", "mapcss.xml", 374},
+    {"sscs.", "scss.xml", 537},
+    {"ssel.", "less.xml", 347},
+    {"ssi.", "innosetup.xml", 315},
+    {"ssm.", "carto-css.xml", 403},
+    {"ssr.", "xml.xml", 519},
+    {"st.", "typescript.xml", 607},
+    {"stad.", "ats.xml", 181},
+    {"stah.", "ats.xml", 272},
+    {"stas.", "ats.xml", 527},
+    {"stc.", "typescript.xml", 171},
+    {"stk.", "kotlin.xml", 340},
+    {"stm.", "typescript.xml", 404},
+    {"stxetnoc_elif", "selinux-fc.xml", 695},
+    {"stxetnoc_ppaes", "selinux.xml", 720},
+    {"stxetnoc_trop", "selinux.xml", 719},
+    {"suiluj.", "javascript.xml", 329},
+    {"sxe.", "elixir.xml", 213},
+    {"sy.", "yacas.xml", 660},
+    {"t.", "tads3.xml", 579},
+    {"t2t.", "txt2tags.xml", 580},
+    {"taarp.", "praat.xml", 67},
+    {"tab.", "dosbat.xml", 113},
+    {"tacgol.", "logcat.xml", 356},
+    {"tad.", "hunspell-dat.xml", 180},
+    {"tb.", "gdb-bt.xml", 124},
+    {"tbs.", "scala.xml", 528},
+    {"tcejorp.labac", "cabal.xml", 689},
+    {"tcejorpetak.", "json.xml", 332},
+    {"tcurtsnocs", "python.xml", 682},
+    {"tegrat.", "systemd-unit.xml", 582},
+    {"tekcos.", "systemd-unit.xml", 553},
+    {"telmah.", "hamlet.xml", 270},
+    {"tennosbil.", "jsonnet.xml", 351},
+    {"tennosj.", "jsonnet.xml", 326},
+    {"tfiws.", "swift.xml", 578},
+    {"tgl.", "logtalk.xml", 349},
+    {"tinibdg.", "gdbinit.xml", 247},
+    {"tji.", "j.xml", 49},
+    {"tk.", "kotlin.xml", 339},
+    {"tkr.", "racket.xml", 511},
+    {"tlsx.", "xslt.xml", 649},
+    {"tnuom.", "systemd-unit.xml", 399},
+    {"tnuomotua.", "systemd-unit.xml", 106},
+    {"tobor.", "robot.xml", 515},
+    {"tod.", "dot.xml", 195},
+    {"tolpung.", "gnuplot.xml", 256},
+    {"ton.", "mup.xml", 418},
+    {"toob-sh.", "haskell.xml", 280},
+    {"top.", "gettext.xml", 461},
+    {"tpircs-taarp.", "praat.xml", 466},
+    {"tpircsispo.", "opsiscript.xml", 427},
+    {"tpircsniwk.", "javascript.xml", 341},
+    {"tpircsnocs", "python.xml", 681},
+    {"tpircstaarp.", "praat.xml", 467},
+    {"tps.", "selinux.xml", 558},
+    {"trad.", "dart.xml", 179},
+    {"trev.", "glsl.xml", 625},
+    {"trf.", "ansforth94.xml", 40},
+    {"trons.", "snort_suricata.xml", 552},
+    {"trs.", "subrip-subtitles.xml", 562},
+    {"tsetukar.", "raku.xml", 499},
+    {"tsilc.", "clist.xml", 27},
+    {"tsl.", "cobol.xml", 360},
+    {"tsm.lmth.", "mustache.xml", 285},
+    {"tsopm.", "metafont.xml", 401},
+    {"tsr.", "rest.xml", 520},
+    {"tss-.", "sisu.xml", 5},
+    {"tss.", "sisu.xml", 566},
+    {"tss_.", "sisu.xml", 82},
+    {"ttm.", "mergetagtext.xml", 405},
+    {"tuogolz.", "zsh.xml", 664},
+    {"txt.odot", "todo.xml", 723},
+    {"txt.snoitpo_nosem", "meson.xml", 709},
+    {"txt.stsilekamc", "cmake.xml", 670},
+    {"txtbp.", "textproto.xml", 437},
+    {"u3m.", "m3u.xml", 367},
+    {"ukar.", "raku.xml", 496},
+    {"um.lmth.", "mustache.xml", 286},
+    {"unem.", "ample.xml", 382},
+    {"uxe.", "euphoria.xml", 214},
+    {"v.", "verilog.xml", 80},
+    {"vaj.ofni-eludom", "java-module.xml", 712},
+    {"vis.", "sieve.xml", 548},
+    {"vle.", "elvish.xml", 205},
+    {"vop.", "povray.xml", 462},
+    {"vs.", "systemverilog.xml", 574},
+    {"vsc.", "csv.xml", 170},
+    {"vst.", "tsv.xml", 608},
+    {"w.", "noweb.xml", 638},
+    {"wn.", "noweb.xml", 420},
+    {"wxe.", "euphoria.xml", 215},
+    {"wyp.", "python.xml", 486},
+    {"x3.", "mandoc.xml", 10},
+    {"xbb.", "latex.xml", 117},
+    {"xbc.", "latex.xml", 131},
+    {"xbl.", "latex.xml", 343},
+    {"xbm.", "email.xml", 377},
+    {"xdi.", "hunspell-idx.xml", 300},
+    {"xe.", "elixir.xml", 212},
+    {"xee.", "elixir.xml", 203},
+    {"xee.lmx.", "elixir.xml", 645},
+    {"xee.sj.", "elixir.xml", 323},
+    {"xeh.", "intelhex.xml", 275},
+    {"xel.", "lex.xml", 348},
+    {"xelf.", "lex.xml", 230},
+    {"xer.", "rexx.xml", 507},
+    {"xet.", "latex.xml", 590},
+    {"xfgc.", "cg.xml", 139},
+    {"xh.", "haxe.xml", 45},
+    {"xhi.", "intelhex.xml", 304},
+    {"xin.", "nix.xml", 417},
+    {"xlme.", "email.xml", 208},
+    {"xnign.", "nginx.xml", 412},
+    {"xobm.", "email.xml", 376},
+    {"xod.", "doxygen.xml", 196},
+    {"xsf.", "fsharp.xml", 239},
+    {"xsj.", "javascript-react.xml", 328},
+    {"xst.", "typescript-react.xml", 609},
+    {"xtc.", "context.xml", 172},
+    {"xtd.", "latex.xml", 199},
+    {"xtl.", "latex.xml", 361},
+    {"xxc.", "cpp.xml", 175},
+    {"xxh.", "cpp.xml", 290},
+    {"y.", "yacc.xml", 652},
+    {"ybd.", "sql-oracle.xml", 29},
+    {"ydb.", "sql-oracle.xml", 118},
+    {"yl.", "lilypond.xml", 54},
+    {"yli.", "lilypond.xml", 50},
+    {"ylm.", "ocamlyacc.xml", 392},
+    {"ylp.", "ply.xml", 455},
+    {"ynop.", "pony.xml", 460},
+    {"yp.", "python.xml", 485},
+    {"ypc.", "cobol.xml", 161},
+    {"ypoc.", "cobol.xml", 158},
+    {"ypr.", "renpy.xml", 516},
+    {"yrruc.", "curry.xml", 174},
+    {"yrrucl.", "literate-curry.xml", 344},
+    {"yts.", "latex.xml", 571},
+    {"yvoorg.", "groovy.xml", 263},
+    {"yy.", "yacc.xml", 661},
+    {"zg.qf.", "fastq.xml", 234},
+    {"zg.qtsaf.", "fastq.xml", 223},
+    {"zkit.", "latex.xml", 598},
+};
+
+constexpr LanguageDbGlob fileNamePrefixGlobsEntries[] = {
+    {".gitignore", "git-ignore.xml", 725},
+    {".htaccess", "apache.xml", 726},
+    {".htpasswd", "apache.xml", 727},
+    {"bin.", "apparmor.xml", 734},
+    {"doxyfile.", "doxyfile.xml", 728},
+    {"etc.cron.", "apparmor.xml", 735},
+    {"fishd.", "fish.xml", 736},
+    {"gnumakefile.", "makefile.xml", 729},
+    {"jam", "jam.xml", 730},
+    {"kconfig", "kconfig.xml", 731},
+    {"makefile.", "makefile.xml", 732},
+    {"opt.", "apparmor.xml", 738},
+    {"sbin.", "apparmor.xml", 740},
+    {"syslog.", "logfile.xml", 741},
+    {"usr.bin.", "apparmor.xml", 742},
+    {"usr.lib.", "apparmor.xml", 743},
+    {"usr.lib32.", "apparmor.xml", 744},
+    {"usr.lib64.", "apparmor.xml", 745},
+    {"usr.libexec.", "apparmor.xml", 746},
+    {"usr.libx32.", "apparmor.xml", 747},
+    {"usr.local.bin.", "apparmor.xml", 748},
+    {"usr.local.lib", "apparmor.xml", 749},
+    {"usr.local.sbin.", "apparmor.xml", 750},
+    {"usr.sbin.", "apparmor.xml", 751},
+};
+
+constexpr LanguageDbGlob residualFileNameGlobsEntries[] = {
+    {" *.ADO", "stata.xml", 0},
+    {" *.DO", "stata.xml", 1},
+    {" *.DOH", "stata.xml", 2},
+    {" *.ado", "stata.xml", 3},
+    {" *.doh", "stata.xml", 4},
+    {"*.gplt,*.plt", "gnuplot.xml", 259},
+    {"*.log.*", "logfile.xml", 355},
+    {"*.tt*", "template-toolkit.xml", 610},
+    {"*asterisk/*.conf", "asterisk.xml", 687},
+    {"QRPG*.*", "ilerpg.xml", 733},
+    {"qrpg*.*", "ilerpg.xml", 739},
+};
 
-QMap<QString, QString> create_mimeTypeToXmlFileName() {
-    QMap<QString, QString> mimeTypeToXmlFileName;
-    mimeTypeToXmlFileName["text/x-glslsrc"] = "glsl.xml";
-    mimeTypeToXmlFileName["text/x-abap-src"] = "abap.xml";
-    mimeTypeToXmlFileName["text/x-ilerpg-src"] = "ilerpg.xml";
-    mimeTypeToXmlFileName["text/x-cgsrc"] = "cg.xml";
-    mimeTypeToXmlFileName["text/x-git-ignore"] = "git-ignore.xml";
-    mimeTypeToXmlFileName["text/x-uscript"] = "uscript.xml";
-    mimeTypeToXmlFileName["text/x-mab"] = "mab.xml";
-    mimeTypeToXmlFileName["text/ngc"] = "gcode.xml";
-    mimeTypeToXmlFileName["text/cisco"] = "cisco.xml";
-    mimeTypeToXmlFileName["text/x-logcat"] = "logcat.xml";
-    mimeTypeToXmlFileName["text/yaml"] = "yaml.xml";
-    mimeTypeToXmlFileName["text/x-coffeescript"] = "coffee.xml";
-    mimeTypeToXmlFileName["application/x-coffeescript"] = "coffee.xml";
-    mimeTypeToXmlFileName["application/vnd.coffeescript"] = "coffee.xml";
-    mimeTypeToXmlFileName["text/x-ncsrc"] = "nesc.xml";
-    mimeTypeToXmlFileName["text/x-povray-script"] = "povray.xml";
-    mimeTypeToXmlFileName["text/x-povray-include"] = "povray.xml";
-    mimeTypeToXmlFileName["text/html"] = "vue.xml";
-    mimeTypeToXmlFileName["text/x-j"] = "j.xml";
-    mimeTypeToXmlFileName["text/x-jsrc"] = "j.xml";
-    mimeTypeToXmlFileName["text/x-cmake"] = "cmake.xml";
-    mimeTypeToXmlFileName["application/x-pike"] = "pike.xml";
-    mimeTypeToXmlFileName["text/x-pike"] = "pike.xml";
-    mimeTypeToXmlFileName["text/x-jam"] = "jam.xml";
-    mimeTypeToXmlFileName["text/x-Jamfile"] = "jam.xml";
-    mimeTypeToXmlFileName["text/x-Jamrules"] = "jam.xml";
-    mimeTypeToXmlFileName["text/x-Jambase"] = "jam.xml";
-    mimeTypeToXmlFileName["text/x-fluent-translation"] = "fluent.xml";
-    mimeTypeToXmlFileName["text/x-hxsrc"] = "haxe.xml";
-    mimeTypeToXmlFileName["text/x-dart"] = "dart.xml";
-    mimeTypeToXmlFileName["text/x-ferite-src"] = "ferite.xml";
-    mimeTypeToXmlFileName["text/octave"] = "octave.xml";
-    mimeTypeToXmlFileName["text/tsx"] = "typescript-react.xml";
-    mimeTypeToXmlFileName["text/x-tsx"] = "typescript-react.xml";
-    mimeTypeToXmlFileName["application/tsx"] = "typescript-react.xml";
-    mimeTypeToXmlFileName["application/x-tsx"] = "typescript-react.xml";
-    mimeTypeToXmlFileName["audio/x-mpegurl"] = "m3u.xml";
-    mimeTypeToXmlFileName["application/x-puppet"] = "puppet.xml";
-    mimeTypeToXmlFileName["application/vnd.cups-ppd"] = "ppd.xml";
-    mimeTypeToXmlFileName["text/x-lua"] = "lua.xml";
-    mimeTypeToXmlFileName["application/directory"] = "ldif.xml";
-    mimeTypeToXmlFileName["text/x-sql"] = "sql-postgresql.xml";
-    mimeTypeToXmlFileName["application/x-dos"] = "dosbat.xml";
-    mimeTypeToXmlFileName["text/x-asm6502"] = "asm6502.xml";
-    mimeTypeToXmlFileName["text/csv"] = "csv.xml";
-    mimeTypeToXmlFileName["text/mfile"] = "matlab.xml";
-    mimeTypeToXmlFileName["text/css"] = "css.xml";
-    mimeTypeToXmlFileName["text/x-fortran-src"] = "fortran-free.xml";
-    mimeTypeToXmlFileName["text/x-actionscript"] = "actionscript.xml";
-    mimeTypeToXmlFileName["text/x-vera-src"] = "vera.xml";
-    mimeTypeToXmlFileName["text/jsx"] = "javascript-react.xml";
-    mimeTypeToXmlFileName["text/x-jsx"] = "javascript-react.xml";
-    mimeTypeToXmlFileName["application/jsx"] = "javascript-react.xml";
-    mimeTypeToXmlFileName["application/x-jsx"] = "javascript-react.xml";
-    mimeTypeToXmlFileName["text/x-haml"] = "haml.xml";
-    mimeTypeToXmlFileName["text/sgml"] = "sgml.xml";
-    mimeTypeToXmlFileName["text/x-smali"] = "smali.xml";
-    mimeTypeToXmlFileName["application/x-csh"] = "tcsh.xml";
-    mimeTypeToXmlFileName["text/x-objcpp-src"] = "objectivecpp.xml";
-    mimeTypeToXmlFileName["text/x-c-hdr"] = "objectivecpp.xml";
-    mimeTypeToXmlFileName["text/x-tex"] = "latex.xml";
-    mimeTypeToXmlFileName["text/x-nsis"] = "nsis.xml";
-    mimeTypeToXmlFileName["text/x-nemerle"] = "nemerle.xml";
-    mimeTypeToXmlFileName["text/rtf"] = "rtf.xml";
-    mimeTypeToXmlFileName["application/rtf"] = "rtf.xml";
-    mimeTypeToXmlFileName["application/x-pig"] = "pig.xml";
-    mimeTypeToXmlFileName["text/x-pig"] = "pig.xml";
-    mimeTypeToXmlFileName["text/x-adasrc"] = "gpr.xml";
-    mimeTypeToXmlFileName["text/x-elixir"] = "elixir.xml";
-    mimeTypeToXmlFileName["text/x-tlaplus"] = "tlaplus.xml";
-    mimeTypeToXmlFileName["text/x-vpr"] = "viper.xml";
-    mimeTypeToXmlFileName["text/x-protobuf"] = "protobuf.xml";
-    mimeTypeToXmlFileName["text/x-gherkin"] = "gherkin.xml";
-    mimeTypeToXmlFileName["text/asciidoc"] = "asciidoc.xml";
-    mimeTypeToXmlFileName["text/xul"] = "xul.xml";
-    mimeTypeToXmlFileName["text/x-rsiidl-src"] = "rsiidl.xml";
-    mimeTypeToXmlFileName["text/x-zig"] = "zig.xml";
-    mimeTypeToXmlFileName["text/x-c++src"] = "cpp.xml";
-    mimeTypeToXmlFileName["text/x-c++hdr"] = "cpp.xml";
-    mimeTypeToXmlFileName["text/x-chdr"] = "cpp.xml";
-    mimeTypeToXmlFileName["text/x-zonnon"] = "zonnon.xml";
-    mimeTypeToXmlFileName["text/x-scheme"] = "scheme.xml";
-    mimeTypeToXmlFileName["application/x-desktop"] = "desktop.xml";
-    mimeTypeToXmlFileName["text/x-rst"] = "rest.xml";
-    mimeTypeToXmlFileName["text/x-modula-2"] = "modula-2.xml";
-    mimeTypeToXmlFileName["text/txt2tags"] = "txt2tags.xml";
-    mimeTypeToXmlFileName["text/x-kbasic-src"] = "kbasic.xml";
-    mimeTypeToXmlFileName["text/x-gettext-translation"] = "gettext.xml";
-    mimeTypeToXmlFileName["text/x-mup"] = "mup.xml";
-    mimeTypeToXmlFileName["audio/x-mup"] = "mup.xml";
-    mimeTypeToXmlFileName["application/x-mup"] = "mup.xml";
-    mimeTypeToXmlFileName["audio/x-notes"] = "mup.xml";
-    mimeTypeToXmlFileName["application/x-crystal"] = "crystal.xml";
-    mimeTypeToXmlFileName["application/json"] = "json.xml";
-    mimeTypeToXmlFileName["text/x-systemverilog-src"] = "systemverilog.xml";
-    mimeTypeToXmlFileName["text/x-inform-src"] = "inform.xml";
-    mimeTypeToXmlFileName["text/x-renpy"] = "renpy.xml";
-    mimeTypeToXmlFileName["text/x-velocity-src"] = "velocity.xml";
-    mimeTypeToXmlFileName["text/x-vm-src"] = "velocity.xml";
-    mimeTypeToXmlFileName["text/x-euphoria"] = "euphoria.xml";
-    mimeTypeToXmlFileName["text/x-csrc"] = "c.xml";
-    mimeTypeToXmlFileName["text/x-coldfusion"] = "coldfusion.xml";
-    mimeTypeToXmlFileName["message/rfc822"] = "email.xml";
-    mimeTypeToXmlFileName["text/x-rpm-spec"] = "rpmspec.xml";
-    mimeTypeToXmlFileName["application/xml-dtd"] = "dtd.xml";
-    mimeTypeToXmlFileName["text/x-asm"] = "gnuassembler.xml";
-    mimeTypeToXmlFileName["text/spice"] = "spice.xml";
-    mimeTypeToXmlFileName["application/x-perl"] = "perl.xml";
-    mimeTypeToXmlFileName["text/x-perl"] = "perl.xml";
-    mimeTypeToXmlFileName["text/x-dsrc"] = "d.xml";
-    mimeTypeToXmlFileName["text/x-lsl"] = "lsl.xml";
-    mimeTypeToXmlFileName["text/x-r-markdown"] = "rmarkdown.xml";
-    mimeTypeToXmlFileName["application/x-shellscript"] = "zsh.xml";
-    mimeTypeToXmlFileName["text/x-vlang"] = "v.xml";
-    mimeTypeToXmlFileName["text/calendar"] = "vcard.xml";
-    mimeTypeToXmlFileName["text/vcard"] = "vcard.xml";
-    mimeTypeToXmlFileName["text/x-fastq"] = "fastq.xml";
-    mimeTypeToXmlFileName["text/rust"] = "rust.xml";
-    mimeTypeToXmlFileName["text/x-awk"] = "awk.xml";
-    mimeTypeToXmlFileName["text/typescript"] = "typescript.xml";
-    mimeTypeToXmlFileName["application/typescript"] = "typescript.xml";
-    mimeTypeToXmlFileName["text/x-typescript"] = "typescript.xml";
-    mimeTypeToXmlFileName["application/x-typescript"] = "typescript.xml";
-    mimeTypeToXmlFileName["application/x-fish"] = "fish.xml";
-    mimeTypeToXmlFileName["text/x-prolog"] = "prolog.xml";
-    mimeTypeToXmlFileName["text/x-yacassrc"] = "yacas.xml";
-    mimeTypeToXmlFileName["text/x-ahdl"] = "ahdl.xml";
-    mimeTypeToXmlFileName["text/x-doxygen"] = "doxygen.xml";
-    mimeTypeToXmlFileName["text/x-metapost"] = "metafont.xml";
-    mimeTypeToXmlFileName["text/x-e-src"] = "e.xml";
-    mimeTypeToXmlFileName["application/x-subrip"] = "subrip-subtitles.xml";
-    mimeTypeToXmlFileName["text/x-patch"] = "diff.xml";
-    mimeTypeToXmlFileName["application/sla"] = "stl.xml";
-    mimeTypeToXmlFileName["text/x-toml"] = "toml.xml";
-    mimeTypeToXmlFileName["text/x-javascript"] = "javascript.xml";
-    mimeTypeToXmlFileName["application/x-javascript"] = "javascript.xml";
-    mimeTypeToXmlFileName["application/javascript"] = "javascript.xml";
-    mimeTypeToXmlFileName["text/javascript"] = "javascript.xml";
-    mimeTypeToXmlFileName["text/x-vala"] = "vala.xml";
-    mimeTypeToXmlFileName["text/x-php4-src"] = "html-php.xml";
-    mimeTypeToXmlFileName["text/x-php3-src"] = "html-php.xml";
-    mimeTypeToXmlFileName["text/vnd.wap.wml"] = "html-php.xml";
-    mimeTypeToXmlFileName["application/x-php"] = "html-php.xml";
-    mimeTypeToXmlFileName["text/x-scala"] = "scala.xml";
-    mimeTypeToXmlFileName["text/x-ocaml"] = "ocaml.xml";
-    mimeTypeToXmlFileName["text/x-curry"] = "curry.xml";
-    mimeTypeToXmlFileName["text/gap"] = "gap.xml";
-    mimeTypeToXmlFileName["text/x-clipper-src"] = "clipper.xml";
-    mimeTypeToXmlFileName["text/x-magma"] = "magma.xml";
-    mimeTypeToXmlFileName["text/vnd.abc"] = "abc.xml";
-    mimeTypeToXmlFileName["text/x-makefile"] = "makefile.xml";
-    mimeTypeToXmlFileName["text/x-qface"] = "qface.xml";
-    mimeTypeToXmlFileName["application/x-qface"] = "qface.xml";
-    mimeTypeToXmlFileName["application/x-texinfo"] = "texinfo.xml";
-    mimeTypeToXmlFileName["text/x-PicSrc"] = "picsrc.xml";
-    mimeTypeToXmlFileName["text/x-PicHdr"] = "picsrc.xml";
-    mimeTypeToXmlFileName["text/x-component-pascal"] = "component-pascal.xml";
-    mimeTypeToXmlFileName["text/x-meson"] = "meson.xml";
-    mimeTypeToXmlFileName["text/x-haskell"] = "haskell.xml";
-    mimeTypeToXmlFileName["text/x-sed"] = "sed.xml";
-    mimeTypeToXmlFileName["text/x-logtalk"] = "logtalk.xml";
-    mimeTypeToXmlFileName["text/x-4glper"] = "fgl-per.xml";
-    mimeTypeToXmlFileName["text/x-4glpererr"] = "fgl-per.xml";
-    mimeTypeToXmlFileName["text/x-tcl"] = "tcl.xml";
-    mimeTypeToXmlFileName["text/x-twig"] = "twig.xml";
-    mimeTypeToXmlFileName["text/x-modula2"] = "modula-2-pim-only.xml";
-    mimeTypeToXmlFileName["text/x-agda"] = "agda.xml";
-    mimeTypeToXmlFileName["text/x-gdf"] = "glosstex.xml";
-    mimeTypeToXmlFileName["model/vrml"] = "vrml.xml";
-    mimeTypeToXmlFileName["text/x-purebasic"] = "purebasic.xml";
-    mimeTypeToXmlFileName["text/x-boo"] = "boo.xml";
-    mimeTypeToXmlFileName["text/x-verilog-src"] = "verilog.xml";
-    mimeTypeToXmlFileName["text/x-sci"] = "sci.xml";
-    mimeTypeToXmlFileName["text/x-pascal"] = "pascal.xml";
-    mimeTypeToXmlFileName["text/x-mips"] = "mips.xml";
-    mimeTypeToXmlFileName["application/postscript"] = "postscript.xml";
-    mimeTypeToXmlFileName["application/x-python"] = "python.xml";
-    mimeTypeToXmlFileName["text/x-python"] = "python.xml";
-    mimeTypeToXmlFileName["text/x-python3"] = "python.xml";
-    mimeTypeToXmlFileName["text/x-amplesrc"] = "ample.xml";
-    mimeTypeToXmlFileName["text/x-vhdl"] = "vhdl.xml";
-    mimeTypeToXmlFileName["text/x-java"] = "java.xml";
-    mimeTypeToXmlFileName["text/x-lilypond"] = "lilypond.xml";
-    mimeTypeToXmlFileName["text/xml"] = "xml.xml";
-    mimeTypeToXmlFileName["text/book"] = "xml.xml";
-    mimeTypeToXmlFileName["text/daml"] = "xml.xml";
-    mimeTypeToXmlFileName["text/rdf"] = "xml.xml";
-    mimeTypeToXmlFileName["application/rss+xml"] = "xml.xml";
-    mimeTypeToXmlFileName["application/xspf+xml"] = "xml.xml";
-    mimeTypeToXmlFileName["image/svg+xml"] = "xml.xml";
-    mimeTypeToXmlFileName["application/x-designer"] = "xml.xml";
-    mimeTypeToXmlFileName["application/x-xbel"] = "xml.xml";
-    mimeTypeToXmlFileName["application/xml"] = "xml.xml";
-    mimeTypeToXmlFileName["application/scxml+xml"] = "xml.xml";
-    mimeTypeToXmlFileName["application/x-ruby"] = "ruby.xml";
-    mimeTypeToXmlFileName["application/sieve"] = "sieve.xml";
-    mimeTypeToXmlFileName["text/x-openscad-src"] = "openscad.xml";
-    mimeTypeToXmlFileName["text/x-modula-3"] = "modula-3.xml";
-    mimeTypeToXmlFileName["text/x-systemd-unit"] = "systemd-unit.xml";
-    mimeTypeToXmlFileName["text/x-xharbour-src"] = "xharbour.xml";
-    mimeTypeToXmlFileName["text/x-asp-src"] = "asp.xml";
-    mimeTypeToXmlFileName["text/x-asm-avr"] = "asm-avr.xml";
-    mimeTypeToXmlFileName["text/x-freebasic"] = "freebasic.xml";
-    mimeTypeToXmlFileName["text/x-4glsrc"] = "fgl-4gl.xml";
-    mimeTypeToXmlFileName["text/x-4glerr"] = "fgl-4gl.xml";
-    mimeTypeToXmlFileName["text/x-qml"] = "qml.xml";
-    mimeTypeToXmlFileName["application/x-qml"] = "qml.xml";
-    mimeTypeToXmlFileName["text/x-pli"] = "pli.xml";
-    mimeTypeToXmlFileName["text/x-nim"] = "nim.xml";
-    mimeTypeToXmlFileName["text/x-terraform"] = "terraform.xml";
-    mimeTypeToXmlFileName["text/x-csharp-src"] = "cs.xml";
-    mimeTypeToXmlFileName["text/x-csharp-hde"] = "cs.xml";
-    mimeTypeToXmlFileName["text/x-sather-src"] = "sather.xml";
-    mimeTypeToXmlFileName["application/x-cue"] = "cue.xml";
-    mimeTypeToXmlFileName["text/x-eiffel-src"] = "eiffel.xml";
-    mimeTypeToXmlFileName["text/x-pony"] = "pony.xml";
-    mimeTypeToXmlFileName["text/vnd.git.rebase"] = "git-rebase.xml";
-    mimeTypeToXmlFileName["text/x-idl-src"] = "idl.xml";
-    mimeTypeToXmlFileName["text/x-clsrc"] = "opencl.xml";
-    mimeTypeToXmlFileName["text/x-dot"] = "dot.xml";
-    mimeTypeToXmlFileName["text/x-bib"] = "bibtex.xml";
-    mimeTypeToXmlFileName["text/x-yacc"] = "yacc.xml";
-    mimeTypeToXmlFileName["text/x-bison"] = "yacc.xml";
-    mimeTypeToXmlFileName["text/x-objc-src"] = "objectivec.xml";
-    return mimeTypeToXmlFileName;
-}
-QMap<QString, QString> mimeTypeToXmlFileName = create_mimeTypeToXmlFileName();
+constexpr LanguageDbGlob firstLineGlobsEntries[] = {
+    {"*/sh*", "bash.xml", 0},
+    {"*bash", "bash.xml", 1},
+    {"*perl*", "perl.xml", 2},
+    {"*python*", "python.xml", 3},
+    {"<!doctype html*", "html-php.xml", 4},
+    {"<!doctype*", "xml.xml", 5},
+    {"<?php*", "html-php.xml", 6},
+    {"<?xml*", "xml.xml", 7},
+    {"<html*", "html-php.xml", 8},
+    {"Index: *", "diff.xml", 9},
+    {"\\documentclass", "latex.xml", 10},
+};
 
-QMap<QString, QString> create_extensionToXmlFileName() {
-    QMap<QString, QString> extensionToXmlFileName;
-    extensionToXmlFileName["*.glsl"] = "glsl.xml";
-    extensionToXmlFileName["*.vert"] = "glsl.xml";
-    extensionToXmlFileName["*.frag"] = "glsl.xml";
-    extensionToXmlFileName["*.geom"] = "glsl.xml";
-    extensionToXmlFileName["*.tcs"] = "glsl.xml";
-    extensionToXmlFileName["*.tes"] = "glsl.xml";
-    extensionToXmlFileName["*.abap"] = "abap.xml";
-    extensionToXmlFileName["*.ABAP"] = "abap.xml";
-    extensionToXmlFileName["QRPG*.*"] = "ilerpg.xml";
-    extensionToXmlFileName["qrpg*.*"] = "ilerpg.xml";
-    extensionToXmlFileName["*.fs"] = "fsharp.xml";
-    extensionToXmlFileName["*.fsi"] = "fsharp.xml";
-    extensionToXmlFileName["*.fsx"] = "fsharp.xml";
-    extensionToXmlFileName["*.ll"] = "llvm.xml";
-    extensionToXmlFileName["*.cg"] = "cg.xml";
-    extensionToXmlFileName["*.cgfx"] = "cg.xml";
-    extensionToXmlFileName["*.cfg"] = "klipper-config.xml";
-    extensionToXmlFileName["*.pro"] = "qmake.xml";
-    extensionToXmlFileName["*.pri"] = "qmake.xml";
-    extensionToXmlFileName["*.prf"] = "qmake.xml";
-    extensionToXmlFileName[".gitignore*"] = "git-ignore.xml";
-    extensionToXmlFileName["*.w"] = "noweb.xml";
-    extensionToXmlFileName["*.nw"] = "noweb.xml";
-    extensionToXmlFileName["*.uc"] = "uscript.xml";
-    extensionToXmlFileName["*.ini"] = "ini.xml";
-    extensionToXmlFileName["*.pls"] = "ini.xml";
-    extensionToXmlFileName["*.kcfgc"] = "ini.xml";
-    extensionToXmlFileName["*.mab"] = "mab.xml";
-    extensionToXmlFileName["*.MAB"] = "mab.xml";
-    extensionToXmlFileName["*.Mab"] = "mab.xml";
-    extensionToXmlFileName["*.ngc"] = "gcode.xml";
-    extensionToXmlFileName["*.robot"] = "robot.xml";
-    extensionToXmlFileName["*.mtt"] = "mergetagtext.xml";
-    extensionToXmlFileName["*.btm"] = "4dos.xml";
-    extensionToXmlFileName["*.cis"] = "cisco.xml";
-    extensionToXmlFileName["*.logcat"] = "logcat.xml";
-    extensionToXmlFileName["*.supp"] = "valgrind-suppression.xml";
-    extensionToXmlFileName["*.yaml"] = "yaml.xml";
-    extensionToXmlFileName["*.yml"] = "yaml.xml";
-    extensionToXmlFileName["*Cakefile"] = "coffee.xml";
-    extensionToXmlFileName["*.coffee"] = "coffee.xml";
-    extensionToXmlFileName["*.coco"] = "coffee.xml";
-    extensionToXmlFileName["*.cson"] = "coffee.xml";
-    extensionToXmlFileName["*.nc"] = "nesc.xml";
-    extensionToXmlFileName["*.inc"] = "html-php.xml";
-    extensionToXmlFileName["*.pov"] = "povray.xml";
-    extensionToXmlFileName["*.htm"] = "html.xml";
-    extensionToXmlFileName["*.html"] = "html.xml";
-    extensionToXmlFileName["*xorg.conf"] = "xorg.xml";
-    extensionToXmlFileName["*.jsonnet"] = "jsonnet.xml";
-    extensionToXmlFileName["*.libsonnet"] = "jsonnet.xml";
-    extensionToXmlFileName["*.ijs"] = "j.xml";
-    extensionToXmlFileName["*.ijt"] = "j.xml";
-    extensionToXmlFileName["*.IJS"] = "j.xml";
-    extensionToXmlFileName["*.IJT"] = "j.xml";
-    extensionToXmlFileName["*CMakeLists.txt"] = "cmake.xml";
-    extensionToXmlFileName["*.cmake"] = "cmake.xml";
-    extensionToXmlFileName["*.cmake.in"] = "cmake.xml";
-    extensionToXmlFileName["*.pike"] = "pike.xml";
-    extensionToXmlFileName["Jam*"] = "jam.xml";
-    extensionToXmlFileName["*.jam"] = "jam.xml";
-    extensionToXmlFileName["*.ftl"] = "ftl.xml";
-    extensionToXmlFileName["*.mapcss"] = "mapcss.xml";
-    extensionToXmlFileName["*.hx"] = "haxe.xml";
-    extensionToXmlFileName["*.Hx"] = "haxe.xml";
-    extensionToXmlFileName["*.hX"] = "haxe.xml";
-    extensionToXmlFileName["*.HX"] = "haxe.xml";
-    extensionToXmlFileName["*.vcl"] = "varnish4.xml";
-    extensionToXmlFileName["*.dart"] = "dart.xml";
-    extensionToXmlFileName["*.fe"] = "ferite.xml";
-    extensionToXmlFileName["*.feh"] = "ferite.xml";
-    extensionToXmlFileName["*.jl"] = "julia.xml";
-    extensionToXmlFileName["*.4th"] = "ansforth94.xml";
-    extensionToXmlFileName["*.4TH"] = "ansforth94.xml";
-    extensionToXmlFileName["*.f"] = "fortran-fixed.xml";
-    extensionToXmlFileName["*.F"] = "fortran-fixed.xml";
-    extensionToXmlFileName["*.frt"] = "ansforth94.xml";
-    extensionToXmlFileName["*.FRT"] = "ansforth94.xml";
-    extensionToXmlFileName["*.FS"] = "ansforth94.xml";
-    extensionToXmlFileName["*.fth"] = "ansforth94.xml";
-    extensionToXmlFileName["*.FTH"] = "ansforth94.xml";
-    extensionToXmlFileName["*.seq"] = "ansforth94.xml";
-    extensionToXmlFileName["*.SEQ"] = "ansforth94.xml";
-    extensionToXmlFileName["*.octave"] = "octave.xml";
-    extensionToXmlFileName["*.m"] = "octave.xml";
-    extensionToXmlFileName["*.M"] = "octave.xml";
-    extensionToXmlFileName["*.tsx"] = "typescript-react.xml";
-    extensionToXmlFileName["*.m3u"] = "m3u.xml";
-    extensionToXmlFileName["*.pp"] = "puppet.xml";
-    extensionToXmlFileName["*.elv"] = "elvish.xml";
-    extensionToXmlFileName["usr.bin.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.sbin.*"] = "apparmor.xml";
-    extensionToXmlFileName["bin.*"] = "apparmor.xml";
-    extensionToXmlFileName["sbin.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.lib.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.lib64.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.lib32.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.libx32.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.libexec.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.local.bin.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.local.sbin.*"] = "apparmor.xml";
-    extensionToXmlFileName["usr.local.lib*"] = "apparmor.xml";
-    extensionToXmlFileName["opt.*"] = "apparmor.xml";
-    extensionToXmlFileName["etc.cron.*"] = "apparmor.xml";
-    extensionToXmlFileName["*.ppd"] = "ppd.xml";
-    extensionToXmlFileName["*.lua"] = "lua.xml";
-    extensionToXmlFileName["*.ldif"] = "ldif.xml";
-    extensionToXmlFileName["*.mel"] = "mel.xml";
-    extensionToXmlFileName["*.sql"] = "sql-postgresql.xml";
-    extensionToXmlFileName["*.SQL"] = "sql-postgresql.xml";
-    extensionToXmlFileName["*.ddl"] = "sql-postgresql.xml";
-    extensionToXmlFileName["*.DDL"] = "sql-postgresql.xml";
-    extensionToXmlFileName["*.bat"] = "dosbat.xml";
-    extensionToXmlFileName["*.asm"] = "asm6502.xml";
-    extensionToXmlFileName["*.cgis"] = "cgis.xml";
-    extensionToXmlFileName["*.mustache"] = "mustache.xml";
-    extensionToXmlFileName["*.handlebars"] = "mustache.xml";
-    extensionToXmlFileName["*.hbs"] = "mustache.xml";
-    extensionToXmlFileName["*.ractive"] = "mustache.xml";
-    extensionToXmlFileName["*.hogan"] = "mustache.xml";
-    extensionToXmlFileName["*.hulk"] = "mustache.xml";
-    extensionToXmlFileName["*.html.mst"] = "mustache.xml";
-    extensionToXmlFileName["*.html.mu"] = "mustache.xml";
-    extensionToXmlFileName["*.html.rac"] = "mustache.xml";
-    extensionToXmlFileName["*.csv"] = "csv.xml";
-    extensionToXmlFileName["*module-info.java"] = "java-module.xml";
-    extensionToXmlFileName["*module-info.jav"] = "java-module.xml";
-    extensionToXmlFileName["*.css"] = "css.xml";
-    extensionToXmlFileName["*.for"] = "fortran-fixed.xml";
-    extensionToXmlFileName["*.FOR"] = "fortran-fixed.xml";
-    extensionToXmlFileName["*.fpp"] = "fortran-fixed.xml";
-    extensionToXmlFileName["*.FPP"] = "fortran-fixed.xml";
-    extensionToXmlFileName["*.less"] = "less.xml";
-    extensionToXmlFileName["*.vcc"] = "varnishcc4.xml";
-    extensionToXmlFileName["*.as"] = "actionscript.xml";
-    extensionToXmlFileName["*.vr"] = "vera.xml";
-    extensionToXmlFileName["*.vri"] = "vera.xml";
-    extensionToXmlFileName["*.vrh"] = "vera.xml";
-    extensionToXmlFileName["*.jsx"] = "javascript-react.xml";
-    extensionToXmlFileName["*.haml"] = "haml.xml";
-    extensionToXmlFileName["*.sgml"] = "sgml.xml";
-    extensionToXmlFileName["*.mml"] = "carto-css-mml.xml";
-    extensionToXmlFileName["*.smali"] = "smali.xml";
-    extensionToXmlFileName["*.csh"] = "tcsh.xml";
-    extensionToXmlFileName["*.tcsh"] = "tcsh.xml";
-    extensionToXmlFileName["*csh.cshrc"] = "tcsh.xml";
-    extensionToXmlFileName["*csh.login"] = "tcsh.xml";
-    extensionToXmlFileName["*.tcshrc"] = "tcsh.xml";
-    extensionToXmlFileName["*.cshrc"] = "tcsh.xml";
-    extensionToXmlFileName["*.login"] = "tcsh.xml";
-    extensionToXmlFileName["*.mm"] = "objectivecpp.xml";
-    extensionToXmlFileName["*.h"] = "cpp.xml";
-    extensionToXmlFileName["*.tex"] = "latex.xml";
-    extensionToXmlFileName["*.ltx"] = "latex.xml";
-    extensionToXmlFileName["*.dtx"] = "latex.xml";
-    extensionToXmlFileName["*.sty"] = "latex.xml";
-    extensionToXmlFileName["*.cls"] = "latex.xml";
-    extensionToXmlFileName["*.bbx"] = "latex.xml";
-    extensionToXmlFileName["*.cbx"] = "latex.xml";
-    extensionToXmlFileName["*.lbx"] = "latex.xml";
-    extensionToXmlFileName["*.tikz"] = "latex.xml";
-    extensionToXmlFileName["*.pgf"] = "latex.xml";
-    extensionToXmlFileName["*.nsi"] = "nsis.xml";
-    extensionToXmlFileName["*.n"] = "nemerle.xml";
-    extensionToXmlFileName["*.rib"] = "rib.xml";
-    extensionToXmlFileName["*.rtf"] = "rtf.xml";
-    extensionToXmlFileName["*.pig"] = "pig.xml";
-    extensionToXmlFileName["*.gpr"] = "gpr.xml";
-    extensionToXmlFileName["*.ex"] = "elixir.xml";
-    extensionToXmlFileName["*.exs"] = "elixir.xml";
-    extensionToXmlFileName["*.eex"] = "elixir.xml";
-    extensionToXmlFileName["*.xml.eex"] = "elixir.xml";
-    extensionToXmlFileName["*.js.eex"] = "elixir.xml";
-    extensionToXmlFileName["*.tla"] = "tlaplus.xml";
-    extensionToXmlFileName["*.vpr"] = "viper.xml";
-    extensionToXmlFileName["*.pure"] = "pure.xml";
-    extensionToXmlFileName["*.mib"] = "mib.xml";
-    extensionToXmlFileName["*.ha"] = "hare.xml";
-    extensionToXmlFileName["*.rules"] = "snort_suricata.xml";
-    extensionToXmlFileName["*.snort"] = "snort_suricata.xml";
-    extensionToXmlFileName["*.suricata"] = "snort_suricata.xml";
-    extensionToXmlFileName["*.proto"] = "protobuf.xml";
-    extensionToXmlFileName["*.feature"] = "gherkin.xml";
-    extensionToXmlFileName["*.ad"] = "asciidoc.xml";
-    extensionToXmlFileName["*.adoc"] = "asciidoc.xml";
-    extensionToXmlFileName["*.asciidoc"] = "asciidoc.xml";
-    extensionToXmlFileName["*.adb"] = "ada.xml";
-    extensionToXmlFileName["*.ads"] = "ada.xml";
-    extensionToXmlFileName["*.ada"] = "ada.xml";
-    extensionToXmlFileName["*.a"] = "ada.xml";
-    extensionToXmlFileName["*.xul"] = "xul.xml";
-    extensionToXmlFileName["*.xbl"] = "xul.xml";
-    extensionToXmlFileName["*.JCL"] = "jcl.xml";
-    extensionToXmlFileName["*.jcl"] = "jcl.xml";
-    extensionToXmlFileName["*fstab"] = "fstab.xml";
-    extensionToXmlFileName["*mtab"] = "fstab.xml";
-    extensionToXmlFileName["*.zig"] = "zig.xml";
-    extensionToXmlFileName["*.c++"] = "cpp.xml";
-    extensionToXmlFileName["*.cxx"] = "cpp.xml";
-    extensionToXmlFileName["*.cpp"] = "cpp.xml";
-    extensionToXmlFileName["*.cc"] = "cpp.xml";
-    extensionToXmlFileName["*.C"] = "cpp.xml";
-    extensionToXmlFileName["*.hh"] = "cpp.xml";
-    extensionToXmlFileName["*.H"] = "cpp.xml";
-    extensionToXmlFileName["*.h++"] = "cpp.xml";
-    extensionToXmlFileName["*.hxx"] = "cpp.xml";
-    extensionToXmlFileName["*.hpp"] = "cpp.xml";
-    extensionToXmlFileName["*.hcc"] = "cpp.xml";
-    extensionToXmlFileName["*.moc"] = "cpp.xml";
-    extensionToXmlFileName["*.znn"] = "zonnon.xml";
-    extensionToXmlFileName["*.nix"] = "nix.xml";
-    extensionToXmlFileName["*.chicken"] = "chicken.xml";
-    extensionToXmlFileName["*.scm"] = "scheme.xml";
-    extensionToXmlFileName["*.ss"] = "scheme.xml";
-    extensionToXmlFileName["*.scheme"] = "scheme.xml";
-    extensionToXmlFileName["*.meta"] = "chicken.xml";
-    extensionToXmlFileName["Kconfig*"] = "kconfig.xml";
-    extensionToXmlFileName["*.cash"] = "cashscript.xml";
-    extensionToXmlFileName["*.scss"] = "scss.xml";
-    extensionToXmlFileName["*.desktop"] = "desktop.xml";
-    extensionToXmlFileName["*.kdelnk"] = "desktop.xml";
-    extensionToXmlFileName["*.desktop.cmake"] = "desktop.xml";
-    extensionToXmlFileName["*.rst"] = "rest.xml";
-    extensionToXmlFileName["*.hex"] = "intelhex.xml";
-    extensionToXmlFileName["*.ihx"] = "intelhex.xml";
-    extensionToXmlFileName["*.mod"] = "modula-2-pim-only.xml";
-    extensionToXmlFileName["*.def"] = "modula-2-pim-only.xml";
-    extensionToXmlFileName["*.mi"] = "modula-2.xml";
-    extensionToXmlFileName["*.md"] = "markdown.xml";
-    extensionToXmlFileName["*.ld"] = "ld.xml";
-    extensionToXmlFileName["*.s"] = "asm-m68k.xml";
-    extensionToXmlFileName["*.i"] = "asm-m68k.xml";
-    extensionToXmlFileName["*.S"] = "asm-m68k.xml";
-    extensionToXmlFileName["*.I"] = "asm-m68k.xml";
-    extensionToXmlFileName["*.log"] = "logfile.xml";
-    extensionToXmlFileName["*.log.*"] = "logfile.xml";
-    extensionToXmlFileName["*syslog"] = "logfile.xml";
-    extensionToXmlFileName["syslog.*"] = "logfile.xml";
-    extensionToXmlFileName["*.kdesrc-buildrc"] = "kdesrc-buildrc.xml";
-    extensionToXmlFileName["*kdesrc-buildrc"] = "kdesrc-buildrc.xml";
-    extensionToXmlFileName["*.t2t"] = "txt2tags.xml";
-    extensionToXmlFileName["*gitolite.conf"] = "gitolite.xml";
-    extensionToXmlFileName["*.kbasic"] = "kbasic.xml";
-    extensionToXmlFileName["*.reg"] = "winehq.xml";
-    extensionToXmlFileName["*.po"] = "gettext.xml";
-    extensionToXmlFileName["*.pot"] = "gettext.xml";
-    extensionToXmlFileName["*.mup"] = "mup.xml";
-    extensionToXmlFileName["*.not"] = "mup.xml";
-    extensionToXmlFileName["*.tsv"] = "tsv.xml";
-    extensionToXmlFileName["*.tab"] = "tsv.xml";
-    extensionToXmlFileName["*.cr"] = "crystal.xml";
-    extensionToXmlFileName["*.json"] = "json.xml";
-    extensionToXmlFileName["*.kateproject"] = "json.xml";
-    extensionToXmlFileName["*.arcconfig"] = "json.xml";
-    extensionToXmlFileName["*.gltf"] = "json.xml";
-    extensionToXmlFileName["*.sv"] = "systemverilog.xml";
-    extensionToXmlFileName["*.svh"] = "systemverilog.xml";
-    extensionToXmlFileName["*httpd.conf"] = "apache.xml";
-    extensionToXmlFileName["*httpd2.conf"] = "apache.xml";
-    extensionToXmlFileName["*apache.conf"] = "apache.xml";
-    extensionToXmlFileName["*apache2.conf"] = "apache.xml";
-    extensionToXmlFileName[".htaccess*"] = "apache.xml";
-    extensionToXmlFileName[".htpasswd*"] = "apache.xml";
-    extensionToXmlFileName["*.inf"] = "inform.xml";
-    extensionToXmlFileName["*.fc"] = "selinux-fc.xml";
-    extensionToXmlFileName["*file_contexts"] = "selinux-fc.xml";
-    extensionToXmlFileName["*file_contexts.local"] = "selinux-fc.xml";
-    extensionToXmlFileName["*file_contexts.homedirs"] = "selinux-fc.xml";
-    extensionToXmlFileName["*file_contexts.template"] = "selinux-fc.xml";
-    extensionToXmlFileName["*homedir_template"] = "selinux-fc.xml";
-    extensionToXmlFileName["*.rpy"] = "renpy.xml";
-    extensionToXmlFileName["*.lisp"] = "commonlisp.xml";
-    extensionToXmlFileName["*.cl"] = "opencl.xml";
-    extensionToXmlFileName["*.lsp"] = "commonlisp.xml";
-    extensionToXmlFileName["*.cob"] = "cobol.xml";
-    extensionToXmlFileName["*.cbl"] = "cobol.xml";
-    extensionToXmlFileName["*.cpy"] = "cobol.xml";
-    extensionToXmlFileName["*.copy"] = "cobol.xml";
-    extensionToXmlFileName["*.lst"] = "cobol.xml";
-    extensionToXmlFileName["*.pco"] = "cobol.xml";
-    extensionToXmlFileName["*.scb"] = "cobol.xml";
-    extensionToXmlFileName["*.sqb"] = "cobol.xml";
-    extensionToXmlFileName["*.vm"] = "velocity.xml";
-    extensionToXmlFileName["*.e"] = "euphoria.xml";
-    extensionToXmlFileName["*.exw"] = "euphoria.xml";
-    extensionToXmlFileName["*.exu"] = "euphoria.xml";
-    extensionToXmlFileName["*.c"] = "c.xml";
-    extensionToXmlFileName["*.cfm"] = "coldfusion.xml";
-    extensionToXmlFileName["*.cfc"] = "coldfusion.xml";
-    extensionToXmlFileName["*.cfml"] = "coldfusion.xml";
-    extensionToXmlFileName["*.dbm"] = "coldfusion.xml";
-    extensionToXmlFileName["*.textproto"] = "textproto.xml";
-    extensionToXmlFileName["*.textpb"] = "textproto.xml";
-    extensionToXmlFileName["*.pbtxt"] = "textproto.xml";
-    extensionToXmlFileName["*.Praat"] = "praat.xml";
-    extensionToXmlFileName["*.praat"] = "praat.xml";
-    extensionToXmlFileName["*.psc"] = "praat.xml";
-    extensionToXmlFileName["*.praat-script"] = "praat.xml";
-    extensionToXmlFileName["*.praatscript"] = "praat.xml";
-    extensionToXmlFileName["*.proc"] = "praat.xml";
-    extensionToXmlFileName["*.xsl"] = "xslt.xml";
-    extensionToXmlFileName["*.xslt"] = "xslt.xml";
-    extensionToXmlFileName["*.f90"] = "fortran-free.xml";
-    extensionToXmlFileName["*.F90"] = "fortran-free.xml";
-    extensionToXmlFileName["*.f95"] = "fortran-free.xml";
-    extensionToXmlFileName["*.F95"] = "fortran-free.xml";
-    extensionToXmlFileName["*.f03"] = "fortran-free.xml";
-    extensionToXmlFileName["*.F03"] = "fortran-free.xml";
-    extensionToXmlFileName["*.f08"] = "fortran-free.xml";
-    extensionToXmlFileName["*.F08"] = "fortran-free.xml";
-    extensionToXmlFileName["*.eml"] = "email.xml";
-    extensionToXmlFileName["*.email"] = "email.xml";
-    extensionToXmlFileName["*.emlx"] = "email.xml";
-    extensionToXmlFileName["*.mbox"] = "email.xml";
-    extensionToXmlFileName["*.mbx"] = "email.xml";
-    extensionToXmlFileName["*.spec"] = "rpmspec.xml";
-    extensionToXmlFileName["*.dtd"] = "dtd.xml";
-    extensionToXmlFileName["*.asn"] = "asn1.xml";
-    extensionToXmlFileName["*.asn1"] = "asn1.xml";
-    extensionToXmlFileName["*.typ"] = "typst.xml";
-    extensionToXmlFileName["*.pgn"] = "pgn.xml";
-    extensionToXmlFileName["*.PGN"] = "pgn.xml";
-    extensionToXmlFileName["*.aff"] = "hunspell-aff.xml";
-    extensionToXmlFileName["*.sp"] = "spice.xml";
-    extensionToXmlFileName["*.hsp"] = "spice.xml";
-    extensionToXmlFileName["*.q"] = "q.xml";
-    extensionToXmlFileName["*.pl"] = "perl.xml";
-    extensionToXmlFileName["*.PL"] = "perl.xml";
-    extensionToXmlFileName["*.pm"] = "perl.xml";
-    extensionToXmlFileName["*.pl6"] = "raku.xml";
-    extensionToXmlFileName["*.PL6"] = "raku.xml";
-    extensionToXmlFileName["*.p6"] = "raku.xml";
-    extensionToXmlFileName["*.pm6"] = "raku.xml";
-    extensionToXmlFileName["*.gcode"] = "klipper-gcode.xml";
-    extensionToXmlFileName["*.d"] = "d.xml";
-    extensionToXmlFileName["*.D"] = "d.xml";
-    extensionToXmlFileName["*.di"] = "d.xml";
-    extensionToXmlFileName["*.DI"] = "d.xml";
-    extensionToXmlFileName["*.lsl"] = "lsl.xml";
-    extensionToXmlFileName["*.rmd"] = "rmarkdown.xml";
-    extensionToXmlFileName["*.Rmd"] = "rmarkdown.xml";
-    extensionToXmlFileName["*.RMD"] = "rmarkdown.xml";
-    extensionToXmlFileName["*Doxyfile"] = "doxyfile.xml";
-    extensionToXmlFileName["Doxyfile.*"] = "doxyfile.xml";
-    extensionToXmlFileName["*.sh"] = "zsh.xml";
-    extensionToXmlFileName["*.zsh"] = "zsh.xml";
-    extensionToXmlFileName["*.zshrc"] = "zsh.xml";
-    extensionToXmlFileName["*.zprofile"] = "zsh.xml";
-    extensionToXmlFileName["*.zlogin"] = "zsh.xml";
-    extensionToXmlFileName["*.zlogout"] = "zsh.xml";
-    extensionToXmlFileName["*.profile"] = "zsh.xml";
-    extensionToXmlFileName["*.v"] = "v.xml";
-    extensionToXmlFileName["*.vh"] = "v.xml";
-    extensionToXmlFileName["*.vsh"] = "v.xml";
-    extensionToXmlFileName["*.vb"] = "monobasic.xml";
-    extensionToXmlFileName["*.gdbinit"] = "gdbinit.xml";
-    extensionToXmlFileName["*.g4"] = "antlr.xml";
-    extensionToXmlFileName["*.rqb"] = "rapidq.xml";
-    extensionToXmlFileName["*.odin"] = "odin.xml";
-    extensionToXmlFileName["*.pbl"] = "wml.xml";
-    extensionToXmlFileName["*.CFG"] = "wml.xml";
-    extensionToXmlFileName["*.PBL"] = "wml.xml";
-    extensionToXmlFileName["*.iCal"] = "vcard.xml";
-    extensionToXmlFileName["*.iCalendar"] = "vcard.xml";
-    extensionToXmlFileName["*.ics"] = "vcard.xml";
-    extensionToXmlFileName["*.ifb"] = "vcard.xml";
-    extensionToXmlFileName["*.iFBf"] = "vcard.xml";
-    extensionToXmlFileName["*.vcal"] = "vcard.xml";
-    extensionToXmlFileName["*.vcalendar"] = "vcard.xml";
-    extensionToXmlFileName["*.vcard"] = "vcard.xml";
-    extensionToXmlFileName["*.vcf"] = "vcard.xml";
-    extensionToXmlFileName["*.groovy"] = "groovy.xml";
-    extensionToXmlFileName["*.gradle"] = "groovy.xml";
-    extensionToXmlFileName["*.fastq"] = "fastq.xml";
-    extensionToXmlFileName["*.fq"] = "fastq.xml";
-    extensionToXmlFileName["*.fastq.gz"] = "fastq.xml";
-    extensionToXmlFileName["*.fq.gz"] = "fastq.xml";
-    extensionToXmlFileName["*.sass"] = "sass.xml";
-    extensionToXmlFileName["*.tjp"] = "taskjuggler.xml";
-    extensionToXmlFileName["*.tji"] = "taskjuggler.xml";
-    extensionToXmlFileName["*.properties"] = "java-properties.xml";
-    extensionToXmlFileName["*.oors"] = "oors.xml";
-    extensionToXmlFileName["*.rs"] = "rust.xml";
-    extensionToXmlFileName["*.awk"] = "awk.xml";
-    extensionToXmlFileName["*.ts"] = "typescript.xml";
-    extensionToXmlFileName["*.mts"] = "typescript.xml";
-    extensionToXmlFileName["*.cts"] = "typescript.xml";
-    extensionToXmlFileName["*.fish"] = "fish.xml";
-    extensionToXmlFileName["fishd.*"] = "fish.xml";
-    extensionToXmlFileName["*.gnuplot"] = "gnuplot.xml";
-    extensionToXmlFileName["*.gp"] = "gnuplot.xml";
-    extensionToXmlFileName["*.gplt,*.plt"] = "gnuplot.xml";
-    extensionToXmlFileName["*Dockerfile"] = "dockerfile.xml";
-    extensionToXmlFileName["*.yar"] = "yara.xml";
-    extensionToXmlFileName["*.yara"] = "yara.xml";
-    extensionToXmlFileName["*.prolog"] = "prolog.xml";
-    extensionToXmlFileName["*.dcg"] = "prolog.xml";
-    extensionToXmlFileName["*.opsiinc"] = "opsiscript.xml";
-    extensionToXmlFileName["*.opsiscript"] = "opsiscript.xml";
-    extensionToXmlFileName["*.ctx"] = "context.xml";
-    extensionToXmlFileName["*.ys"] = "yacas.xml";
-    extensionToXmlFileName["*.jira"] = "jira.xml";
-    extensionToXmlFileName["*.ans"] = "ansys.xml";
-    extensionToXmlFileName["*.obj"] = "wavefront-obj.xml";
-    extensionToXmlFileName["*.ahdl"] = "ahdl.xml";
-    extensionToXmlFileName["*.tdf"] = "ahdl.xml";
-    extensionToXmlFileName["*.dox"] = "doxygen.xml";
-    extensionToXmlFileName["*.doxygen"] = "doxygen.xml";
-    extensionToXmlFileName["*.mp"] = "metafont.xml";
-    extensionToXmlFileName["*.mps"] = "metafont.xml";
-    extensionToXmlFileName["*.mpost"] = "metafont.xml";
-    extensionToXmlFileName["*.mf"] = "metafont.xml";
-    extensionToXmlFileName["*.srt"] = "subrip-subtitles.xml";
-    extensionToXmlFileName["*.yang"] = "yang.xml";
-    extensionToXmlFileName["*.ps1"] = "powershell.xml";
-    extensionToXmlFileName["*.ps1m"] = "powershell.xml";
-    extensionToXmlFileName["*.ps1d"] = "powershell.xml";
-    extensionToXmlFileName["*.diff"] = "diff.xml";
-    extensionToXmlFileName["*patch"] = "diff.xml";
-    extensionToXmlFileName["*.stl"] = "stl.xml";
-    extensionToXmlFileName["*.org"] = "orgmode.xml";
-    extensionToXmlFileName["*.toml"] = "toml.xml";
-    extensionToXmlFileName["*.cabal"] = "cabal.xml";
-    extensionToXmlFileName["*cabal.config"] = "cabal.xml";
-    extensionToXmlFileName["*cabal.project"] = "cabal.xml";
-    extensionToXmlFileName["*cabal.project.freeze"] = "cabal.xml";
-    extensionToXmlFileName["*cabal.project.local"] = "cabal.xml";
-    extensionToXmlFileName["*.js"] = "javascript.xml";
-    extensionToXmlFileName["*.kwinscript"] = "javascript.xml";
-    extensionToXmlFileName["*.julius"] = "javascript.xml";
-    extensionToXmlFileName["*.hamlet"] = "hamlet.xml";
-    extensionToXmlFileName["*.vala"] = "vala.xml";
-    extensionToXmlFileName["*.ninja"] = "ninja.xml";
-    extensionToXmlFileName["*.nb"] = "mathematica.xml";
-    extensionToXmlFileName["*.rhtml"] = "rhtml.xml";
-    extensionToXmlFileName["*.RHTML"] = "rhtml.xml";
-    extensionToXmlFileName["*.html.erb"] = "rhtml.xml";
-    extensionToXmlFileName["*.bash"] = "bash.xml";
-    extensionToXmlFileName["*.ebuild"] = "bash.xml";
-    extensionToXmlFileName["*.eclass"] = "bash.xml";
-    extensionToXmlFileName["*.bashrc"] = "bash.xml";
-    extensionToXmlFileName["*.bash_profile"] = "bash.xml";
-    extensionToXmlFileName["*.bash_login"] = "bash.xml";
-    extensionToXmlFileName["*PKGBUILD"] = "bash.xml";
-    extensionToXmlFileName["*APKBUILD"] = "bash.xml";
-    extensionToXmlFileName["*.fbs"] = "flatbuffers.xml";
-    extensionToXmlFileName["*.php"] = "html-php.xml";
-    extensionToXmlFileName["*.php3"] = "html-php.xml";
-    extensionToXmlFileName["*.wml"] = "html-php.xml";
-    extensionToXmlFileName["*.phtml"] = "html-php.xml";
-    extensionToXmlFileName["*.phtm"] = "html-php.xml";
-    extensionToXmlFileName["*.iss"] = "innosetup.xml";
-    extensionToXmlFileName["*.mly"] = "ocamlyacc.xml";
-    extensionToXmlFileName["*.scala"] = "scala.xml";
-    extensionToXmlFileName["*.sbt"] = "scala.xml";
-    extensionToXmlFileName["*.ml"] = "ocaml.xml";
-    extensionToXmlFileName["*.mli"] = "ocaml.xml";
-    extensionToXmlFileName["*.sol"] = "solidity.xml";
-    extensionToXmlFileName["*.curry"] = "curry.xml";
-    extensionToXmlFileName["*.gd"] = "gd-script.xml";
-    extensionToXmlFileName["*.gi"] = "gap.xml";
-    extensionToXmlFileName["*.g"] = "gap.xml";
-    extensionToXmlFileName["*.fasm"] = "fasm.xml";
-    extensionToXmlFileName["*.mediawiki"] = "mediawiki.xml";
-    extensionToXmlFileName["*.overpassql"] = "overpassql.xml";
-    extensionToXmlFileName["*.tt*"] = "template-toolkit.xml";
-    extensionToXmlFileName["*nginx.conf"] = "nginx.xml";
-    extensionToXmlFileName["*.nginx"] = "nginx.xml";
-    extensionToXmlFileName["*.swift"] = "swift.xml";
-    extensionToXmlFileName["*.erl"] = "erlang.xml";
-    extensionToXmlFileName["*.prg"] = "xharbour.xml";
-    extensionToXmlFileName["*.PRG"] = "xharbour.xml";
-    extensionToXmlFileName["*.ch"] = "xharbour.xml";
-    extensionToXmlFileName["*.dat"] = "hunspell-dat.xml";
-    extensionToXmlFileName["*.gdb"] = "gdb.xml";
-    extensionToXmlFileName["*.rng"] = "relaxng.xml";
-    extensionToXmlFileName["*.RNG"] = "relaxng.xml";
-    extensionToXmlFileName["*.purs"] = "purescript.xml";
-    extensionToXmlFileName["*.mag"] = "magma.xml";
-    extensionToXmlFileName["*.clist"] = "clist.xml";
-    extensionToXmlFileName["*.CLIST"] = "clist.xml";
-    extensionToXmlFileName["*asterisk/*.conf"] = "asterisk.xml";
-    extensionToXmlFileName["*.abc"] = "abc.xml";
-    extensionToXmlFileName["*.ABC"] = "abc.xml";
-    extensionToXmlFileName["*GNUmakefile"] = "makefile.xml";
-    extensionToXmlFileName["*Makefile"] = "makefile.xml";
-    extensionToXmlFileName["*makefile"] = "makefile.xml";
-    extensionToXmlFileName["GNUmakefile.*"] = "makefile.xml";
-    extensionToXmlFileName["Makefile.*"] = "makefile.xml";
-    extensionToXmlFileName["makefile.*"] = "makefile.xml";
-    extensionToXmlFileName["*.mk"] = "makefile.xml";
-    extensionToXmlFileName["*.te"] = "selinux.xml";
-    extensionToXmlFileName["*.if"] = "selinux.xml";
-    extensionToXmlFileName["*.spt"] = "selinux.xml";
-    extensionToXmlFileName["*policy.conf"] = "selinux.xml";
-    extensionToXmlFileName["*access_vectors"] = "selinux.xml";
-    extensionToXmlFileName["*mls"] = "selinux.xml";
-    extensionToXmlFileName["*mcs"] = "selinux.xml";
-    extensionToXmlFileName["*mls_macros"] = "selinux.xml";
-    extensionToXmlFileName["*te_macros"] = "selinux.xml";
-    extensionToXmlFileName["*policy_capabilities"] = "selinux.xml";
-    extensionToXmlFileName["*seapp_contexts"] = "selinux.xml";
-    extensionToXmlFileName["*port_contexts"] = "selinux.xml";
-    extensionToXmlFileName["*.guile"] = "scheme.xml";
-    extensionToXmlFileName["*ChangeLog"] = "changelog.xml";
-    extensionToXmlFileName["*.1"] = "mandoc.xml";
-    extensionToXmlFileName["*.2"] = "mandoc.xml";
-    extensionToXmlFileName["*.3"] = "mandoc.xml";
-    extensionToXmlFileName["*.4"] = "mandoc.xml";
-    extensionToXmlFileName["*.5"] = "mandoc.xml";
-    extensionToXmlFileName["*.6"] = "mandoc.xml";
-    extensionToXmlFileName["*.7"] = "mandoc.xml";
-    extensionToXmlFileName["*.8"] = "mandoc.xml";
-    extensionToXmlFileName["*.1m"] = "mandoc.xml";
-    extensionToXmlFileName["*.3x"] = "mandoc.xml";
-    extensionToXmlFileName["*.tmac"] = "mandoc.xml";
-    extensionToXmlFileName["*.replicode"] = "replicode.xml";
-    extensionToXmlFileName["*.qface"] = "qface.xml";
-    extensionToXmlFileName["*.kcrash"] = "gdb-bt.xml";
-    extensionToXmlFileName["*.crash"] = "gdb-bt.xml";
-    extensionToXmlFileName["*.bt"] = "gdb-bt.xml";
-    extensionToXmlFileName["*control"] = "debiancontrol.xml";
-    extensionToXmlFileName["*.Rd"] = "rdoc.xml";
-    extensionToXmlFileName["*.go"] = "go.xml";
-    extensionToXmlFileName["*.mch"] = "bmethod.xml";
-    extensionToXmlFileName["*.imp"] = "bmethod.xml";
-    extensionToXmlFileName["*.ref"] = "bmethod.xml";
-    extensionToXmlFileName["*.ahk"] = "ahk.xml";
-    extensionToXmlFileName["*.iahk"] = "ahk.xml";
-    extensionToXmlFileName["*.k"] = "k.xml";
-    extensionToXmlFileName["*.vtc"] = "varnishtest4.xml";
-    extensionToXmlFileName["*.raku"] = "raku.xml";
-    extensionToXmlFileName["*.rakumod"] = "raku.xml";
-    extensionToXmlFileName["*.rakudoc"] = "raku.xml";
-    extensionToXmlFileName["*.rakutest"] = "raku.xml";
-    extensionToXmlFileName["*.pod6"] = "raku.xml";
-    extensionToXmlFileName["*.clj"] = "clojure.xml";
-    extensionToXmlFileName["*.cljs"] = "clojure.xml";
-    extensionToXmlFileName["*.cljc"] = "clojure.xml";
-    extensionToXmlFileName["*.texi"] = "texinfo.xml";
-    extensionToXmlFileName["*.src"] = "picsrc.xml";
-    extensionToXmlFileName["*.SRC"] = "picsrc.xml";
-    extensionToXmlFileName["*.ASM"] = "picsrc.xml";
-    extensionToXmlFileName["*.pic"] = "picsrc.xml";
-    extensionToXmlFileName["*.PIC"] = "picsrc.xml";
-    extensionToXmlFileName["*.cp"] = "component-pascal.xml";
-    extensionToXmlFileName["*.bro"] = "component-pascal.xml";
-    extensionToXmlFileName["*meson.build"] = "meson.xml";
-    extensionToXmlFileName["*meson_options.txt"] = "meson.xml";
-    extensionToXmlFileName["*.hs"] = "haskell.xml";
-    extensionToXmlFileName["*.chs"] = "haskell.xml";
-    extensionToXmlFileName["*.hs-boot"] = "haskell.xml";
-    extensionToXmlFileName["*.sed"] = "sed.xml";
-    extensionToXmlFileName["*.mmd"] = "markdown.xml";
-    extensionToXmlFileName["*.markdown"] = "markdown.xml";
-    extensionToXmlFileName["*.stan"] = "stan.xml";
-    extensionToXmlFileName["*.stanfunctions"] = "stan.xml";
-    extensionToXmlFileName["*.lgt"] = "logtalk.xml";
-    extensionToXmlFileName["*.config"] = "logtalk.xml";
-    extensionToXmlFileName["*.dic"] = "hunspell-dic.xml";
-    extensionToXmlFileName["*.il"] = "cil.xml";
-    extensionToXmlFileName["*.graphql"] = "graphql.xml";
-    extensionToXmlFileName["*.per"] = "fgl-per.xml";
-    extensionToXmlFileName["*.PER"] = "fgl-per.xml";
-    extensionToXmlFileName["*.per.err"] = "fgl-per.xml";
-    extensionToXmlFileName["*.tcl"] = "tcl.xml";
-    extensionToXmlFileName["*.tk"] = "tcl.xml";
-    extensionToXmlFileName["*.twig"] = "twig.xml";
-    extensionToXmlFileName["*.tig"] = "tiger.xml";
-    extensionToXmlFileName["*todo.txt"] = "todo.xml";
-    extensionToXmlFileName["*.l"] = "lex.xml";
-    extensionToXmlFileName["*.lex"] = "lex.xml";
-    extensionToXmlFileName["*.flex"] = "lex.xml";
-    extensionToXmlFileName["*.agda"] = "agda.xml";
-    extensionToXmlFileName["*.textile"] = "textile.xml";
-    extensionToXmlFileName["*.gdf"] = "glosstex.xml";
-    extensionToXmlFileName["*.bb"] = "bitbake.xml";
-    extensionToXmlFileName["*.bbappend"] = "bitbake.xml";
-    extensionToXmlFileName["*.bbclass"] = "bitbake.xml";
-    extensionToXmlFileName["*.kt"] = "kotlin.xml";
-    extensionToXmlFileName["*.kts"] = "kotlin.xml";
-    extensionToXmlFileName["*.crk"] = "crk.xml";
-    extensionToXmlFileName["*.mac"] = "maxima.xml";
-    extensionToXmlFileName["*.MAC"] = "maxima.xml";
-    extensionToXmlFileName["*.dem"] = "maxima.xml";
-    extensionToXmlFileName["*.DEM"] = "maxima.xml";
-    extensionToXmlFileName["*.sst"] = "sisu.xml";
-    extensionToXmlFileName["*.ssm"] = "sisu.xml";
-    extensionToXmlFileName["*.ssi"] = "sisu.xml";
-    extensionToXmlFileName["*._sst"] = "sisu.xml";
-    extensionToXmlFileName["*.-sst"] = "sisu.xml";
-    extensionToXmlFileName["*.wrl"] = "vrml.xml";
-    extensionToXmlFileName["*.pb"] = "purebasic.xml";
-    extensionToXmlFileName["*.pbi"] = "purebasic.xml";
-    extensionToXmlFileName["*.jsp"] = "jsp.xml";
-    extensionToXmlFileName["*.JSP"] = "jsp.xml";
-    extensionToXmlFileName["*.boo"] = "boo.xml";
-    extensionToXmlFileName["*.idr"] = "idris.xml";
-    extensionToXmlFileName["*.V"] = "verilog.xml";
-    extensionToXmlFileName["*.vl"] = "verilog.xml";
-    extensionToXmlFileName["*.cil"] = "selinux-cil.xml";
-    extensionToXmlFileName["*.sci"] = "sci.xml";
-    extensionToXmlFileName["*.sce"] = "sci.xml";
-    extensionToXmlFileName["*.p"] = "pascal.xml";
-    extensionToXmlFileName["*.pas"] = "pascal.xml";
-    extensionToXmlFileName["*.rnc"] = "relaxngcompact.xml";
-    extensionToXmlFileName["*.ccss"] = "ccss.xml";
-    extensionToXmlFileName["*.mss"] = "carto-css.xml";
-    extensionToXmlFileName["*.ps"] = "postscript.xml";
-    extensionToXmlFileName["*.ai"] = "postscript.xml";
-    extensionToXmlFileName["*.eps"] = "postscript.xml";
-    extensionToXmlFileName["*.sml"] = "sml.xml";
-    extensionToXmlFileName["*.py"] = "python.xml";
-    extensionToXmlFileName["*.pyw"] = "python.xml";
-    extensionToXmlFileName["*SConstruct"] = "python.xml";
-    extensionToXmlFileName["*SConscript"] = "python.xml";
-    extensionToXmlFileName["*.dats"] = "ats.xml";
-    extensionToXmlFileName["*.sats"] = "ats.xml";
-    extensionToXmlFileName["*.hats"] = "ats.xml";
-    extensionToXmlFileName["*.ample"] = "ample.xml";
-    extensionToXmlFileName["*.menu"] = "ample.xml";
-    extensionToXmlFileName["*.startup"] = "ample.xml";
-    extensionToXmlFileName["*.rex"] = "rexx.xml";
-    extensionToXmlFileName["*.t"] = "tads3.xml";
-    extensionToXmlFileName["*.mako"] = "mako.xml";
-    extensionToXmlFileName["*.mak"] = "mako.xml";
-    extensionToXmlFileName["*.elm"] = "elm.xml";
-    extensionToXmlFileName["*.rkt"] = "racket.xml";
-    extensionToXmlFileName["*.scrbl"] = "racket.xml";
-    extensionToXmlFileName["*.vhdl"] = "vhdl.xml";
-    extensionToXmlFileName["*.vhd"] = "vhdl.xml";
-    extensionToXmlFileName["*.vue"] = "vue.xml";
-    extensionToXmlFileName["*.java"] = "java.xml";
-    extensionToXmlFileName["*.qdocconf"] = "qdocconf.xml";
-    extensionToXmlFileName["*.lcurry"] = "literate-curry.xml";
-    extensionToXmlFileName["*.brs"] = "brightscript.xml";
-    extensionToXmlFileName["*.ply"] = "ply.xml";
-    extensionToXmlFileName["*.ly"] = "lilypond.xml";
-    extensionToXmlFileName["*.LY"] = "lilypond.xml";
-    extensionToXmlFileName["*.ily"] = "lilypond.xml";
-    extensionToXmlFileName["*.ILY"] = "lilypond.xml";
-    extensionToXmlFileName["*.lyi"] = "lilypond.xml";
-    extensionToXmlFileName["*.LYI"] = "lilypond.xml";
-    extensionToXmlFileName["*.docbook"] = "xml.xml";
-    extensionToXmlFileName["*.xml"] = "xml.xml";
-    extensionToXmlFileName["*.rc"] = "xml.xml";
-    extensionToXmlFileName["*.daml"] = "xml.xml";
-    extensionToXmlFileName["*.rdf"] = "xml.xml";
-    extensionToXmlFileName["*.rss"] = "xml.xml";
-    extensionToXmlFileName["*.xspf"] = "xml.xml";
-    extensionToXmlFileName["*.xsd"] = "xml.xml";
-    extensionToXmlFileName["*.svg"] = "xml.xml";
-    extensionToXmlFileName["*.ui"] = "xml.xml";
-    extensionToXmlFileName["*.kcfg"] = "xml.xml";
-    extensionToXmlFileName["*.qrc"] = "xml.xml";
-    extensionToXmlFileName["*.wsdl"] = "xml.xml";
-    extensionToXmlFileName["*.scxml"] = "xml.xml";
-    extensionToXmlFileName["*.xbel"] = "xml.xml";
-    extensionToXmlFileName["*.dae"] = "xml.xml";
-    extensionToXmlFileName["*.rb"] = "ruby.xml";
-    extensionToXmlFileName["*.rjs"] = "ruby.xml";
-    extensionToXmlFileName["*.rxml"] = "ruby.xml";
-    extensionToXmlFileName["*.xml.erb"] = "ruby.xml";
-    extensionToXmlFileName["*.js.erb"] = "ruby.xml";
-    extensionToXmlFileName["*.rake"] = "ruby.xml";
-    extensionToXmlFileName["*Rakefile"] = "ruby.xml";
-    extensionToXmlFileName["*Gemfile"] = "ruby.xml";
-    extensionToXmlFileName["*.gemspec"] = "ruby.xml";
-    extensionToXmlFileName["*Vagrantfile"] = "ruby.xml";
-    extensionToXmlFileName["*.pug"] = "pug.xml";
-    extensionToXmlFileName["*.jade"] = "pug.xml";
-    extensionToXmlFileName["*.siv"] = "sieve.xml";
-    extensionToXmlFileName["*.sieve"] = "sieve.xml";
-    extensionToXmlFileName["*.do"] = "stata.xml";
-    extensionToXmlFileName[" *.ado"] = "stata.xml";
-    extensionToXmlFileName[" *.doh"] = "stata.xml";
-    extensionToXmlFileName[" *.DO"] = "stata.xml";
-    extensionToXmlFileName[" *.ADO"] = "stata.xml";
-    extensionToXmlFileName[" *.DOH"] = "stata.xml";
-    extensionToXmlFileName["*.scad"] = "openscad.xml";
-    extensionToXmlFileName["*.INC"] = "asm-dsp56k.xml";
-    extensionToXmlFileName["*.m3"] = "modula-3.xml";
-    extensionToXmlFileName["*.i3"] = "modula-3.xml";
-    extensionToXmlFileName["*.ig"] = "modula-3.xml";
-    extensionToXmlFileName["*.mg"] = "modula-3.xml";
-    extensionToXmlFileName["*.mo"] = "modelica.xml";
-    extensionToXmlFileName["*.automount"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.device"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.mount"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.path"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.service"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.slice"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.socket"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.swap"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.target"] = "systemd-unit.xml";
-    extensionToXmlFileName["*.timer"] = "systemd-unit.xml";
-    extensionToXmlFileName["*Earthfile"] = "earthfile.xml";
-    extensionToXmlFileName["*.m4"] = "m4.xml";
-    extensionToXmlFileName["*.asp"] = "asp.xml";
-    extensionToXmlFileName["*.asm-avr"] = "asm-avr.xml";
-    extensionToXmlFileName["*.bas"] = "freebasic.xml";
-    extensionToXmlFileName["*.bi"] = "freebasic.xml";
-    extensionToXmlFileName["*.BAS"] = "freebasic.xml";
-    extensionToXmlFileName["*.BI"] = "freebasic.xml";
-    extensionToXmlFileName["*.4gl"] = "fgl-4gl.xml";
-    extensionToXmlFileName["*.4GL"] = "fgl-4gl.xml";
-    extensionToXmlFileName["*.err"] = "fgl-4gl.xml";
-    extensionToXmlFileName["*.qml"] = "qml.xml";
-    extensionToXmlFileName["*.qmltypes"] = "qml.xml";
-    extensionToXmlFileName["*.pli"] = "pli.xml";
-    extensionToXmlFileName["*.impl"] = "opal.xml";
-    extensionToXmlFileName["*.sign"] = "opal.xml";
-    extensionToXmlFileName["*.nim"] = "nim.xml";
-    extensionToXmlFileName["*.nims"] = "nim.xml";
-    extensionToXmlFileName["*.nimble"] = "nim.xml";
-    extensionToXmlFileName["*.o"] = "lpc.xml";
-    extensionToXmlFileName["*.kateconfig"] = "kateconfig.xml";
-    extensionToXmlFileName["*.tf"] = "terraform.xml";
-    extensionToXmlFileName["*.tfvars"] = "terraform.xml";
-    extensionToXmlFileName["*.cs"] = "cs.xml";
-    extensionToXmlFileName["*.sa"] = "sather.xml";
-    extensionToXmlFileName["*.R"] = "r.xml";
-    extensionToXmlFileName["*.r"] = "r.xml";
-    extensionToXmlFileName["*.retro"] = "retro.xml";
-    extensionToXmlFileName["*.lhs"] = "literate-haskell.xml";
-    extensionToXmlFileName["*.cue"] = "cue.xml";
-    extensionToXmlFileName["*.ino"] = "cpp.xml";
-    extensionToXmlFileName["*.pde"] = "cpp.xml";
-    extensionToXmlFileName["*.pony"] = "pony.xml";
-    extensionToXmlFileName["*git-rebase-todo"] = "git-rebase.xml";
-    extensionToXmlFileName["*.mll"] = "ocamllex.xml";
-    extensionToXmlFileName["*.idl"] = "idl.xml";
-    extensionToXmlFileName["*.trg"] = "sql-oracle.xml";
-    extensionToXmlFileName["*.TRG"] = "sql-oracle.xml";
-    extensionToXmlFileName["*.spc"] = "sql-oracle.xml";
-    extensionToXmlFileName["*.SPC"] = "sql-oracle.xml";
-    extensionToXmlFileName["*.bdy"] = "sql-oracle.xml";
-    extensionToXmlFileName["*.DBY"] = "sql-oracle.xml";
-    extensionToXmlFileName["*.shtml"] = "html.xml";
-    extensionToXmlFileName["*.shtm"] = "html.xml";
-    extensionToXmlFileName["*.dot"] = "dot.xml";
-    extensionToXmlFileName["*.bib"] = "bibtex.xml";
-    extensionToXmlFileName["*.gdl"] = "gdl.xml";
-    extensionToXmlFileName["*.vcg"] = "gdl.xml";
-    extensionToXmlFileName["*.GDL"] = "gdl.xml";
-    extensionToXmlFileName["*.VCG"] = "gdl.xml";
-    extensionToXmlFileName["*.gleam"] = "gleam.xml";
-    extensionToXmlFileName["*.y"] = "yacc.xml";
-    extensionToXmlFileName["*.yy"] = "yacc.xml";
-    extensionToXmlFileName["*.ypp"] = "yacc.xml";
-    extensionToXmlFileName["*.y++"] = "yacc.xml";
-    extensionToXmlFileName["*.idx"] = "hunspell-idx.xml";
-    return extensionToXmlFileName;
-}
-QMap<QString, QString> extensionToXmlFileName = create_extensionToXmlFileName();
+} // namespace
 
-QMap<QString, QString> create_firstLineToXmlFileName() {
-    QMap<QString, QString> firstLineToXmlFileName;
-    firstLineToXmlFileName["\\documentclass"] = "latex.xml";
-    firstLineToXmlFileName["*perl*"] = "perl.xml";
-    firstLineToXmlFileName["Index: *"] = "diff.xml";
-    firstLineToXmlFileName["*bash"] = "bash.xml";
-    firstLineToXmlFileName["*/sh*"] = "bash.xml";
-    firstLineToXmlFileName["<!doctype html*"] = "html-php.xml";
-    firstLineToXmlFileName["<html*"] = "html-php.xml";
-    firstLineToXmlFileName["<?php*"] = "html-php.xml";
-    firstLineToXmlFileName["*python*"] = "python.xml";
-    firstLineToXmlFileName["<!doctype*"] = "xml.xml";
-    firstLineToXmlFileName["<?xml*"] = "xml.xml";
-    return firstLineToXmlFileName;
-}
-QMap<QString, QString> firstLineToXmlFileName = create_firstLineToXmlFileName();
+constexpr LanguageDbTable<LanguageDbEntry> languageNameToXmlFileName = {
+    languageNameToXmlFileNameEntries, std::size(languageNameToXmlFileNameEntries)};
+constexpr LanguageDbTable<LanguageDbEntry> mimeTypeToXmlFileName = {
+    mimeTypeToXmlFileNameEntries, std::size(mimeTypeToXmlFileNameEntries)};
+constexpr LanguageDbTable<LanguageDbEntry> xmlFileNameToIndenter = {
+    xmlFileNameToIndenterEntries, std::size(xmlFileNameToIndenterEntries)};
+constexpr LanguageDbTable<LanguageDbEntry> xmlFileNameToLanguageNames = {
+    xmlFileNameToLanguageNamesEntries, std::size(xmlFileNameToLanguageNamesEntries)};
+constexpr LanguageDbTable<LanguageDbGlob> fileNameGlobs = {};
+constexpr LanguageDbTable<LanguageDbGlob> fileNameSuffixGlobs = {
+    fileNameSuffixGlobsEntries, std::size(fileNameSuffixGlobsEntries)};
+constexpr LanguageDbTable<LanguageDbGlob> fileNamePrefixGlobs = {
+    fileNamePrefixGlobsEntries, std::size(fileNamePrefixGlobsEntries)};
+constexpr LanguageDbTable<LanguageDbGlob> residualFileNameGlobs = {
+    residualFileNameGlobsEntries, std::size(residualFileNameGlobsEntries)};
+constexpr LanguageDbTable<LanguageDbGlob> firstLineGlobs = {
+    firstLineGlobsEntries, std::size(firstLineGlobsEntries)};
 
-QMap<QString, QString> create_xmlFileNameToIndenter() {
-    QMap<QString, QString> xmlFileNameToIndenter;
-    xmlFileNameToIndenter["cubescript.xml"] = "normal";
-    xmlFileNameToIndenter["robot.xml"] = "python";
-    xmlFileNameToIndenter["coffee.xml"] = "python";
-    xmlFileNameToIndenter["j.xml"] = "normal";
-    xmlFileNameToIndenter["dart.xml"] = "cstyle";
-    xmlFileNameToIndenter["typescript-react.xml"] = "cstyle";
-    xmlFileNameToIndenter["puppet.xml"] = "cstyle";
-    xmlFileNameToIndenter["lua.xml"] = "lua";
-    xmlFileNameToIndenter["css.xml"] = "cstyle";
-    xmlFileNameToIndenter["javascript-react.xml"] = "cstyle";
-    xmlFileNameToIndenter["gpr.xml"] = "ada";
-    xmlFileNameToIndenter["elixir.xml"] = "elixir";
-    xmlFileNameToIndenter["viper.xml"] = "cstyle";
-    xmlFileNameToIndenter["hare.xml"] = "cstyle";
-    xmlFileNameToIndenter["gherkin.xml"] = "normal";
-    xmlFileNameToIndenter["ada.xml"] = "ada";
-    xmlFileNameToIndenter["zig.xml"] = "cstyle";
-    xmlFileNameToIndenter["isocpp.xml"] = "cstyle";
-    xmlFileNameToIndenter["javascript-php.xml"] = "cstyle";
-    xmlFileNameToIndenter["chicken.xml"] = "lisp";
-    xmlFileNameToIndenter["cashscript.xml"] = "cstyle";
-    xmlFileNameToIndenter["scss.xml"] = "cstyle";
-    xmlFileNameToIndenter["crystal.xml"] = "ruby";
-    xmlFileNameToIndenter["renpy.xml"] = "python";
-    xmlFileNameToIndenter["commonlisp.xml"] = "lisp";
-    xmlFileNameToIndenter["ansic89.xml"] = "cstyle";
-    xmlFileNameToIndenter["v.xml"] = "cstyle";
-    xmlFileNameToIndenter["odin.xml"] = "cstyle";
-    xmlFileNameToIndenter["sass.xml"] = "cstyle";
-    xmlFileNameToIndenter["awk.xml"] = "cstyle";
-    xmlFileNameToIndenter["typescript.xml"] = "cstyle";
-    xmlFileNameToIndenter["c.xml"] = "cstyle";
-    xmlFileNameToIndenter["yara.xml"] = "cstyle";
-    xmlFileNameToIndenter["javascript.xml"] = "cstyle";
-    xmlFileNameToIndenter["hamlet.xml"] = "haskell";
-    xmlFileNameToIndenter["vala.xml"] = "cstyle";
-    xmlFileNameToIndenter["mathematica.xml"] = "cstyle";
-    xmlFileNameToIndenter["flatbuffers.xml"] = "cstyle";
-    xmlFileNameToIndenter["solidity.xml"] = "cstyle";
-    xmlFileNameToIndenter["curry.xml"] = "haskell";
-    xmlFileNameToIndenter["nginx.xml"] = "cstyle";
-    xmlFileNameToIndenter["gd-script.xml"] = "python";
-    xmlFileNameToIndenter["swift.xml"] = "cstyle";
-    xmlFileNameToIndenter["purescript.xml"] = "haskell";
-    xmlFileNameToIndenter["magma.xml"] = "cstyle";
-    xmlFileNameToIndenter["scheme.xml"] = "scheme";
-    xmlFileNameToIndenter["qface.xml"] = "cstyle";
-    xmlFileNameToIndenter["go.xml"] = "cstyle";
-    xmlFileNameToIndenter["ahk.xml"] = "cstyle";
-    xmlFileNameToIndenter["css-php.xml"] = "cstyle";
-    xmlFileNameToIndenter["php.xml"] = "cstyle";
-    xmlFileNameToIndenter["haskell.xml"] = "haskell";
-    xmlFileNameToIndenter["stan.xml"] = "cstyle";
-    xmlFileNameToIndenter["kotlin.xml"] = "cstyle";
-    xmlFileNameToIndenter["pascal.xml"] = "pascal";
-    xmlFileNameToIndenter["tads3.xml"] = "cstyle";
-    xmlFileNameToIndenter["literate-curry.xml"] = "haskell";
-    xmlFileNameToIndenter["lilypond.xml"] = "lilypond";
-    xmlFileNameToIndenter["ruby.xml"] = "ruby";
-    xmlFileNameToIndenter["markdown.xml"] = "markdown";
-    xmlFileNameToIndenter["qml.xml"] = "cstyle";
-    xmlFileNameToIndenter["pli.xml"] = "pli";
-    xmlFileNameToIndenter["nim.xml"] = "python";
-    xmlFileNameToIndenter["terraform.xml"] = "normal";
-    xmlFileNameToIndenter["cpp.xml"] = "cstyle";
-    xmlFileNameToIndenter["pony.xml"] = "ruby";
-    xmlFileNameToIndenter["opencl.xml"] = "cstyle";
-    xmlFileNameToIndenter["gleam.xml"] = "cstyle";
-    return xmlFileNameToIndenter;
-}
-QMap<QString, QString> xmlFileNameToIndenter = create_xmlFileNameToIndenter();
 } // namespace Qutepart
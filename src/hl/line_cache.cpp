@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include <QMutexLocker>
+
+#include "line_cache.h"
+#include "memory_usage.h"
+
+namespace Qutepart {
+
+std::atomic<int> lineCacheCapacity{0};
+
+void setLineCacheCapacity(int lines) {
+    lineCacheCapacity.store(std::max(lines, 0), std::memory_order_relaxed);
+}
+
+LineCache::Entry::Entry(QStringView text, const HighlightedLine &line, size_t &totalBytes)
+    : text(text.toString()), line(line), totalBytes(totalBytes) {
+    bytes = sizeof(Key) + sizeof(Entry) + stringMemoryUsage(this->text) +
+            listMemoryUsage(line.formats) + listMemoryUsage(line.textTypes) +
+            listMemoryUsage(line.languages) + listMemoryUsage(line.regionChanges);
+    for (const auto &change : std::as_const(line.regionChanges)) {
+        bytes += stringMemoryUsage(change.name);
+    }
+    totalBytes += bytes;
+}
+
+LineCache::Key LineCache::makeKey(QStringView text, const ContextStack &contextStack) {
+    return Key{contextStack.id(), static_cast<int>(text.length()), qHash(text)};
+}
+
+bool LineCache::find(QStringView text, const ContextStack &contextStack, int capacity,
+                     HighlightedLine &result) {
+    if (text.length() > MAX_LINE_LENGTH) {
+        return false;
+    }
+    auto key = makeKey(text, contextStack);
+
+    QMutexLocker locker(&mutex);
+    if (cache.maxCost() != capacity) {
+        cache.setMaxCost(capacity);
+    }
+
+    auto entry = cache.object(key);
+    if (entry != nullptr && entry->text == text) {
+        counters.hits++;
+        result = entry->line;
+        return true;
+    }
+    counters.misses++;
+    return false;
+}
+
+void LineCache::insert(QStringView text, const ContextStack &contextStack,
+                       const HighlightedLine &line) {
+    if (text.length() > MAX_LINE_LENGTH) {
+        return;
+    }
+    auto key = makeKey(text, contextStack);
+
+    QMutexLocker locker(&mutex);
+    cache.insert(key, new Entry(text, line, bytes));
+    empty.store(cache.isEmpty(), std::memory_order_relaxed);
+}
+
+void LineCache::clear() {
+    QMutexLocker locker(&mutex);
+    cache.clear();
+    empty.store(true, std::memory_order_relaxed);
+}
+
+LineCache::Stats LineCache::stats() const {
+    QMutexLocker locker(&mutex);
+    return counters;
+}
+
+void LineCache::resetStats() {
+    QMutexLocker locker(&mutex);
+    counters = Stats();
+}
+
+size_t LineCache::memoryUsage() const {
+    QMutexLocker locker(&mutex);
+    return bytes;
+}
+
+} // namespace Qutepart
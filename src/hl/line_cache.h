@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QCache>
+#include <QMutex>
+#include <QString>
+
+#include "context_stack.h"
+#include "highlighted_line.h"
+
+namespace Qutepart {
+
+/* Opt-in cache of highlighted lines, one per language.
+ *
+ * Logs, generated code and data files repeat lines: empty lines, `}`, the same log prefix. A line
+ * highlighted from the same context stack is highlighted the same, so the result is looked up by
+ * the identity of the context stack and the text.
+ *
+ * The capacity is global, so that an editor sets it once for all the languages. It is 0 until
+ * setLineCacheCapacity() is called: a copied HighlightedLine is not cheaper than highlighting a
+ * short line of source code, only files with many repeated lines gain.
+ */
+extern std::atomic<int> lineCacheCapacity;
+inline int getLineCacheCapacity() { return lineCacheCapacity.load(std::memory_order_relaxed); }
+
+// Lines per language, 0 disables the caches. Cached lines are dropped when disabled
+void setLineCacheCapacity(int lines);
+
+/* Bounded, least recently used lines are dropped. Long lines are not cached, they are unlikely
+ * to repeat. Thread safe.
+ */
+class LineCache {
+  public:
+    static constexpr int MAX_LINE_LENGTH = 1024;
+
+    struct Stats {
+        quint64 hits = 0;
+        quint64 misses = 0;
+    };
+
+    LineCache() : cache(0) {}
+
+    // Copy the cached line to `result`. `capacity` is the current getLineCacheCapacity()
+    bool find(QStringView text, const ContextStack &contextStack, int capacity,
+              HighlightedLine &result);
+    void insert(QStringView text, const ContextStack &contextStack, const HighlightedLine &line);
+
+    inline bool isEmpty() const { return empty.load(std::memory_order_relaxed); }
+    void clear();
+
+    Stats stats() const;
+    void resetStats();
+    size_t memoryUsage() const;
+
+  private:
+    struct Key {
+        int contextStackId;
+        int length;
+        size_t textHash;
+
+        inline bool operator==(const Key &other) const {
+            return contextStackId == other.contextStackId && length == other.length &&
+                   textHash == other.textHash;
+        }
+    };
+    friend size_t qHash(const Key &key, size_t seed) noexcept {
+        return qHashMulti(seed, key.contextStackId, key.length, key.textHash);
+    }
+
+    /* The text is compared too, lines with the same hash are not mixed up.
+     * QCache deletes evicted entries itself, so an entry adds its size to the total of the cache
+     * and subtracts it when deleted.
+     */
+    struct Entry {
+        Entry(QStringView text, const HighlightedLine &line, size_t &totalBytes);
+        ~Entry() { totalBytes -= bytes; }
+        Q_DISABLE_COPY(Entry)
+
+        QString text;
+        HighlightedLine line;
+        size_t &totalBytes;
+        size_t bytes;
+    };
+
+    static Key makeKey(QStringView text, const ContextStack &contextStack);
+
+    mutable QMutex mutex;
+    size_t bytes = 0; // of the entries in the cache, declared first as they update it when deleted
+    QCache<Key, Entry> cache;
+    std::atomic<bool> empty{true};
+    Stats counters;
+};
+
+} // namespace Qutepart
@@ -4,28 +4,67 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <atomic>
+
 #include <QDebug>
 #include <QFile>
+#include <QFileInfo>
 #include <QMutex>
 #include <QMutexLocker>
 #include <QSharedPointer>
+#include <QThread>
+#include <QWaitCondition>
 
+#include "compiled_contexts.h"
 #include "qutepart.h"
 #include "rules.h"
 #include "style.h"
 
 #include "loader.h"
+#include "syntax_bundle.h"
 
 namespace Qutepart {
 
 const QString DEFAULT_DELIMINATOR = " \t.():!+,-<=>%&*/;?[]^{|}~\\";
 
-QMap<QString, QSharedPointer<Language>> loadedLanguageCache;
+/* Loaded languages, shared by all the documents and threads. A language is published while its
+ * context references are resolved, so includes of the language by itself find it. Other threads
+ * wait until it is loaded, unless that would close a cycle of threads waiting for each other
+ * (php.xml includes html.xml which includes php.xml).
+ */
+struct LoadedLanguage {
+    QSharedPointer<Language> language;
+    Qt::HANDLE loadingThread = nullptr; // while loading
+};
+
+QHash<QString, LoadedLanguage> loadedLanguageCache;
+QHash<Qt::HANDLE, Qt::HANDLE> threadWaitingFor; // loading thread -> the thread it waits for
 QMutex loadedLanguageCacheLock;
+QWaitCondition languageLoaded;
+
+// Thread waits, directly or through other loading threads, for target
+bool isWaitingFor(Qt::HANDLE thread, Qt::HANDLE target) {
+    for (int i = 0; thread != nullptr && i <= threadWaitingFor.size(); i++) {
+        if (thread == target) {
+            return true;
+        }
+        thread = threadWaitingFor.value(thread);
+    }
+    return false;
+}
 
-QList<RulePtr> loadRules(QXmlStreamReader &xmlReader, QString &error);
+std::atomic<int> regExpNativeCount{0};
+std::atomic<int> regExpCompiledCount{0};
+std::atomic<int> regExpPrefilteredCount{0};
+std::atomic<int> regExpDynamicCount{0};
 
-QHash<QString, QString> attrsToInsensitiveHashMap(const QXmlStreamAttributes &attrs) {
+RegExpLoadStatistics regExpLoadStatistics() {
+    return {regExpNativeCount, regExpCompiledCount, regExpPrefilteredCount, regExpDynamicCount};
+}
+
+QList<RulePtr> loadRules(SyntaxReader &xmlReader, RuleArena &arena, QString &error);
+
+QHash<QString, QString> attrsToInsensitiveHashMap(const SyntaxAttributes &attrs) {
     QHash<QString, QString> result;
     for (auto const &attr : std::as_const(attrs)) {
         result[attr.name().toString().toLower()] = attr.value().toString();
@@ -34,8 +73,8 @@ QHash<QString, QString> attrsToInsensitiveHashMap(const QXmlStreamAttributes &at
     return result;
 }
 
-QString getAttribute(QXmlStreamAttributes attrs, QString name, QString defaultValue = QString(),
-                     bool warnIfNotSet = false) {
+QString getAttribute(const SyntaxAttributes &attrs, const QString &name,
+                     const QString &defaultValue = QString(), bool warnIfNotSet = false) {
     if (attrs.hasAttribute(name)) {
         return attrs.value(name).toString();
     } else {
@@ -46,7 +85,7 @@ QString getAttribute(QXmlStreamAttributes attrs, QString name, QString defaultVa
     }
 }
 
-QString getRequiredAttribute(QXmlStreamAttributes attrs, QString name, QString &error) {
+QString getRequiredAttribute(const SyntaxAttributes &attrs, const QString &name, QString &error) {
     if (attrs.hasAttribute(name)) {
         return attrs.value(name).toString();
     } else {
@@ -118,7 +157,7 @@ ContextSwitcher makeContextSwitcher(QString contextOperation) {
     }
 }
 
-AbstractRuleParams parseAbstractRuleParams(const QXmlStreamAttributes &attrs, QString &error) {
+AbstractRuleParams parseAbstractRuleParams(const SyntaxAttributes &attrs, QString &error) {
     QString attribute = getAttribute(attrs, "attribute").toLower();
 
     QString contextText = getAttribute(attrs, "context", "#stay");
@@ -159,8 +198,8 @@ AbstractRuleParams parseAbstractRuleParams(const QXmlStreamAttributes &attrs, QS
 }
 
 template <class RuleClass>
-RuleClass *loadStringRule(const QXmlStreamAttributes &attrs, const AbstractRuleParams &params,
-                          QString &error) {
+RuleClass *loadStringRule(const SyntaxAttributes &attrs, const AbstractRuleParams &params,
+                          RuleArena &arena, QString &error) {
     QString value = getRequiredAttribute(attrs, "String", error);
     if (!error.isNull()) {
         return nullptr;
@@ -172,21 +211,21 @@ RuleClass *loadStringRule(const QXmlStreamAttributes &attrs, const AbstractRuleP
         return nullptr;
     }
 
-    return new RuleClass(params, value, insensitive);
+    return arena.create<RuleClass>(params, value, insensitive);
 }
 
-KeywordRule *loadKeywordRule(const QXmlStreamAttributes &attrs, const AbstractRuleParams &params,
-                             QString &error) {
+KeywordRule *loadKeywordRule(const SyntaxAttributes &attrs, const AbstractRuleParams &params,
+                             RuleArena &arena, QString &error) {
     QString listName = getRequiredAttribute(attrs, "String", error);
     if (!error.isNull()) {
         return nullptr;
     }
 
-    return new KeywordRule(params, listName);
+    return arena.create<KeywordRule>(params, listName);
 }
 
-DetectCharRule *loadDetectChar(const QXmlStreamAttributes &attrs, const AbstractRuleParams &params,
-                               QString &error) {
+DetectCharRule *loadDetectChar(const SyntaxAttributes &attrs, const AbstractRuleParams &params,
+                               RuleArena &arena, QString &error) {
     QString strValue = getRequiredAttribute(attrs, "char", error);
     if (!error.isNull()) {
         return nullptr;
@@ -213,11 +252,12 @@ DetectCharRule *loadDetectChar(const QXmlStreamAttributes &attrs, const Abstract
         value = strValue[0];
     }
 
-    return new DetectCharRule(params, value, index);
+    return arena.create<DetectCharRule>(params, value, index);
 }
 
-Detect2CharsRule *loadDetect2Chars(const QXmlStreamAttributes &attrs,
-                                   const AbstractRuleParams &params, QString &error) {
+Detect2CharsRule *loadDetect2Chars(const SyntaxAttributes &attrs,
+                                   const AbstractRuleParams &params, RuleArena &arena,
+                                   QString &error) {
     QString char0 = getRequiredAttribute(attrs, "char", error);
     if (!error.isNull()) {
         return nullptr;
@@ -229,11 +269,11 @@ Detect2CharsRule *loadDetect2Chars(const QXmlStreamAttributes &attrs,
 
     QString value = processEscapeSequences(char0) + processEscapeSequences(char1);
 
-    return new Detect2CharsRule(params, value, false);
+    return arena.create<Detect2CharsRule>(params, value, false);
 }
 
-RegExpRule *loadRegExp(const QXmlStreamAttributes &attrs, const AbstractRuleParams &params,
-                       QString &error) {
+RegExpRule *loadRegExp(const SyntaxAttributes &attrs, const AbstractRuleParams &params,
+                       RuleArena &arena, QString &error) {
     QString value = getRequiredAttribute(attrs, "String", error);
     if (!error.isNull()) {
         return nullptr;
@@ -268,24 +308,43 @@ RegExpRule *loadRegExp(const QXmlStreamAttributes &attrs, const AbstractRulePara
         }
     }
 
-    return new RegExpRule(params, value, insensitive, minimal, wordStart, lineStart);
+    RegExpAnalysis analysis;
+    if (params.dynamic) {
+        // the pattern changes with the context data
+        analysis.startChars.addAll();
+        regExpDynamicCount++;
+    } else {
+        analysis = analyzeRegExp(value, insensitive, minimal);
+        if (analysis.native.isValid()) {
+            regExpNativeCount++;
+        } else {
+            regExpCompiledCount++;
+            if (!analysis.literalPrefix.isEmpty()) {
+                regExpPrefilteredCount++;
+            }
+        }
+    }
+
+    return arena.create<RegExpRule>(params, value, insensitive, minimal, wordStart, lineStart,
+                                    analysis);
 }
 
 template <class RuleClass>
-RuleClass *loadNumberRule(QXmlStreamReader &xmlReader, const AbstractRuleParams &params,
-                          QString &error) {
-    QList<RulePtr> children = loadRules(xmlReader, error);
+RuleClass *loadNumberRule(SyntaxReader &xmlReader, const AbstractRuleParams &params,
+                          RuleArena &arena, QString &error) {
+    QList<RulePtr> children = loadRules(xmlReader, arena, error);
 
     if (!error.isNull()) {
         error = QString("Failed to load child rules of number: %1").arg(error);
         return nullptr;
     }
 
-    return new RuleClass(params, children);
+    return arena.create<RuleClass>(params, children);
 }
 
-RangeDetectRule *loadRangeDetectRule(const QXmlStreamAttributes &attrs,
-                                     const AbstractRuleParams &params, QString &error) {
+RangeDetectRule *loadRangeDetectRule(const SyntaxAttributes &attrs,
+                                     const AbstractRuleParams &params, RuleArena &arena,
+                                     QString &error) {
     QString char0 = getRequiredAttribute(attrs, "char", error);
     if (!error.isNull()) {
         return nullptr;
@@ -295,21 +354,22 @@ RangeDetectRule *loadRangeDetectRule(const QXmlStreamAttributes &attrs,
         return nullptr;
     }
 
-    return new RangeDetectRule(params, char0, char1);
+    return arena.create<RangeDetectRule>(params, char0, char1);
 }
 
-IncludeRulesRule *loadIncludeRulesRule(const QXmlStreamAttributes &attrs,
-                                       const AbstractRuleParams &params, QString &error) {
+IncludeRulesRule *loadIncludeRulesRule(const SyntaxAttributes &attrs,
+                                       const AbstractRuleParams &params, RuleArena &arena,
+                                       QString &error) {
     QString contextName = getRequiredAttribute(attrs, "context", error);
     if (!error.isNull()) {
         return nullptr;
     }
 
-    return new IncludeRulesRule(params, contextName);
+    return arena.create<IncludeRulesRule>(params, contextName);
 }
 
-AbstractRule *loadRule(QXmlStreamReader &xmlReader, QString &error) {
-    QXmlStreamAttributes attrs = xmlReader.attributes();
+AbstractRule *loadRule(SyntaxReader &xmlReader, RuleArena &arena, QString &error) {
+    SyntaxAttributes attrs = xmlReader.attributes();
 
     AbstractRuleParams params = parseAbstractRuleParams(attrs, error);
     if (!error.isNull()) {
@@ -320,41 +380,41 @@ AbstractRule *loadRule(QXmlStreamReader &xmlReader, QString &error) {
 
     AbstractRule *result = nullptr;
     if (name == QLatin1String("keyword")) {
-        result = loadKeywordRule(attrs, params, error);
+        result = loadKeywordRule(attrs, params, arena, error);
     } else if (name == QLatin1String("DetectChar")) {
-        result = loadDetectChar(attrs, params, error);
+        result = loadDetectChar(attrs, params, arena, error);
     } else if (name == QLatin1String("Detect2Chars")) {
-        result = loadDetect2Chars(attrs, params, error);
+        result = loadDetect2Chars(attrs, params, arena, error);
     } else if (name == QLatin1String("AnyChar")) {
-        result = loadStringRule<AnyCharRule>(attrs, params, error);
+        result = loadStringRule<AnyCharRule>(attrs, params, arena, error);
     } else if (name == QLatin1String("StringDetect")) {
-        result = loadStringRule<StringDetectRule>(attrs, params, error);
+        result = loadStringRule<StringDetectRule>(attrs, params, arena, error);
     } else if (name == QLatin1String("WordDetect")) {
-        result = loadStringRule<WordDetectRule>(attrs, params, error);
+        result = loadStringRule<WordDetectRule>(attrs, params, arena, error);
     } else if (name == QLatin1String("RegExpr")) {
-        result = loadRegExp(attrs, params, error);
+        result = loadRegExp(attrs, params, arena, error);
     } else if (name == QLatin1String("Int")) {
-        result = loadNumberRule<IntRule>(xmlReader, params, error);
+        result = loadNumberRule<IntRule>(xmlReader, params, arena, error);
     } else if (name == QLatin1String("Float")) {
-        result = loadNumberRule<FloatRule>(xmlReader, params, error);
+        result = loadNumberRule<FloatRule>(xmlReader, params, arena, error);
     } else if (name == QLatin1String("HlCHex")) {
-        result = new HlCHexRule(params);
+        result = arena.create<HlCHexRule>(params);
     } else if (name == QLatin1String("HlCOct")) {
-        result = new HlCOctRule(params);
+        result = arena.create<HlCOctRule>(params);
     } else if (name == QLatin1String("HlCStringChar")) {
-        result = new HlCStringCharRule(params);
+        result = arena.create<HlCStringCharRule>(params);
     } else if (name == QLatin1String("HlCChar")) {
-        result = new HlCCharRule(params);
+        result = arena.create<HlCCharRule>(params);
     } else if (name == QLatin1String("RangeDetect")) {
-        result = loadRangeDetectRule(attrs, params, error);
+        result = loadRangeDetectRule(attrs, params, arena, error);
     } else if (name == QLatin1String("LineContinue")) {
-        result = new LineContinueRule(params);
+        result = arena.create<LineContinueRule>(params);
     } else if (name == QLatin1String("IncludeRules")) {
-        result = loadIncludeRulesRule(attrs, params, error);
+        result = loadIncludeRulesRule(attrs, params, arena, error);
     } else if (name == QLatin1String("DetectSpaces")) {
-        result = new DetectSpacesRule(params);
+        result = arena.create<DetectSpacesRule>(params);
     } else if (name == QLatin1String("DetectIdentifier")) {
-        result = new DetectIdentifierRule(params);
+        result = arena.create<DetectIdentifierRule>(params);
     } else {
         error = QString("Unknown rule %1").arg(name.toString());
         return nullptr;
@@ -371,22 +431,22 @@ AbstractRule *loadRule(QXmlStreamReader &xmlReader, QString &error) {
     return result;
 }
 
-QList<RulePtr> loadRules(QXmlStreamReader &xmlReader, QString &error) {
+QList<RulePtr> loadRules(SyntaxReader &xmlReader, RuleArena &arena, QString &error) {
     QList<RulePtr> rules;
 
     while (xmlReader.readNextStartElement()) {
-        AbstractRule *rule = loadRule(xmlReader, error);
+        AbstractRule *rule = loadRule(xmlReader, arena, error);
         if (!error.isNull()) {
             break;
         }
-        rules.append(RulePtr(rule));
+        rules.append(rule);
     }
 
     return rules;
 }
 
-Context *loadContext(QXmlStreamReader &xmlReader, QString &error) {
-    QXmlStreamAttributes attrs = xmlReader.attributes();
+Context *loadContext(SyntaxReader &xmlReader, const RuleArenaPtr &arena, QString &error) {
+    SyntaxAttributes attrs = xmlReader.attributes();
 
     QString name = getRequiredAttribute(attrs, "name", error);
     if (!error.isNull()) {
@@ -423,23 +483,24 @@ Context *loadContext(QXmlStreamReader &xmlReader, QString &error) {
         error = QString("Failed to parse 'dynamic': %1").arg(error);
     }
 
-    QList<RulePtr> rules = loadRules(xmlReader, error);
+    QList<RulePtr> rules = loadRules(xmlReader, *arena, error);
     if (!error.isNull()) {
         error = QString("Failed to parse context %1: %2").arg(name).arg(error);
         return nullptr;
     }
 
     return new Context(name, attribute, lineEndContext, lineBeginContext, lineEmptyContext,
-                       fallthroughContext, dynamic, rules);
+                       fallthroughContext, dynamic, rules, arena);
 }
 
-QList<ContextPtr> loadContexts(QXmlStreamReader &xmlReader, QString &error) {
+QList<ContextPtr> loadContexts(SyntaxReader &xmlReader, QString &error) {
     if (xmlReader.name() != QLatin1String("contexts")) {
         error = QString("<contexts> tag not found. Found <%1>").arg(xmlReader.name().toString());
         return QList<ContextPtr>();
     }
 
     QList<ContextPtr> contexts; // result
+    auto arena = RuleArenaPtr::create(); // rules of all the contexts, see RuleArena
     while (xmlReader.readNextStartElement()) {
         if (xmlReader.name() != QLatin1String("context")) {
             error = QString("Not expected tag when parsing contexts <%1>")
@@ -447,7 +508,7 @@ QList<ContextPtr> loadContexts(QXmlStreamReader &xmlReader, QString &error) {
             return QList<ContextPtr>();
         }
 
-        Context *ctx = loadContext(xmlReader, error);
+        Context *ctx = loadContext(xmlReader, arena, error);
         if (ctx == nullptr) {
             return QList<ContextPtr>();
         }
@@ -459,7 +520,7 @@ QList<ContextPtr> loadContexts(QXmlStreamReader &xmlReader, QString &error) {
     return contexts;
 }
 
-QStringList loadKeywordList(QXmlStreamReader &xmlReader, QString &error) {
+QStringList loadKeywordList(SyntaxReader &xmlReader, QString &error) {
     QStringList list;
     while (xmlReader.readNextStartElement()) {
         if (xmlReader.name() == QLatin1String("include")) {
@@ -467,7 +528,7 @@ QStringList loadKeywordList(QXmlStreamReader &xmlReader, QString &error) {
             xmlReader.readElementText();
             qDebug()
                 << "include list is not supported yet, some parts of language will not be loaded"
-                << xmlReader.device();
+                << xmlReader.location();
             continue;
         }
         if (xmlReader.name() != QLatin1String("item")) {
@@ -481,7 +542,7 @@ QStringList loadKeywordList(QXmlStreamReader &xmlReader, QString &error) {
     return list;
 }
 
-QHash<QString, QStringList> loadKeywordLists(QXmlStreamReader &xmlReader, QString &error) {
+QHash<QString, QStringList> loadKeywordLists(SyntaxReader &xmlReader, QString &error) {
     QHash<QString, QStringList> lists;
 
     while (xmlReader.readNextStartElement()) {
@@ -489,7 +550,7 @@ QHash<QString, QStringList> loadKeywordLists(QXmlStreamReader &xmlReader, QStrin
             return lists;
         }
 
-        QXmlStreamAttributes attrs = xmlReader.attributes();
+        SyntaxAttributes attrs = xmlReader.attributes();
 
         QString name = getRequiredAttribute(attrs, "name", error);
         if (!error.isNull()) {
@@ -507,7 +568,7 @@ QHash<QString, QStringList> loadKeywordLists(QXmlStreamReader &xmlReader, QStrin
     return lists;
 }
 
-QHash<QString, Style> loadStyles(QXmlStreamReader &xmlReader, QString &error) {
+QHash<QString, Style> loadStyles(SyntaxReader &xmlReader, QString &error) {
     xmlReader.readNextStartElement();
 
     if (xmlReader.name() != QLatin1String("itemDatas")) {
@@ -524,7 +585,7 @@ QHash<QString, Style> loadStyles(QXmlStreamReader &xmlReader, QString &error) {
             return QHash<QString, Style>();
         }
 
-        QXmlStreamAttributes attrs = xmlReader.attributes();
+        SyntaxAttributes attrs = xmlReader.attributes();
 
         QString name = getRequiredAttribute(attrs, "name", error);
         if (!error.isNull()) {
@@ -577,7 +638,7 @@ QHash<QString, Style> loadStyles(QXmlStreamReader &xmlReader, QString &error) {
     return styles;
 }
 
-auto static loadComments(QXmlStreamReader &xmlReader, QString &start, QString &end,
+auto static loadComments(SyntaxReader &xmlReader, QString &start, QString &end,
                          QString &singleLine, QString &error) -> QString {
     while (xmlReader.readNextStartElement()) {
         if (xmlReader.name() != QLatin1String("comment")) {
@@ -626,7 +687,7 @@ QString setToStr(const QSet<QChar> &set) {
     return res;
 }
 
-void loadKeywordParams(const QXmlStreamAttributes &attrs, QString &keywordDeliminators,
+void loadKeywordParams(const SyntaxAttributes &attrs, QString &keywordDeliminators,
                        bool &keywordsKeySensitive, QString &error) {
     if (attrs.hasAttribute("casesensitive")) {
         keywordsKeySensitive = parseBoolAttribute(getAttribute(attrs, "casesensitive"), error);
@@ -659,7 +720,7 @@ void makeKeywordsLowerCase(QHash<QString, QStringList> &keywordLists) {
 }
 
 // Load keyword lists, contexts, attributes
-QList<ContextPtr> loadLanguageSytnax(QXmlStreamReader &xmlReader, QString &keywordDeliminators,
+QList<ContextPtr> loadLanguageSytnax(SyntaxReader &xmlReader, QString &keywordDeliminators,
                                      QString &indenter, QSet<QString> &allLanguageKeywords,
                                      QString &start, QString &end, QString &singleLine,
                                      QString &error) {
@@ -728,7 +789,7 @@ QList<ContextPtr> loadLanguageSytnax(QXmlStreamReader &xmlReader, QString &keywo
     return contexts;
 }
 
-QSharedPointer<Language> parseXmlFile(const QString &xmlFileName, QXmlStreamReader &xmlReader,
+QSharedPointer<Language> parseXmlFile(const QString &xmlFileName, SyntaxReader &xmlReader,
                                       QString &error) {
     if (!xmlReader.readNextStartElement()) {
         error = "Failed to read start element";
@@ -740,7 +801,7 @@ QSharedPointer<Language> parseXmlFile(const QString &xmlFileName, QXmlStreamRead
         return QSharedPointer<Language>();
     }
 
-    QXmlStreamAttributes attrs = xmlReader.attributes();
+    SyntaxAttributes attrs = xmlReader.attributes();
 
     QString name = getRequiredAttribute(attrs, "name", error);
     if (!error.isNull()) {
@@ -789,6 +850,7 @@ QSharedPointer<Language> parseXmlFile(const QString &xmlFileName, QXmlStreamRead
     if (!error.isNull()) {
         return QSharedPointer<Language>();
     }
+    attachCompiledMatchers(xmlFileName, contexts);
 
     Language *language =
         new Language(name, extensions, mimetypes, priority, hidden, indenter, commentStart,
@@ -798,7 +860,7 @@ QSharedPointer<Language> parseXmlFile(const QString &xmlFileName, QXmlStreamRead
 
     {
         QMutexLocker locker(&loadedLanguageCacheLock);
-        loadedLanguageCache[xmlFileName] = languagePtr;
+        loadedLanguageCache[xmlFileName].language = languagePtr;
     }
 
     /* resolve context references only after language has been added to the map
@@ -809,8 +871,10 @@ QSharedPointer<Language> parseXmlFile(const QString &xmlFileName, QXmlStreamRead
         contextMap[ctxPtr->name()] = ctxPtr;
     }
 
+    // Other languages are loaded when highlighting reaches them, see ExternalContext
+    ExternalContexts externalContexts;
     for (auto &ctx : contexts) {
-        ctx->resolveContextReferences(contextMap, error);
+        ctx->resolveContextReferences(contextMap, externalContexts, error);
         if (!error.isNull()) {
             {
                 QMutexLocker locker(&loadedLanguageCacheLock);
@@ -820,23 +884,31 @@ QSharedPointer<Language> parseXmlFile(const QString &xmlFileName, QXmlStreamRead
         }
         ctx->setLanguage(languagePtr);
     }
+    language->setExternalContexts(externalContexts);
 
     return languagePtr;
 }
 
-QSharedPointer<Language> loadLanguage(const QString &xmlFileName) {
-    if (xmlFileName.isEmpty()) {
-        return {};
-    }
+static QSharedPointer<Language> readLanguage(const QString &xmlFileName) {
+    QString error;
+    QSharedPointer<Language> language;
 
-    {
-        QMutexLocker locker(&loadedLanguageCacheLock);
-        if (loadedLanguageCache.contains(xmlFileName)) {
-            return loadedLanguageCache[xmlFileName];
+    // Built in syntax files are read from the precompiled bundle, if the library has it
+    auto bundle = SyntaxBundle::builtIn();
+    if (bundle != nullptr && bundle->contains(xmlFileName)) {
+        SyntaxReader reader(*bundle, xmlFileName);
+        language = parseXmlFile(xmlFileName, reader, error);
+        if (language.isNull()) {
+            qCritical() << "Failed to parse syntax file '" << xmlFileName << "': " << error;
         }
+        return language;
     }
 
-    QString xmlFilePath = ":/qutepart/syntax/" + xmlFileName;
+    // Other files are parsed as XML. Absolute paths (also :/ resources) load a user syntax file
+    QString xmlFilePath = xmlFileName;
+    if (QFileInfo(xmlFileName).isRelative()) {
+        xmlFilePath = ":/qutepart/syntax/" + xmlFileName;
+    }
 
     QFile syntaxFile(xmlFilePath);
     if (!syntaxFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
@@ -845,9 +917,8 @@ QSharedPointer<Language> loadLanguage(const QString &xmlFileName) {
     }
 
     QXmlStreamReader xmlReader(&syntaxFile);
-
-    QString error;
-    QSharedPointer<Language> language = parseXmlFile(xmlFileName, xmlReader, error);
+    SyntaxReader reader(xmlReader, xmlFilePath);
+    language = parseXmlFile(xmlFileName, reader, error);
     if (language.isNull()) {
         qCritical() << "Failed to parse XML file '" << xmlFilePath << "': " << error;
         return QSharedPointer<Language>();
@@ -856,6 +927,47 @@ QSharedPointer<Language> loadLanguage(const QString &xmlFileName) {
     return language;
 }
 
+QSharedPointer<Language> loadLanguage(const QString &xmlFileName) {
+    if (xmlFileName.isEmpty()) {
+        return {};
+    }
+
+    auto currentThread = QThread::currentThreadId();
+    {
+        QMutexLocker locker(&loadedLanguageCacheLock);
+        while (true) {
+            auto it = loadedLanguageCache.constFind(xmlFileName);
+            if (it == loadedLanguageCache.constEnd()) {
+                break;
+            }
+            // Loaded, or included by a language this thread is loading
+            if (it->loadingThread == nullptr || isWaitingFor(it->loadingThread, currentThread)) {
+                return it->language;
+            }
+            threadWaitingFor[currentThread] = it->loadingThread;
+            languageLoaded.wait(&loadedLanguageCacheLock);
+            threadWaitingFor.remove(currentThread);
+        }
+        loadedLanguageCache[xmlFileName].loadingThread = currentThread;
+    }
+
+    auto language = readLanguage(xmlFileName);
+
+    QMutexLocker locker(&loadedLanguageCacheLock);
+    if (language.isNull()) {
+        loadedLanguageCache.remove(xmlFileName);
+    } else {
+        loadedLanguageCache[xmlFileName] = {language, nullptr};
+    }
+    languageLoaded.wakeAll();
+    return language;
+}
+
+void clearLanguageCache() {
+    QMutexLocker locker(&loadedLanguageCacheLock);
+    loadedLanguageCache.clear();
+}
+
 ContextPtr loadExternalContext(const QString &externalCtxName) {
     QString langName, contextName;
 
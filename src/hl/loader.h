@@ -7,14 +7,38 @@
 #pragma once
 
 #include <QSharedPointer>
-#include <QXmlStreamReader>
-
 #include "language.h"
+#include "syntax_bundle.h"
 
 namespace Qutepart {
 
+/* Load a language by syntax file name, from the precompiled syntax bundle or from XML.
+ * A relative name is a built in syntax file, an absolute path a user syntax file.
+ *
+ * Languages are loaded once and shared by all the documents, they don't depend on the theme
+ * (see StyleTable). Thread safe, threads loading the same language wait for one load.
+ */
 QSharedPointer<Language> loadLanguage(const QString &xmlFileName);
 
+/* Parse a syntax file and add the language to the cache. Reads XML or the syntax bundle */
+QSharedPointer<Language> parseXmlFile(const QString &xmlFileName, SyntaxReader &reader,
+                                      QString &error);
+
 ContextPtr loadExternalContext(const QString &contextName);
 
+/* Forget the loaded languages, the next loadLanguage() parses the syntax file again.
+ * Languages in use stay valid. Used to measure the load time, not while languages are loading.
+ */
+void clearLanguageCache();
+
+/* How RegExpr rules of all the languages loaded so far are matched */
+struct RegExpLoadStatistics {
+    int native;      // simple patterns, matched without QRegularExpression
+    int compiled;    // matched with an optimized QRegularExpression
+    int prefiltered; // compiled patterns, rejected early if the literal prefix does not match
+    int dynamic;     // compiled on demand for every context data
+};
+
+RegExpLoadStatistics regExpLoadStatistics();
+
 } // namespace Qutepart
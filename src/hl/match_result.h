@@ -8,25 +8,18 @@
 
 #include <QStringList>
 
-#include "context.h"
-#include "style.h"
-
 namespace Qutepart {
 
 class AbstractRule;
 
-class MatchResult {
-  public:
-    MatchResult(int length, const QStringList &data, bool lineContinue,
-                const ContextSwitcher &context, const Style &style, const AbstractRule *rule);
-    MatchResult();
-
-    int length;
-    QStringList data;
-    bool lineContinue;
-    ContextSwitcher nextContext;
-    Style style;
-    const AbstractRule *rule;
+/* Result of a successful rule match.
+ * Cheap to copy: the context switch, style and regions are read from the rule.
+ */
+struct MatchResult {
+    int length = 0;
+    bool lineContinue = false;
+    const AbstractRule *rule = nullptr;
+    QStringList data; // captures, set only if the rule switches to a dynamic context
 };
 
 } // namespace Qutepart
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+namespace Qutepart {
+
+/* Estimates of heap memory held by containers, used by Qutepart::memoryStats().
+ * Payload only: the allocator overhead is not counted, and shared data is counted by every
+ * owner.
+ */
+inline size_t stringMemoryUsage(const QString &string) { return string.capacity() * sizeof(QChar); }
+
+inline size_t stringListMemoryUsage(const QStringList &list) {
+    size_t result = list.capacity() * sizeof(QString);
+    for (const auto &string : list) {
+        result += stringMemoryUsage(string);
+    }
+    return result;
+}
+
+template <typename T> inline size_t listMemoryUsage(const QList<T> &list) {
+    return list.capacity() * sizeof(T);
+}
+
+} // namespace Qutepart
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include <QJsonArray>
+
+#include "profiler.h"
+
+namespace Qutepart {
+
+#ifndef QUTEPART_NO_PROFILER
+std::atomic<bool> profilingEnabled{false};
+#endif
+
+void setProfilingEnabled(bool enabled) {
+#ifdef QUTEPART_NO_PROFILER
+    Q_UNUSED(enabled);
+#else
+    profilingEnabled.store(enabled, std::memory_order_relaxed);
+#endif
+}
+
+ProfileCounters::Snapshot ProfileCounters::snapshot() const {
+    Snapshot result;
+    result.attempts = attempts.load(std::memory_order_relaxed);
+    result.hits = hits.load(std::memory_order_relaxed);
+    result.nsecs = totalNsecs.load(std::memory_order_relaxed);
+    result.contextSwitches = contextSwitches.load(std::memory_order_relaxed);
+    return result;
+}
+
+void ProfileCounters::reset() {
+    attempts.store(0, std::memory_order_relaxed);
+    hits.store(0, std::memory_order_relaxed);
+    totalNsecs.store(0, std::memory_order_relaxed);
+    contextSwitches.store(0, std::memory_order_relaxed);
+}
+
+void printProfileTable(const QString &languageName, QList<ProfileEntry> entries,
+                       QTextStream &out) {
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [](const ProfileEntry &entry) {
+                                     return entry.counters.attempts == 0 &&
+                                            entry.counters.contextSwitches == 0;
+                                 }),
+                  entries.end());
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const ProfileEntry &a, const ProfileEntry &b) {
+                         return a.counters.nsecs > b.counters.nsecs;
+                     });
+
+    out << "Language " << languageName << "\n";
+    out << qSetFieldWidth(12) << Qt::right << "msec" << "attempts" << "hits" << "switches"
+        << qSetFieldWidth(0) << "  " << Qt::left << "context / rule\n";
+    for (const auto &entry : std::as_const(entries)) {
+        out << qSetFieldWidth(12) << Qt::right
+            << QString::number(entry.counters.nsecs / 1e6, 'f', 3) << entry.counters.attempts
+            << entry.counters.hits;
+        if (entry.ruleIndex == -1) {
+            out << entry.counters.contextSwitches << qSetFieldWidth(0) << "  " << Qt::left
+                << entry.context;
+        } else {
+            out << "" << qSetFieldWidth(0) << "  " << Qt::left << entry.context << " #"
+                << entry.ruleIndex << " " << entry.rule;
+        }
+        out << "\n";
+    }
+}
+
+QJsonObject profileToJson(const QString &languageName, const QList<ProfileEntry> &entries) {
+    QJsonArray contexts;
+    QJsonArray rules;
+    for (const auto &entry : entries) {
+        QJsonObject object;
+        object["context"] = entry.context;
+        object["attempts"] = double(entry.counters.attempts);
+        object["hits"] = double(entry.counters.hits);
+        object["nsecs"] = double(entry.counters.nsecs);
+        if (entry.ruleIndex == -1) {
+            object["contextSwitches"] = double(entry.counters.contextSwitches);
+            contexts.append(object);
+        } else {
+            object["index"] = entry.ruleIndex;
+            object["rule"] = entry.rule;
+            rules.append(object);
+        }
+    }
+
+    QJsonObject result;
+    result["language"] = languageName;
+    result["contexts"] = contexts;
+    result["rules"] = rules;
+    return result;
+}
+
+} // namespace Qutepart
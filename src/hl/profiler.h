@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+#include <QTextStream>
+
+namespace Qutepart {
+
+/* Opt-in profiler of the highlighting engine.
+ *
+ * Rules and contexts count match attempts, hits and the time spent in them. The time is
+ * inclusive: a context includes its rules, IncludeRules include the rules of the included
+ * context.
+ *
+ * Disabled by default. Then a match attempt costs one relaxed load of a global flag.
+ * Define QUTEPART_NO_PROFILER to compile the profiler out completely.
+ */
+#ifdef QUTEPART_NO_PROFILER
+inline constexpr bool isProfilingEnabled() { return false; }
+#else
+extern std::atomic<bool> profilingEnabled;
+inline bool isProfilingEnabled() { return profilingEnabled.load(std::memory_order_relaxed); }
+#endif
+
+// Counters are not reset when the profiler is disabled, see Language::resetProfile()
+void setProfilingEnabled(bool enabled);
+
+// Counters of one rule or context. Safe to update from several highlighting threads
+class ProfileCounters {
+  public:
+    struct Snapshot {
+        quint64 attempts = 0;
+        quint64 hits = 0;
+        quint64 nsecs = 0;
+        quint64 contextSwitches = 0; // contexts only
+    };
+
+    ProfileCounters() = default;
+    // Rules and contexts are not copied after loading, don't copy the counters
+    ProfileCounters(const ProfileCounters &) {}
+    ProfileCounters &operator=(const ProfileCounters &) { return *this; }
+
+    inline void recordAttempt(bool hit, quint64 nsecs) {
+        attempts.fetch_add(1, std::memory_order_relaxed);
+        if (hit) {
+            hits.fetch_add(1, std::memory_order_relaxed);
+        }
+        totalNsecs.fetch_add(nsecs, std::memory_order_relaxed);
+    }
+
+    inline void recordContextSwitch() {
+        if (isProfilingEnabled()) {
+            contextSwitches.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Snapshot snapshot() const;
+    void reset();
+
+  private:
+    std::atomic<quint64> attempts{0};
+    std::atomic<quint64> hits{0};
+    std::atomic<quint64> totalNsecs{0};
+    std::atomic<quint64> contextSwitches{0};
+};
+
+class ProfileTimer {
+  public:
+    ProfileTimer() : start(std::chrono::steady_clock::now()) {}
+
+    inline quint64 nsecsElapsed() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - start)
+            .count();
+    }
+
+  private:
+    std::chrono::steady_clock::time_point start;
+};
+
+// Counters of a rule or a context, as reported by Language::profile()
+struct ProfileEntry {
+    QString context;
+    int ruleIndex = -1; // in the context, -1 for the context itself
+    QString rule;       // description, empty for a context
+    ProfileCounters::Snapshot counters;
+};
+
+// Table sorted by time, entries which were never tried are skipped
+void printProfileTable(const QString &languageName, QList<ProfileEntry> entries,
+                       QTextStream &out);
+QJsonObject profileToJson(const QString &languageName, const QList<ProfileEntry> &entries);
+
+} // namespace Qutepart
@@ -0,0 +1,1031 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "regexp_analysis.h"
+
+namespace Qutepart {
+
+namespace {
+
+bool isAsciiAlnum(QChar ch) {
+    auto code = ch.unicode();
+    return (code >= '0' && code <= '9') || (code >= 'a' && code <= 'z') ||
+           (code >= 'A' && code <= 'Z');
+}
+
+int hexValue(QChar ch) {
+    auto code = ch.unicode();
+    if (code >= '0' && code <= '9') {
+        return code - '0';
+    } else if (code >= 'a' && code <= 'f') {
+        return code - 'a' + 10;
+    } else if (code >= 'A' && code <= 'F') {
+        return code - 'A' + 10;
+    }
+    return -1;
+}
+
+void addRange(StartCharSet &chars, ushort from, ushort to) {
+    for (ushort code = from; code <= to && code < chars.ascii.size(); code++) {
+        chars.ascii.set(code);
+    }
+    if (to >= chars.ascii.size()) {
+        chars.nonAscii = true;
+    }
+}
+
+// \d \w \s. Non-ASCII is added to stay on the safe side of PCRE character tables
+void addClassEscape(StartCharSet &chars, QChar escape) {
+    switch (escape.unicode()) {
+    case 'd':
+        addRange(chars, '0', '9');
+        break;
+    case 'w':
+        addRange(chars, '0', '9');
+        addRange(chars, 'a', 'z');
+        addRange(chars, 'A', 'Z');
+        chars.add('_');
+        break;
+    case 's':
+        addRange(chars, '\t', '\r');
+        chars.add(' ');
+        break;
+    }
+    chars.nonAscii = true;
+}
+
+/* Recursive descent over the subset of PCRE syntax used by Kate syntax files.
+ * Every parse*() method returns false when it meets a construct it does not understand.
+ */
+class StartCharsParser {
+  public:
+    StartCharsParser(QStringView pattern, bool insensitive)
+        : pattern(pattern), pos(0), insensitive(insensitive) {}
+
+    bool parse(StartCharSet &chars) {
+        bool canBeEmpty = false;
+        if (!parseAlternation(chars, canBeEmpty)) {
+            return false;
+        }
+
+        // Empty matches are ignored by RegExpRule, so the set is complete even if the
+        // pattern can match an empty string
+        return pos == pattern.size();
+    }
+
+  private:
+    QStringView pattern;
+    qsizetype pos;
+    bool insensitive;
+
+    bool atEnd() const { return pos >= pattern.size(); }
+    QChar peek(qsizetype offset = 0) const {
+        return pos + offset < pattern.size() ? pattern.at(pos + offset) : QChar();
+    }
+
+    void addLiteral(StartCharSet &chars, QChar ch) const {
+        if (insensitive) {
+            chars.addCaseInsensitive(ch);
+        } else {
+            chars.add(ch);
+        }
+    }
+
+    // alternative ('|' alternative)*
+    bool parseAlternation(StartCharSet &chars, bool &canBeEmpty) {
+        canBeEmpty = false;
+        while (true) {
+            bool branchCanBeEmpty = false;
+            if (!parseSequence(chars, branchCanBeEmpty)) {
+                return false;
+            }
+            canBeEmpty = canBeEmpty || branchCanBeEmpty;
+
+            if (peek() == '|') {
+                pos++;
+            } else {
+                return true;
+            }
+        }
+    }
+
+    // Items until '|' or ')'. Start characters are collected until first mandatory item
+    bool parseSequence(StartCharSet &chars, bool &canBeEmpty) {
+        while (!atEnd() && peek() != '|' && peek() != ')') {
+            StartCharSet itemChars;
+            bool itemCanBeEmpty = false;
+            bool zeroWidth = false;
+            if (!parseItem(itemChars, itemCanBeEmpty, zeroWidth)) {
+                return false;
+            }
+
+            bool optional = false;
+            if (!parseQuantifier(optional)) {
+                return false;
+            }
+
+            if (zeroWidth) {
+                if (optional) {
+                    return false;
+                }
+                continue;
+            }
+
+            chars.unite(itemChars);
+            if (!optional && !itemCanBeEmpty) {
+                // The rest of the sequence doesn't affect the first character
+                canBeEmpty = false;
+                return skipRestOfSequence();
+            }
+        }
+
+        canBeEmpty = true;
+        return true;
+    }
+
+    // Skip items until '|' or ')' without analysing them
+    bool skipRestOfSequence() {
+        int depth = 0;
+        while (!atEnd()) {
+            QChar ch = peek();
+            if (ch == '\\') {
+                if (peek(1) == 'Q') {
+                    return false;
+                }
+                pos += 2;
+                continue;
+            } else if (ch == '[') {
+                if (!skipClass()) {
+                    return false;
+                }
+                continue;
+            } else if (ch == '(') {
+                depth++;
+            } else if (ch == ')') {
+                if (depth == 0) {
+                    return true;
+                }
+                depth--;
+            } else if (ch == '|' && depth == 0) {
+                return true;
+            }
+            pos++;
+        }
+
+        return depth == 0;
+    }
+
+    bool skipClass() {
+        pos++; // [
+        if (peek() == '^') {
+            pos++;
+        }
+
+        bool first = true;
+        while (!atEnd()) {
+            QChar ch = peek();
+            if (ch == ']' && !first) {
+                pos++;
+                return true;
+            }
+            first = false;
+
+            if (ch == '\\') {
+                pos += 2;
+            } else if (ch == '[' && peek(1) == ':') {
+                pos += 2;
+                while (!atEnd() && !(peek() == ':' && peek(1) == ']')) {
+                    pos++;
+                }
+                pos += 2;
+            } else {
+                pos++;
+            }
+        }
+
+        return false;
+    }
+
+    bool parseItem(StartCharSet &chars, bool &canBeEmpty, bool &zeroWidth) {
+        QChar ch = peek();
+        switch (ch.unicode()) {
+        case '(':
+            return parseGroup(chars, canBeEmpty);
+        case '[':
+            return parseClass(chars);
+        case '\\':
+            return parseEscape(chars, zeroWidth);
+        case '^':
+            pos++;
+            zeroWidth = true;
+            return true;
+        case '{':
+            if (peek(1).isDigit() || peek(1) == ',') {
+                return false; // quantifier without an item
+            }
+            pos++;
+            addLiteral(chars, ch);
+            return true;
+        case '.':
+        case '$':
+        case '*':
+        case '+':
+        case '?':
+            return false;
+        default:
+            pos++;
+            addLiteral(chars, ch);
+            return true;
+        }
+    }
+
+    bool parseGroup(StartCharSet &chars, bool &canBeEmpty) {
+        pos++; // (
+        if (peek() == '?') {
+            QChar kind = peek(1);
+            if (kind == ':' || kind == '>' || kind == '|') {
+                pos += 2;
+            } else if (kind == 'P' && peek(2) == '<') {
+                pos += 3;
+                if (!skipGroupName('>')) {
+                    return false;
+                }
+            } else if (kind == '<' && peek(2) != '=' && peek(2) != '!') {
+                pos += 2;
+                if (!skipGroupName('>')) {
+                    return false;
+                }
+            } else if (kind == '\'') {
+                pos += 2;
+                if (!skipGroupName('\'')) {
+                    return false;
+                }
+            } else {
+                // lookarounds, inline options, conditions, comments, recursion
+                return false;
+            }
+        }
+
+        if (!parseAlternation(chars, canBeEmpty)) {
+            return false;
+        }
+
+        if (peek() != ')') {
+            return false;
+        }
+        pos++;
+        return true;
+    }
+
+    bool skipGroupName(QChar terminator) {
+        while (!atEnd() && peek() != terminator) {
+            pos++;
+        }
+        if (atEnd()) {
+            return false;
+        }
+        pos++;
+        return true;
+    }
+
+    // Parses \x, \xhh and \x{hhhh}. pos points after 'x'
+    bool parseHexEscape(QChar &result) {
+        int value = 0;
+        if (peek() == '{') {
+            pos++;
+            int digits = 0;
+            while (!atEnd() && hexValue(peek()) >= 0) {
+                value = value * 16 + hexValue(peek());
+                pos++;
+                digits++;
+            }
+            if (peek() != '}' || digits == 0 || digits > 4) {
+                return false;
+            }
+            pos++;
+        } else {
+            for (int i = 0; i < 2 && hexValue(peek()) >= 0; i++) {
+                value = value * 16 + hexValue(peek());
+                pos++;
+            }
+        }
+
+        result = QChar(value);
+        return true;
+    }
+
+    /* Parse escape which stands for a single character.
+     * Returns false if the escape is something else.
+     */
+    bool parseCharEscape(QChar escape, QChar &result, bool inClass) {
+        switch (escape.unicode()) {
+        case 't':
+            result = '\t';
+            return true;
+        case 'n':
+            result = '\n';
+            return true;
+        case 'r':
+            result = '\r';
+            return true;
+        case 'f':
+            result = '\f';
+            return true;
+        case 'a':
+            result = '\a';
+            return true;
+        case 'e':
+            result = QChar(0x1b);
+            return true;
+        case 'b':
+            if (inClass) {
+                result = '\b';
+                return true;
+            }
+            return false;
+        case 'x':
+            return parseHexEscape(result);
+        default:
+            if (!isAsciiAlnum(escape) && !escape.isNull()) {
+                result = escape;
+                return true;
+            }
+            return false;
+        }
+    }
+
+    bool parseEscape(StartCharSet &chars, bool &zeroWidth) {
+        pos++; // backslash
+        if (atEnd()) {
+            return false;
+        }
+
+        QChar escape = peek();
+        pos++;
+
+        switch (escape.unicode()) {
+        case 'b':
+        case 'B':
+        case 'A':
+        case 'G':
+            zeroWidth = true;
+            return true;
+        case 'd':
+        case 'w':
+        case 's':
+            addClassEscape(chars, escape);
+            return true;
+        default: {
+            QChar ch;
+            if (!parseCharEscape(escape, ch, false)) {
+                return false;
+            }
+            addLiteral(chars, ch);
+            return true;
+        }
+        }
+    }
+
+    // Parse single character of a class. Sets isClassEscape for \d \w \s
+    bool parseClassChar(StartCharSet &chars, QChar &ch, bool &isClassEscape) {
+        isClassEscape = false;
+        if (peek() == '[' && (peek(1) == ':' || peek(1) == '=' || peek(1) == '.')) {
+            return false; // POSIX classes
+        }
+
+        if (peek() != '\\') {
+            ch = peek();
+            pos++;
+            return true;
+        }
+
+        pos++;
+        if (atEnd()) {
+            return false;
+        }
+        QChar escape = peek();
+        pos++;
+
+        if (escape == 'd' || escape == 'w' || escape == 's') {
+            addClassEscape(chars, escape);
+            isClassEscape = true;
+            return true;
+        }
+
+        return parseCharEscape(escape, ch, true);
+    }
+
+    bool parseClass(StartCharSet &chars) {
+        pos++; // [
+        if (peek() == '^') {
+            return false;
+        }
+
+        bool first = true;
+        while (true) {
+            if (atEnd()) {
+                return false;
+            }
+            if (peek() == ']' && !first) {
+                pos++;
+                return true;
+            }
+            first = false;
+
+            QChar from;
+            bool fromIsClass = false;
+            if (!parseClassChar(chars, from, fromIsClass)) {
+                return false;
+            }
+            if (fromIsClass) {
+                continue;
+            }
+
+            if (peek() == '-' && peek(1) != ']' && pos + 1 < pattern.size()) {
+                pos++;
+                QChar to;
+                bool toIsClass = false;
+                if (!parseClassChar(chars, to, toIsClass) || toIsClass ||
+                    to.unicode() < from.unicode()) {
+                    return false;
+                }
+                addRange(chars, from.unicode(), to.unicode());
+                if (insensitive) {
+                    for (ushort code = from.unicode(); code <= to.unicode() && code < 128;
+                         code++) {
+                        chars.addCaseInsensitive(QChar(code));
+                    }
+                    chars.nonAscii = true;
+                }
+            } else {
+                addLiteral(chars, from);
+            }
+        }
+    }
+
+    // Parses optional quantifier after an item. optional is set if it allows 0 repetitions
+    bool parseQuantifier(bool &optional) {
+        optional = false;
+        QChar ch = peek();
+        if (ch == '?' || ch == '*') {
+            optional = true;
+            pos++;
+        } else if (ch == '+') {
+            pos++;
+        } else if (ch == '{') {
+            qsizetype start = pos;
+            pos++;
+            int minCount = 0;
+            int digits = 0;
+            while (!atEnd() && peek().isDigit()) {
+                minCount = minCount * 10 + peek().digitValue();
+                pos++;
+                digits++;
+            }
+            if (digits == 0) {
+                pos = start;
+                return false;
+            }
+            if (peek() == ',') {
+                pos++;
+                while (!atEnd() && peek().isDigit()) {
+                    pos++;
+                }
+            }
+            if (peek() != '}') {
+                pos = start;
+                return false;
+            }
+            pos++;
+            optional = (minCount == 0);
+        } else {
+            return true;
+        }
+
+        // lazy or possessive modifier
+        if (peek() == '?' || peek() == '+') {
+            pos++;
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+bool regExpStartChars(const QString &pattern, bool insensitive, StartCharSet &chars) {
+    StartCharSet result;
+    StartCharsParser parser(pattern, insensitive);
+    if (!parser.parse(result)) {
+        return false;
+    }
+
+    chars = result;
+    return true;
+}
+
+namespace {
+
+using CharClass = NativeRegExp::CharClass;
+
+bool isMetaChar(QChar ch) {
+    switch (ch.unicode()) {
+    case '\\':
+    case '^':
+    case '$':
+    case '.':
+    case '|':
+    case '?':
+    case '*':
+    case '+':
+    case '(':
+    case ')':
+    case '[':
+    case ']':
+    case '{':
+    case '}':
+        return true;
+    default:
+        return false;
+    }
+}
+
+// \w without PCRE2_UCP, which QRegularExpression does not set by default
+bool isAsciiWordChar(QChar ch) { return isAsciiAlnum(ch) || ch == '_'; }
+
+// Letters, which match non-ASCII characters when case insensitive, i.e. KELVIN SIGN
+bool hasNonAsciiCaseVariants(QChar ch) {
+    auto lower = ch.toLower();
+    return lower == 'k' || lower == 's';
+}
+
+void addClassRange(CharClass &chars, ushort from, ushort to) {
+    for (ushort code = from; code <= to; code++) {
+        chars.ascii.set(code);
+    }
+}
+
+bool intersects(const CharClass &a, const CharClass &b) {
+    return (a.ascii & b.ascii).any() || (a.nonAscii && b.nonAscii);
+}
+
+/* Parser for NativeRegExp. Accepts a small subset of the PCRE syntax, everything else is
+ * rejected.
+ */
+class SimplePatternParser {
+  public:
+    SimplePatternParser(QStringView pattern, bool insensitive)
+        : pattern(pattern), pos(0), insensitive(insensitive) {}
+
+    bool atEnd() const { return pos >= pattern.size(); }
+    QChar peek(qsizetype offset = 0) const {
+        return pos + offset < pattern.size() ? pattern.at(pos + offset) : QChar();
+    }
+    bool lookingAt(QStringView text) const { return pattern.mid(pos).startsWith(text); }
+    void skip(qsizetype count) { pos += count; }
+
+    bool addLiteral(CharClass &chars, QChar ch) const {
+        if (ch.unicode() >= 128) {
+            return false;
+        }
+        chars.ascii.set(ch.unicode());
+        if (insensitive && ch.isLetter()) {
+            if (hasNonAsciiCaseVariants(ch)) {
+                return false;
+            }
+            chars.ascii.set(ch.toLower().unicode());
+            chars.ascii.set(ch.toUpper().unicode());
+        }
+        return true;
+    }
+
+    // \d \w \s and their negations
+    bool addClassEscape(CharClass &chars, QChar escape) const {
+        CharClass escapeChars;
+        switch (escape.toLower().unicode()) {
+        case 'd':
+            addClassRange(escapeChars, '0', '9');
+            break;
+        case 'w':
+            addClassRange(escapeChars, '0', '9');
+            addClassRange(escapeChars, 'a', 'z');
+            addClassRange(escapeChars, 'A', 'Z');
+            escapeChars.ascii.set('_');
+            break;
+        case 's':
+            addClassRange(escapeChars, '\t', '\r');
+            escapeChars.ascii.set(' ');
+            break;
+        default:
+            return false;
+        }
+
+        if (escape.isUpper()) {
+            escapeChars.ascii.flip();
+            escapeChars.nonAscii = true;
+        }
+
+        chars.ascii |= escapeChars.ascii;
+        chars.nonAscii = chars.nonAscii || escapeChars.nonAscii;
+        return true;
+    }
+
+    bool parseCharEscape(QChar escape, QChar &result, bool inClass) {
+        switch (escape.unicode()) {
+        case 't':
+            result = '\t';
+            return true;
+        case 'n':
+            result = '\n';
+            return true;
+        case 'r':
+            result = '\r';
+            return true;
+        case 'f':
+            result = '\f';
+            return true;
+        case 'a':
+            result = '\a';
+            return true;
+        case 'e':
+            result = QChar(0x1b);
+            return true;
+        case 'b':
+            if (inClass) {
+                result = '\b';
+                return true;
+            }
+            return false;
+        case 'x': {
+            if (peek() == '{') {
+                return false;
+            }
+            int value = 0;
+            for (int i = 0; i < 2 && hexValue(peek()) >= 0; i++) {
+                value = value * 16 + hexValue(peek());
+                pos++;
+            }
+            result = QChar(value);
+            return true;
+        }
+        default:
+            if (!isAsciiAlnum(escape) && !escape.isNull()) {
+                result = escape;
+                return true;
+            }
+            return false;
+        }
+    }
+
+    bool parseAtom(CharClass &chars) {
+        QChar ch = peek();
+        if (ch == '.') {
+            pos++;
+            chars.ascii.set();
+            chars.ascii.reset('\n');
+            chars.nonAscii = true;
+            return true;
+        } else if (ch == '[') {
+            return parseClass(chars);
+        } else if (ch == '\\') {
+            pos++;
+            QChar escape = peek();
+            pos++;
+            if (addClassEscape(chars, escape)) {
+                return true;
+            }
+            QChar literal;
+            return parseCharEscape(escape, literal, false) && addLiteral(chars, literal);
+        } else if (isMetaChar(ch)) {
+            return false;
+        }
+
+        pos++;
+        return addLiteral(chars, ch);
+    }
+
+    bool parseClassChar(CharClass &chars, QChar &ch, bool &isClassEscape) {
+        isClassEscape = false;
+        if (peek() == '[' && (peek(1) == ':' || peek(1) == '=' || peek(1) == '.')) {
+            return false; // POSIX classes
+        }
+
+        if (peek() != '\\') {
+            ch = peek();
+            pos++;
+            return ch.unicode() < 128;
+        }
+
+        pos++;
+        QChar escape = peek();
+        pos++;
+        if (addClassEscape(chars, escape)) {
+            isClassEscape = true;
+            return true;
+        }
+
+        return parseCharEscape(escape, ch, true) && ch.unicode() < 128;
+    }
+
+    bool parseClass(CharClass &result) {
+        pos++; // [
+        bool negated = false;
+        if (peek() == '^') {
+            negated = true;
+            pos++;
+        }
+
+        CharClass chars;
+        bool first = true;
+        while (true) {
+            if (atEnd()) {
+                return false;
+            }
+            if (peek() == ']' && !first) {
+                pos++;
+                break;
+            }
+            first = false;
+
+            QChar from;
+            bool fromIsClass = false;
+            if (!parseClassChar(chars, from, fromIsClass)) {
+                return false;
+            }
+            if (fromIsClass) {
+                continue;
+            }
+
+            if (peek() == '-' && peek(1) != ']' && pos + 1 < pattern.size()) {
+                pos++;
+                QChar to;
+                bool toIsClass = false;
+                if (!parseClassChar(chars, to, toIsClass) || toIsClass ||
+                    to.unicode() < from.unicode()) {
+                    return false;
+                }
+                for (ushort code = from.unicode(); code <= to.unicode(); code++) {
+                    if (!addLiteral(chars, QChar(code))) {
+                        return false;
+                    }
+                }
+            } else if (!addLiteral(chars, from)) {
+                return false;
+            }
+        }
+
+        if (negated) {
+            chars.ascii.flip();
+            chars.nonAscii = !chars.nonAscii;
+        }
+        result = chars;
+        return true;
+    }
+
+    // Returns false for unsupported quantifiers. Sets 1, 1 if there is no quantifier
+    bool parseQuantifier(int &minCount, int &maxCount) {
+        minCount = 1;
+        maxCount = 1;
+        QChar ch = peek();
+        if (ch == '?') {
+            minCount = 0;
+        } else if (ch == '*') {
+            minCount = 0;
+            maxCount = -1;
+        } else if (ch == '+') {
+            maxCount = -1;
+        } else if (ch == '{') {
+            return false;
+        } else {
+            return true;
+        }
+        pos++;
+
+        // lazy or possessive modifier
+        return peek() != '?' && peek() != '+';
+    }
+
+  private:
+    QStringView pattern;
+    qsizetype pos;
+    bool insensitive;
+};
+
+CharClass wordChars() {
+    CharClass chars;
+    addClassRange(chars, '0', '9');
+    addClassRange(chars, 'a', 'z');
+    addClassRange(chars, 'A', 'Z');
+    chars.ascii.set('_');
+    return chars;
+}
+
+} // namespace
+
+bool NativeRegExp::compile(const QString &pattern, bool insensitive, bool minimal) {
+    items.clear();
+    wordBoundaryAtStart = false;
+    wordBoundaryAtEnd = false;
+    endOfLine = false;
+
+    QVector<Item> parsedItems;
+    SimplePatternParser parser(pattern, insensitive);
+
+    // the text always starts at the match offset, so ^ is always true
+    if (parser.peek() == '^') {
+        parser.skip(1);
+    }
+    if (parser.lookingAt(u"\\b")) {
+        wordBoundaryAtStart = true;
+        parser.skip(2);
+    }
+
+    while (!parser.atEnd()) {
+        // \b is supported at the end only, optionally followed by $
+        bool boundaryAtEnd =
+            parser.lookingAt(u"\\b") &&
+            (parser.peek(2).isNull() || (parser.peek(2) == '$' && parser.peek(3).isNull()));
+        if (boundaryAtEnd) {
+            wordBoundaryAtEnd = true;
+            parser.skip(2);
+            continue;
+        }
+        if (parser.peek() == '$' && parser.peek(1).isNull()) {
+            endOfLine = true;
+            parser.skip(1);
+            continue;
+        }
+
+        Item item;
+        if (!parser.parseAtom(item.chars) ||
+            !parser.parseQuantifier(item.minCount, item.maxCount)) {
+            return false;
+        }
+        if (minimal && item.minCount != item.maxCount) {
+            return false;
+        }
+        parsedItems.append(item);
+    }
+
+    if (parsedItems.isEmpty()) {
+        return false;
+    }
+
+    // Greedy repetition must not consume what the following items need
+    for (int i = 0; i < parsedItems.size(); i++) {
+        if (parsedItems[i].minCount == parsedItems[i].maxCount) {
+            continue;
+        }
+        for (int j = i + 1; j < parsedItems.size(); j++) {
+            if (intersects(parsedItems[i].chars, parsedItems[j].chars)) {
+                return false;
+            }
+            if (parsedItems[j].minCount > 0) {
+                break;
+            }
+        }
+    }
+
+    // A word boundary after greedy repetition of non-word characters might need backtracking
+    if (wordBoundaryAtEnd) {
+        auto word = wordChars();
+        for (const auto &item : std::as_const(parsedItems)) {
+            if (item.chars.nonAscii || (item.chars.ascii & ~word.ascii).any()) {
+                return false;
+            }
+        }
+    }
+
+    items = parsedItems;
+    return true;
+}
+
+int NativeRegExp::match(QStringView text) const {
+    auto length = text.size();
+    if (wordBoundaryAtStart && (length == 0 || !isAsciiWordChar(text.at(0)))) {
+        return -1;
+    }
+
+    qsizetype pos = 0;
+    for (const auto &item : items) {
+        int count = 0;
+        while ((item.maxCount < 0 || count < item.maxCount) && pos < length &&
+               item.chars.contains(text.at(pos))) {
+            // PCRE counts a surrogate pair as one character
+            if (text.at(pos).isHighSurrogate() && pos + 1 < length &&
+                text.at(pos + 1).isLowSurrogate()) {
+                pos++;
+            }
+            pos++;
+            count++;
+        }
+        if (count < item.minCount) {
+            return -1;
+        }
+    }
+
+    if (wordBoundaryAtEnd) {
+        bool wordBefore = pos > 0 && isAsciiWordChar(text.at(pos - 1));
+        bool wordAfter = pos < length && isAsciiWordChar(text.at(pos));
+        if (wordBefore == wordAfter) {
+            return -1;
+        }
+    }
+
+    if (endOfLine && !(pos == length || (pos == length - 1 && text.at(pos) == '\n'))) {
+        return -1;
+    }
+
+    return static_cast<int>(pos);
+}
+
+QString regExpLiteralPrefix(const QString &pattern) {
+    // A top level alternative has its own prefix
+    int depth = 0;
+    for (qsizetype i = 0; i < pattern.size(); i++) {
+        QChar ch = pattern.at(i);
+        if (ch == '\\') {
+            i++;
+        } else if (ch == '[') {
+            // skip the class, ']' right after '[' or '[^' is a literal
+            i++;
+            if (i < pattern.size() && pattern.at(i) == '^') {
+                i++;
+            }
+            bool first = true;
+            while (i < pattern.size() && (first || pattern.at(i) != ']')) {
+                if (pattern.at(i) == '\\') {
+                    i++;
+                }
+                i++;
+                first = false;
+            }
+        } else if (ch == '(') {
+            depth++;
+        } else if (ch == ')') {
+            depth--;
+        } else if (ch == '|' && depth == 0) {
+            return QString();
+        }
+    }
+
+    SimplePatternParser parser(pattern, false);
+    if (parser.peek() == '^') {
+        parser.skip(1);
+    }
+    if (parser.lookingAt(u"\\b")) {
+        parser.skip(2);
+    }
+
+    QString prefix;
+    while (!parser.atEnd()) {
+        QChar ch = parser.peek();
+        QChar literal;
+        if (ch == '\\') {
+            parser.skip(1);
+            QChar escape = parser.peek();
+            parser.skip(1);
+            if (!parser.parseCharEscape(escape, literal, false)) {
+                break;
+            }
+        } else if (isMetaChar(ch)) {
+            break;
+        } else {
+            parser.skip(1);
+            literal = ch;
+        }
+
+        QChar next = parser.peek();
+        if (next == '?' || next == '*' || next == '{') {
+            break; // the character is optional
+        }
+        prefix += literal;
+        if (next == '+') {
+            break;
+        }
+    }
+
+    return prefix;
+}
+
+RegExpAnalysis analyzeRegExp(const QString &pattern, bool insensitive, bool minimal) {
+    RegExpAnalysis result;
+    if (!regExpStartChars(pattern, insensitive, result.startChars)) {
+        result.startChars.addAll();
+    }
+
+    if (result.native.compile(pattern, insensitive, minimal)) {
+        return result;
+    }
+
+    auto prefix = regExpLiteralPrefix(pattern);
+    if (prefix.length() > 1) {
+        result.literalPrefix = prefix;
+    }
+
+    return result;
+}
+
+} // namespace Qutepart
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <bitset>
+
+#include <QString>
+#include <QVector>
+
+#include "start_char_set.h"
+
+namespace Qutepart {
+
+/* Find the characters a non empty match of a RegExpr rule pattern can start with.
+ * The analysis is conservative: patterns using lookarounds, back references, inline
+ * options and similar constructs are not analysed.
+ * Returns false if the set could not be derived, `chars` shall not be used then.
+ */
+bool regExpStartChars(const QString &pattern, bool insensitive, StartCharSet &chars);
+
+/* Literal text every match of the pattern starts with, i.e. "#include" for "#\s*include".
+ * Empty if the pattern has no literal prefix. Compare it case insensitively for insensitive
+ * patterns.
+ */
+QString regExpLiteralPrefix(const QString &pattern);
+
+/* Matcher for the simplest RegExpr patterns: a sequence of characters, character classes and
+ * \d \w \s with greedy quantifiers, like "[A-Za-z_]\w*" or "0[xX][0-9a-fA-F]+".
+ * Accepted only if greedy matching never has to backtrack, so the result is the same as the
+ * one of QRegularExpression anchored at the start of the text.
+ */
+class NativeRegExp {
+  public:
+    // Returns false if the pattern is not simple enough. The object shall not be used then
+    bool compile(const QString &pattern, bool insensitive, bool minimal);
+
+    inline bool isValid() const { return !items.isEmpty(); }
+
+    // Length of the match at the start of the text in UTF-16 code units, -1 if not matched
+    int match(QStringView text) const;
+
+    // Heap memory held by the compiled pattern, in bytes
+    inline size_t memoryUsage() const { return items.capacity() * sizeof(Item); }
+
+    struct CharClass {
+        std::bitset<128> ascii;
+        bool nonAscii = false; // all characters above ASCII match, none otherwise
+
+        inline bool contains(QChar ch) const {
+            auto code = ch.unicode();
+            return code < ascii.size() ? ascii.test(code) : nonAscii;
+        }
+    };
+
+  private:
+    struct Item {
+        CharClass chars;
+        int minCount;
+        int maxCount; // -1 if unbounded
+    };
+
+    QVector<Item> items;
+    bool wordBoundaryAtStart = false;
+    bool wordBoundaryAtEnd = false;
+    bool endOfLine = false;
+};
+
+/* Everything known about a RegExpr pattern at load time */
+struct RegExpAnalysis {
+    StartCharSet startChars; // `any` if the set could not be derived
+    QString literalPrefix;   // only if longer than one character, the start chars cover it otherwise
+    NativeRegExp native;     // valid if the pattern does not need QRegularExpression
+};
+
+RegExpAnalysis analyzeRegExp(const QString &pattern, bool insensitive, bool minimal);
+
+} // namespace Qutepart
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include "rule_arena.h"
+#include "rules.h"
+
+namespace Qutepart {
+
+RuleArena::~RuleArena() {
+    // Number rules refer to their child rules, which were created before them
+    for (auto it = rules.rbegin(); it != rules.rend(); ++it) {
+        (*it)->~AbstractRule();
+    }
+}
+
+void *RuleArena::allocate(size_t size, size_t alignment) {
+    blockUsed = (blockUsed + alignment - 1) / alignment * alignment;
+    if (blocks.empty() || blockUsed + size > BLOCK_SIZE) {
+        // new[] memory is aligned for any rule
+        blocks.emplace_back(new char[std::max(size, BLOCK_SIZE)]);
+        blockUsed = 0;
+    }
+
+    void *result = blocks.back().get() + blockUsed;
+    blockUsed += size;
+    return result;
+}
+
+} // namespace Qutepart
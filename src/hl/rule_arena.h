@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <QSharedPointer>
+
+namespace Qutepart {
+
+class AbstractRule;
+
+/* Memory of the rules of a language.
+ *
+ * Rules are allocated one after another in large blocks, so the rules of a context are close to
+ * each other, and are destroyed with the arena, in one go. The contexts of the language share the
+ * arena, it is freed with the last of them.
+ */
+class RuleArena {
+  public:
+    RuleArena() = default;
+    ~RuleArena();
+    RuleArena(const RuleArena &) = delete;
+    RuleArena &operator=(const RuleArena &) = delete;
+
+    template <typename RuleClass, typename... Args> RuleClass *create(Args &&...args) {
+        void *memory = allocate(sizeof(RuleClass), alignof(RuleClass));
+        auto rule = new (memory) RuleClass(std::forward<Args>(args)...);
+        rules.push_back(rule);
+        return rule;
+    }
+
+  private:
+    static constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+    void *allocate(size_t size, size_t alignment);
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    size_t blockUsed = BLOCK_SIZE; // in the last block
+    std::vector<AbstractRule *> rules;
+};
+
+typedef QSharedPointer<RuleArena> RuleArenaPtr;
+
+} // namespace Qutepart
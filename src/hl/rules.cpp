@@ -8,6 +8,7 @@
 
 #include "loader.h"
 #include "match_result.h"
+#include "memory_usage.h"
 #include "text_to_match.h"
 
 #include "rules.h"
@@ -26,8 +27,16 @@ void AbstractRule::printDescription(QTextStream &out) const {
 QString AbstractRule::description() const { return QString("%1(%2)").arg(name()).arg(args()); }
 
 void AbstractRule::resolveContextReferences(const QHash<QString, ContextPtr> &contexts,
-                                            QString &error) {
-    contextSwitcher.resolveContextReferences(contexts, error);
+                                            ExternalContexts &externalContexts, QString &error) {
+    contextSwitcher.resolveContextReferences(contexts, externalContexts, error);
+
+    // Context of another language is not loaded yet. Keep the captures, it might be dynamic
+    if (contextSwitcher.isExternal()) {
+        switchesToDynamicContext = true;
+        return;
+    }
+    auto nextContext = contextSwitcher.context();
+    switchesToDynamicContext = !nextContext.isNull() && nextContext->dynamic();
 }
 
 void AbstractRule::setStyles(const QHash<QString, Style> &styles, QString &error) {
@@ -41,17 +50,20 @@ void AbstractRule::setStyles(const QHash<QString, Style> &styles, QString &error
     }
 }
 
-void AbstractRule::setTheme(const Theme *theme) {
-    if (theme == style.getTheme()) {
-        return;
-    }
-#if 0
-    qDebug() << "    - rule " << this->name() << args();
-#endif
-    style.setTheme(theme);
-    if (contextSwitcher.context()) {
-        contextSwitcher.context()->setTheme(theme);
-    }
+void AbstractRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    chars.addAll();
+}
+
+void AbstractRule::fillRecord(RuleRecord &record) const {
+    record.kind = RuleRecord::Generic;
+    record.firstNonSpace = firstNonSpace;
+    record.column = column;
+    record.rule = this;
+}
+
+size_t AbstractRule::memoryUsage() const {
+    return sizeof(AbstractRule) + stringMemoryUsage(attribute) +
+           stringMemoryUsage(beginRegion) + stringMemoryUsage(endRegion);
 }
 
 bool AbstractRule::makeMatchResult(MatchResult &result, int length, bool lineContinue,
@@ -62,11 +74,25 @@ bool AbstractRule::makeMatchResult(MatchResult &result, int length, bool lineCon
         length = 0;
     }
 
-    result = MatchResult(length, data, lineContinue, contextSwitcher, style, this);
+    result.length = length;
+    result.lineContinue = lineContinue;
+    result.rule = this;
+    if (switchesToDynamicContext) {
+        result.data = data;
+    } else if (!result.data.isEmpty()) {
+        result.data = QStringList();
+    }
     return true;
 }
 
-bool AbstractRule::tryMatch(const TextToMatch &textToMatch, MatchResult &result) const {
+bool AbstractRule::tryMatchProfiled(const TextToMatch &textToMatch, MatchResult &result) const {
+    ProfileTimer timer;
+    bool matched = tryMatchUnprofiled(textToMatch, result);
+    profileCounters.recordAttempt(matched, timer.nsecsElapsed());
+    return matched;
+}
+
+bool AbstractRule::tryMatchUnprofiled(const TextToMatch &textToMatch, MatchResult &result) const {
     if (column != -1 && column != textToMatch.currentColumnIndex) {
         return false;
     }
@@ -82,6 +108,11 @@ AbstractStringRule::AbstractStringRule(const AbstractRuleParams &params, const Q
                                        bool insensitive)
     : AbstractRule(params), value(value), insensitive(insensitive) {}
 
+size_t AbstractStringRule::memoryUsage() const {
+    return AbstractRule::memoryUsage() + sizeof(AbstractStringRule) - sizeof(AbstractRule) +
+           stringMemoryUsage(value);
+}
+
 QString AbstractStringRule::args() const {
     QString result = value;
     if (insensitive) {
@@ -101,10 +132,20 @@ QString makeDynamicSubsctitutions(QString pattern, const QStringList &data) {
 }
 } // namespace
 
+void StringDetectRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    if (dynamic) {
+        chars.addAll();
+    } else if (!value.isEmpty()) {
+        chars.add(value.at(0));
+    }
+}
+
 bool StringDetectRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     QString pattern = value;
     if (dynamic) {
-        pattern = makeDynamicSubsctitutions(value, *textToMatch.contextData);
+        pattern = dynamicPatterns.get(*textToMatch.contextData, [this](const QStringList &data) {
+            return makeDynamicSubsctitutions(value, data);
+        });
     }
 
     if (pattern.isEmpty()) {
@@ -119,44 +160,35 @@ bool StringDetectRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult
 }
 
 KeywordRule::KeywordRule(const AbstractRuleParams &params, const QString &listName)
-    : AbstractRule(params), listName(listName), caseSensitive(true) {}
+    : AbstractRule(params), listName(listName) {}
 
-void KeywordRule::setKeywordParams(const QHash<QString, QStringList> &lists, bool newCaseSensitive,
+void KeywordRule::setKeywordParams(const QHash<QString, QStringList> &lists, bool caseSensitive,
                                    const QString &newDeliminators, QString &error) {
     if (!lists.contains(listName)) {
         error = QString("List '%1' not found").arg(error);
         return;
     }
-    this->caseSensitive = newCaseSensitive;
     this->deliminators = DeliminatorSet(newDeliminators);
+    this->keywords = KeywordSet(lists[listName], caseSensitive);
+}
 
-    items.clear();
-    const auto &list = lists[listName];
-    items.reserve(list.size());
-    for (const auto &word : list) {
-        items.insert(this->caseSensitive ? word : word.toLower(), true);
-    }
+void KeywordRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    chars.unite(keywords.startChars());
+}
+
+size_t KeywordRule::memoryUsage() const {
+    return AbstractRule::memoryUsage() + sizeof(KeywordRule) - sizeof(AbstractRule) +
+           stringMemoryUsage(listName) + keywords.memoryUsage();
 }
 
 bool KeywordRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     QStringView word = textToMatch.word(deliminators);
 
-    if (word.isEmpty()) {
+    if (word.isEmpty() || !keywords.contains(word)) {
         return false;
     }
 
-    bool matched = false;
-    if (this->caseSensitive) {
-        matched = items.contains(word);
-    } else {
-        matched = items.contains(word.toString().toLower());
-    }
-
-    if (matched) {
-        return makeMatchResult(result, word.length(), false);
-    } else {
-        return false;
-    }
+    return makeMatchResult(result, word.length(), false);
 }
 
 DetectCharRule::DetectCharRule(const AbstractRuleParams &params, QChar value, int index)
@@ -170,6 +202,22 @@ QString DetectCharRule::args() const {
     }
 }
 
+void DetectCharRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    if (dynamic) {
+        chars.addAll();
+    } else {
+        chars.add(value);
+    }
+}
+
+void DetectCharRule::fillRecord(RuleRecord &record) const {
+    AbstractRule::fillRecord(record);
+    if (!dynamic) {
+        record.kind = RuleRecord::DetectChar;
+        record.char0 = value;
+    }
+}
+
 bool DetectCharRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     QChar pattern = value;
 
@@ -199,6 +247,21 @@ bool DetectCharRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &r
     }
 }
 
+void Detect2CharsRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    if (!value.isEmpty()) {
+        chars.add(value.at(0));
+    }
+}
+
+void Detect2CharsRule::fillRecord(RuleRecord &record) const {
+    AbstractRule::fillRecord(record);
+    if (value.size() == 2) {
+        record.kind = RuleRecord::Detect2Chars;
+        record.char0 = value.at(0);
+        record.char1 = value.at(1);
+    }
+}
+
 bool Detect2CharsRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     if (textToMatch.text.startsWith(value)) {
         return makeMatchResult(result, 2);
@@ -207,6 +270,12 @@ bool Detect2CharsRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult
     return false;
 }
 
+void AnyCharRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    for (QChar ch : value) {
+        chars.add(ch);
+    }
+}
+
 bool AnyCharRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     if (value.contains(textToMatch.text.at(0))) {
         return makeMatchResult(result, 1);
@@ -215,6 +284,17 @@ bool AnyCharRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &resu
     return false;
 }
 
+void WordDetectRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    if (value.isEmpty()) {
+        return;
+    }
+    if (insensitive) {
+        chars.addCaseInsensitive(value.at(0));
+    } else {
+        chars.add(value.at(0));
+    }
+}
+
 bool WordDetectRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     QStringView word = textToMatch.word(mDeliminatorSet);
     if (word.isEmpty()) {
@@ -236,14 +316,28 @@ void WordDetectRule::setKeywordParams(const QHash<QString, QStringList> &, bool,
 }
 
 RegExpRule::RegExpRule(const AbstractRuleParams &params, const QString &value, bool insensitive,
-                       bool minimal, bool wordStart, bool lineStart)
+                       bool minimal, bool wordStart, bool lineStart,
+                       const RegExpAnalysis &analysis)
     : AbstractRule(params), value(value), insensitive(insensitive), minimal(minimal),
-      wordStart(wordStart), lineStart(lineStart) {
-    if (!dynamic) {
+      wordStart(wordStart), lineStart(lineStart), nativeRegExp(analysis.native),
+      literalPrefix(analysis.literalPrefix), startChars(analysis.startChars) {
+    if (!dynamic && !nativeRegExp.isValid()) {
         regExp = compileRegExp(value);
+        regExp.optimize();
     }
 }
 
+void RegExpRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    chars.unite(startChars);
+}
+
+size_t RegExpRule::memoryUsage() const {
+    // the size of a compiled QRegularExpression is not exposed, count its copy of the pattern
+    return AbstractRule::memoryUsage() + sizeof(RegExpRule) - sizeof(AbstractRule) +
+           stringMemoryUsage(value) * (nativeRegExp.isValid() ? 1 : 2) +
+           stringMemoryUsage(literalPrefix) + nativeRegExp.memoryUsage();
+}
+
 QString RegExpRule::args() const {
     QString result = value;
     if (insensitive) {
@@ -298,10 +392,29 @@ bool RegExpRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &resul
         return false;
     }
 
+    if (nativeRegExp.isValid()) {
+        int length = nativeRegExp.match(textToMatch.text);
+        if (length <= 0) {
+            return false;
+        }
+        if (!switchesToDynamicContext) {
+            return makeMatchResult(result, length);
+        }
+        return makeMatchResult(result, length, false, {textToMatch.text.left(length).toString()});
+    }
+
+    if (!literalPrefix.isEmpty() &&
+        !textToMatch.text.startsWith(literalPrefix,
+                                     insensitive ? Qt::CaseInsensitive : Qt::CaseSensitive)) {
+        return false;
+    }
+
     QRegularExpressionMatch match;
     if (dynamic) {
-        QString pattern = makeDynamicSubsctitutions(value, *textToMatch.contextData);
-        QRegularExpression dynamicRegExp = compileRegExp(pattern);
+        auto dynamicRegExp =
+            dynamicRegExps.get(*textToMatch.contextData, [this](const QStringList &data) {
+                return compileRegExp(makeDynamicSubsctitutions(value, data));
+            });
         match = dynamicRegExp.matchView(textToMatch.text, 0, QRegularExpression::NormalMatch,
                                         QRegularExpression::AnchorAtOffsetMatchOption);
     } else {
@@ -310,6 +423,9 @@ bool RegExpRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &resul
     }
 
     if (match.hasMatch() && match.capturedLength() > 0) {
+        if (!switchesToDynamicContext) {
+            return makeMatchResult(result, match.capturedLength());
+        }
         return makeMatchResult(result, match.capturedLength(), false, match.capturedTexts());
     } else {
         return false;
@@ -320,6 +436,15 @@ AbstractNumberRule::AbstractNumberRule(const AbstractRuleParams &params,
                                        const QList<RulePtr> &childRules)
     : AbstractRule(params), childRules(childRules) {}
 
+size_t AbstractNumberRule::memoryUsage() const {
+    size_t result = AbstractRule::memoryUsage() + sizeof(AbstractNumberRule) -
+                    sizeof(AbstractRule) + listMemoryUsage(childRules);
+    for (const auto &rule : childRules) {
+        result += rule->memoryUsage();
+    }
+    return result;
+}
+
 void AbstractNumberRule::printDescription(QTextStream &out) const {
     AbstractRule::printDescription(out);
 
@@ -335,7 +460,7 @@ bool AbstractNumberRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResul
         return false;
     }
 
-    int matchedLength = tryMatchText(textToMatch.text);
+    int matchedLength = tryMatchText(textToMatch);
 
     if (matchedLength <= 0) {
         return false;
@@ -358,25 +483,39 @@ bool AbstractNumberRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResul
     return makeMatchResult(result, matchedLength);
 }
 
-int AbstractNumberRule::countDigits(const QStringView &text) const {
-    int index = 0;
-    for (index = 0; index < text.length(); index++) {
-        if (!text.at(index).isDigit()) {
-            break;
-        }
+namespace {
+// Digits as seen by QChar::isDigit()
+void addDigits(StartCharSet &chars) {
+    for (char ch = '0'; ch <= '9'; ch++) {
+        chars.add(ch);
     }
-    return index;
+    chars.nonAscii = true;
 }
+} // namespace
 
-int IntRule::tryMatchText(const QStringView &text) const { return countDigits(text); }
+void IntRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    addDigits(chars);
+}
 
-int FloatRule::tryMatchText(const QStringView &text) const {
+int IntRule::tryMatchText(const TextToMatch &textToMatch) const {
+    return textToMatch.countDigits();
+}
+
+void FloatRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    addDigits(chars);
+    chars.add('.');
+    // exponent without mantissa, i.e. "e5", is matched as well
+    chars.addCaseInsensitive('e');
+}
+
+int FloatRule::tryMatchText(const TextToMatch &textToMatch) const {
+    const auto &text = textToMatch.text;
     bool haveDigit = false;
     bool havePoint = false;
 
     int matchedLength = 0;
 
-    int digitCount = countDigits(text);
+    int digitCount = textToMatch.countDigits();
 
     if (digitCount > 0) {
         haveDigit = true;
@@ -388,7 +527,7 @@ int FloatRule::tryMatchText(const QStringView &text) const {
         matchedLength++;
     }
 
-    digitCount = countDigits(text.mid(matchedLength));
+    digitCount = textToMatch.countDigits(matchedLength);
     if (digitCount > 0) {
         haveDigit = true;
         matchedLength += digitCount;
@@ -404,7 +543,7 @@ int FloatRule::tryMatchText(const QStringView &text) const {
 
         bool haveDigitInExponent = false;
 
-        digitCount = countDigits(text.mid(matchedLength));
+        digitCount = textToMatch.countDigits(matchedLength);
         if (digitCount > 0) {
             haveDigitInExponent = true;
             matchedLength += digitCount;
@@ -471,6 +610,10 @@ int checkEscapedChar(QStringView text) {
 }
 } // namespace
 
+void HlCOctRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    chars.add('0');
+}
+
 bool HlCOctRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     if (textToMatch.text.at(0) != '0') {
         return false;
@@ -492,6 +635,10 @@ bool HlCOctRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &resul
     return makeMatchResult(result, index);
 }
 
+void HlCHexRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    chars.add('0');
+}
+
 bool HlCHexRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     if (textToMatch.text.length() < 3) {
         return false;
@@ -517,6 +664,10 @@ bool HlCHexRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &resul
     return makeMatchResult(result, index);
 }
 
+void HlCStringCharRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    chars.add('\\');
+}
+
 bool HlCStringCharRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     int res = checkEscapedChar(textToMatch.text);
     if (res != -1) {
@@ -526,6 +677,10 @@ bool HlCStringCharRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult
     }
 }
 
+void HlCCharRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    chars.add('\'');
+}
+
 bool HlCCharRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     if (textToMatch.text.length() > 2 && textToMatch.text.at(0) == '\'' &&
         textToMatch.text.at(1) != '\'') {
@@ -551,6 +706,14 @@ RangeDetectRule::RangeDetectRule(const AbstractRuleParams &params, const QString
 
 QString RangeDetectRule::args() const { return QString("%1 - %2").arg(char0, char1); }
 
+void RangeDetectRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    if (char0.isEmpty()) {
+        chars.addAll();
+    } else {
+        chars.add(char0.at(0));
+    }
+}
+
 bool RangeDetectRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
     if (textToMatch.text.startsWith(char0)) {
         int end = textToMatch.text.indexOf(char1, 1);
@@ -566,18 +729,15 @@ IncludeRulesRule::IncludeRulesRule(const AbstractRuleParams &params, const QStri
     : AbstractRule(params), contextName(contextName) {}
 
 void IncludeRulesRule::resolveContextReferences(const QHash<QString, ContextPtr> &contexts,
+                                                ExternalContexts &externalContexts,
                                                 QString &error) {
-    AbstractRule::resolveContextReferences(contexts, error);
+    AbstractRule::resolveContextReferences(contexts, externalContexts, error);
     if (!error.isNull()) {
         return;
     }
 
     if (contextName.contains("#")) {
-        context = loadExternalContext(contextName);
-        if (context.isNull()) {
-            error = QString("Failed to include rules from external context '%1'").arg(contextName);
-            return;
-        }
+        externalContext = referExternalContext(contextName, externalContexts);
         return;
     }
 
@@ -590,13 +750,42 @@ void IncludeRulesRule::resolveContextReferences(const QHash<QString, ContextPtr>
     context = contexts[contextName];
 }
 
+void IncludeRulesRule::collectStartChars(StartCharSet &chars,
+                                         QSet<const Context *> &visiting) const {
+    /* Don't load the other language only to build the dispatch table. The rule is tried at any
+     * character, the table is built again once the language is loaded
+     */
+    if (externalContext && !externalContext->isResolved()) {
+        chars.addUnresolved(externalContext.data());
+        return;
+    }
+
+    auto included = externalContext ? externalContext->context().data() : context.data();
+    if (included == nullptr) {
+        chars.addAll();
+        return;
+    }
+
+    included->collectStartChars(chars, visiting);
+}
+
 bool IncludeRulesRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
-    if (context == nullptr) {
-        qWarning() << "IncludeRules called for null context" << description();
+    auto included = externalContext ? externalContext->context().data() : context.data();
+    if (included == nullptr) {
+        // The other language or context doesn't exist, loadExternalContext() warned once
         return false;
     }
 
-    return context->tryMatch(textToMatch, result);
+    return included->tryMatch(textToMatch, result);
+}
+
+void LineContinueRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    chars.add('\\');
+}
+
+void LineContinueRule::fillRecord(RuleRecord &record) const {
+    AbstractRule::fillRecord(record);
+    record.kind = RuleRecord::LineContinue;
 }
 
 bool LineContinueRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
@@ -607,12 +796,22 @@ bool LineContinueRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult
     return false;
 }
 
-bool DetectSpacesRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
-    int index = 0;
-    while (index < textToMatch.text.length() && textToMatch.text.at(index).isSpace()) {
-        index++;
+void DetectSpacesRule::collectStartChars(StartCharSet &chars, QSet<const Context *> &) const {
+    for (ushort code = 0; code < chars.ascii.size(); code++) {
+        if (QChar(code).isSpace()) {
+            chars.add(QChar(code));
+        }
     }
+    chars.nonAscii = true;
+}
 
+void DetectSpacesRule::fillRecord(RuleRecord &record) const {
+    AbstractRule::fillRecord(record);
+    record.kind = RuleRecord::DetectSpaces;
+}
+
+bool DetectSpacesRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
+    int index = textToMatch.countSpaces();
     if (index > 0) {
         return makeMatchResult(result, index);
     } else {
@@ -620,19 +819,24 @@ bool DetectSpacesRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult
     }
 }
 
-bool DetectIdentifierRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
-    if (textToMatch.text.at(0).isLetter()) {
-        int count = 1;
-        while (count < textToMatch.text.length()) {
-            QChar ch = textToMatch.text.at(count);
-            if (ch.isLetterOrNumber() || ch == '_') {
-                count++;
-            } else {
-                break;
-            }
+void DetectIdentifierRule::collectStartChars(StartCharSet &chars,
+                                             QSet<const Context *> &) const {
+    for (ushort code = 0; code < chars.ascii.size(); code++) {
+        if (QChar(code).isLetter()) {
+            chars.add(QChar(code));
         }
+    }
+    chars.nonAscii = true;
+}
 
-        return makeMatchResult(result, count);
+void DetectIdentifierRule::fillRecord(RuleRecord &record) const {
+    AbstractRule::fillRecord(record);
+    record.kind = RuleRecord::DetectIdentifier;
+}
+
+bool DetectIdentifierRule::tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const {
+    if (textToMatch.isLetter()) {
+        return makeMatchResult(result, textToMatch.countWordChars());
     } else {
         return false;
     }
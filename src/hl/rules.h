@@ -8,11 +8,17 @@
 
 #include <QHash>
 #include <QRegularExpression>
+#include <QSet>
 #include <QSharedPointer>
 #include <QString>
 #include <QTextStream>
 
 #include "context.h"
+#include "dynamic_pattern_cache.h"
+#include "keyword_set.h"
+#include "profiler.h"
+#include "regexp_analysis.h"
+#include "start_char_set.h"
 #include "text_to_match.h"
 
 namespace Qutepart {
@@ -42,11 +48,24 @@ class AbstractRule {
     virtual QString description() const;
 
     virtual void resolveContextReferences(const QHash<QString, ContextPtr> &contexts,
-                                          QString &error);
+                                          ExternalContexts &externalContexts, QString &error);
     virtual void setKeywordParams(const QHash<QString, QStringList> &, bool, const QString &,
                                   QString &) {}
     void setStyles(const QHash<QString, Style> &styles, QString &error);
-    void setTheme(const Theme *theme);
+
+    /* Add characters this rule can start matching at to `chars`.
+     * Used to build Context rule dispatch table. Default implementation adds all characters.
+     * `visiting` holds contexts being inspected, to detect IncludeRules loops.
+     */
+    virtual void collectStartChars(StartCharSet &chars, QSet<const Context *> &visiting) const;
+
+    /* Fill the record the context dispatches the rule with. The default implementation sets the
+     * common parameters, simple rules also set their kind and arguments
+     */
+    virtual void fillRecord(RuleRecord &record) const;
+
+    // Estimated memory held by the rule, in bytes. See memory_usage.h
+    virtual size_t memoryUsage() const;
 
     bool lookAhead;
     QSharedPointer<Language> language;
@@ -54,7 +73,15 @@ class AbstractRule {
     /* Matching entrypoint. Checks common params and calls tryMatchImpl()
      * Returns true and fills result on a match; result is untouched otherwise.
      */
-    bool tryMatch(const TextToMatch &textToMatch, MatchResult &result) const;
+    inline bool tryMatch(const TextToMatch &textToMatch, MatchResult &result) const {
+        if (Q_UNLIKELY(isProfilingEnabled())) {
+            return tryMatchProfiled(textToMatch, result);
+        }
+        return tryMatchUnprofiled(textToMatch, result);
+    }
+
+    inline ProfileCounters::Snapshot profile() const { return profileCounters.snapshot(); }
+    inline void resetProfile() { profileCounters.reset(); }
 
   protected:
     friend class Context;
@@ -69,14 +96,19 @@ class AbstractRule {
      */
     virtual bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const = 0;
 
+    bool tryMatchUnprofiled(const TextToMatch &textToMatch, MatchResult &result) const;
+    bool tryMatchProfiled(const TextToMatch &textToMatch, MatchResult &result) const;
+
     QString attribute; // may be null
     ContextSwitcher contextSwitcher;
+    bool switchesToDynamicContext = false; // captures are needed only then
     bool firstNonSpace;
     int column; // -1 if not set
     bool dynamic;
     Style style;
     QString beginRegion;
     QString endRegion;
+    mutable ProfileCounters profileCounters;
 };
 
 // A rule which has 1 string as a parameter
@@ -84,6 +116,8 @@ class AbstractStringRule : public AbstractRule {
   public:
     AbstractStringRule(const AbstractRuleParams &params, const QString &value, bool insensitive);
 
+    size_t memoryUsage() const override;
+
   protected:
     QString args() const override;
     QString value;
@@ -99,13 +133,14 @@ class KeywordRule : public AbstractRule {
 
     QString name() const override { return "Keyword"; }
     QString args() const override { return listName; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
+    size_t memoryUsage() const override;
 
   private:
     virtual bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
 
     QString listName;
-    QHash<QString, bool> items;
-    bool caseSensitive;
+    KeywordSet keywords;
     DeliminatorSet deliminators;
 };
 
@@ -115,6 +150,8 @@ class DetectCharRule : public AbstractRule {
 
     QString name() const override { return "DetectChar"; }
     QString args() const override;
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
+    void fillRecord(RuleRecord &record) const override;
 
   private:
     virtual bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -128,6 +165,8 @@ class Detect2CharsRule : public AbstractStringRule {
 
   public:
     QString name() const override { return "Detect2Chars"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
+    void fillRecord(RuleRecord &record) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -138,6 +177,7 @@ class AnyCharRule : public AbstractStringRule {
 
   public:
     QString name() const override { return "AnyChar"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
     virtual bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -148,9 +188,12 @@ class StringDetectRule : public AbstractStringRule {
 
   public:
     QString name() const override { return "StringDetect"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
     virtual bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
+
+    mutable DynamicPatternCache<QString> dynamicPatterns;
 };
 
 class WordDetectRule : public AbstractStringRule {
@@ -158,6 +201,7 @@ class WordDetectRule : public AbstractStringRule {
 
   public:
     QString name() const override { return "WordDetect"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
     void setKeywordParams(const QHash<QString, QStringList> &lists, bool caseSensitive,
                           const QString &, QString &error) override;
 
@@ -169,7 +213,10 @@ class WordDetectRule : public AbstractStringRule {
 class RegExpRule : public AbstractRule {
   public:
     RegExpRule(const AbstractRuleParams &params, const QString &value, bool insensitive,
-               bool minimal, bool wordStart, bool lineStart);
+               bool minimal, bool wordStart, bool lineStart, const RegExpAnalysis &analysis);
+
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
+    size_t memoryUsage() const override;
 
   private:
     QString name() const override { return "RegExpr"; }
@@ -183,7 +230,11 @@ class RegExpRule : public AbstractRule {
     bool minimal;
     bool wordStart;
     bool lineStart;
-    QRegularExpression regExp;
+    QRegularExpression regExp; // not compiled if nativeRegExp is valid
+    NativeRegExp nativeRegExp;
+    QString literalPrefix;
+    StartCharSet startChars;
+    mutable DynamicPatternCache<QRegularExpression> dynamicRegExps;
 };
 
 class AbstractNumberRule : public AbstractRule {
@@ -191,11 +242,11 @@ class AbstractNumberRule : public AbstractRule {
     AbstractNumberRule(const AbstractRuleParams &params, const QList<RulePtr> &childRules);
 
     void printDescription(QTextStream &out) const override;
+    size_t memoryUsage() const override;
 
   protected:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
-    virtual int tryMatchText(const QStringView &text) const = 0;
-    int countDigits(const QStringView &text) const;
+    virtual int tryMatchText(const TextToMatch &textToMatch) const = 0;
 
     QList<RulePtr> childRules;
 };
@@ -205,9 +256,10 @@ class IntRule : public AbstractNumberRule {
 
   public:
     QString name() const override { return "Int"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
-    virtual int tryMatchText(const QStringView &text) const override;
+    virtual int tryMatchText(const TextToMatch &textToMatch) const override;
 };
 
 class FloatRule : public AbstractNumberRule {
@@ -215,9 +267,10 @@ class FloatRule : public AbstractNumberRule {
 
   public:
     QString name() const override { return "Float"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
-    int tryMatchText(const QStringView &text) const override;
+    int tryMatchText(const TextToMatch &textToMatch) const override;
 };
 
 class HlCOctRule : public AbstractRule {
@@ -225,6 +278,7 @@ class HlCOctRule : public AbstractRule {
 
   public:
     QString name() const override { return "HlCOct"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -235,6 +289,7 @@ class HlCHexRule : public AbstractRule {
 
   public:
     QString name() const override { return "HlCHex"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -245,6 +300,7 @@ class HlCStringCharRule : public AbstractRule {
 
   public:
     QString name() const override { return "HlCStringChar"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -255,6 +311,7 @@ class HlCCharRule : public AbstractRule {
 
   public:
     QString name() const override { return "HlCChar"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -265,6 +322,7 @@ class RangeDetectRule : public AbstractRule {
     RangeDetectRule(const AbstractRuleParams &params, const QString &char0, const QString &char1);
     QString name() const override { return "RangeDetect"; }
     QString args() const override;
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -278,6 +336,8 @@ class LineContinueRule : public AbstractRule {
 
   public:
     QString name() const override { return "LineContinue"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
+    void fillRecord(RuleRecord &record) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -291,13 +351,15 @@ class IncludeRulesRule : public AbstractRule {
     QString args() const override { return contextName; }
 
     void resolveContextReferences(const QHash<QString, ContextPtr> &contexts,
-                                  QString &error) override;
+                                  ExternalContexts &externalContexts, QString &error) override;
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &visiting) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
 
     QString contextName;
     ContextPtr context;
+    ExternalContextPtr externalContext; // loaded when the rule is reached first time
 };
 
 class DetectSpacesRule : public AbstractRule {
@@ -305,6 +367,8 @@ class DetectSpacesRule : public AbstractRule {
 
   public:
     QString name() const override { return "DetectSpaces"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
+    void fillRecord(RuleRecord &record) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -315,6 +379,8 @@ class DetectIdentifierRule : public AbstractRule {
 
   public:
     QString name() const override { return "DetectIdentifier"; }
+    void collectStartChars(StartCharSet &chars, QSet<const Context *> &) const override;
+    void fillRecord(RuleRecord &record) const override;
 
   private:
     bool tryMatchImpl(const TextToMatch &textToMatch, MatchResult &result) const override;
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <bitset>
+
+#include <QChar>
+#include <QVector>
+
+namespace Qutepart {
+
+class ExternalContext;
+
+/* Set of characters a rule can possibly start matching at.
+ * ASCII characters are tracked one by one, all other characters share a single flag.
+ * A set marked as "any" could not be derived, and the rule must be tried on every character.
+ */
+class StartCharSet {
+  public:
+    inline void add(QChar ch) {
+        auto code = ch.unicode();
+        if (code < ascii.size()) {
+            ascii.set(code);
+        } else {
+            nonAscii = true;
+        }
+    }
+
+    // Add a character the way case insensitive matching sees it
+    inline void addCaseInsensitive(QChar ch) {
+        add(ch);
+        add(ch.toLower());
+        add(ch.toUpper());
+        if (ch.isLetter()) {
+            // some non-ASCII letters fold to ASCII ones, i.e. KELVIN SIGN
+            nonAscii = true;
+        }
+    }
+
+    inline void addAll() { any = true; }
+
+    // The set is "any" until the included language is loaded
+    inline void addUnresolved(const ExternalContext *context) {
+        any = true;
+        unresolved.append(context);
+    }
+
+    inline void unite(const StartCharSet &other) {
+        ascii |= other.ascii;
+        nonAscii = nonAscii || other.nonAscii;
+        any = any || other.any;
+        unresolved += other.unresolved;
+    }
+
+    inline bool isAny() const { return any; }
+
+    inline bool containsAscii(ushort code) const { return any || ascii.test(code); }
+    inline bool containsNonAscii() const { return any || nonAscii; }
+
+    inline bool contains(QChar ch) const {
+        auto code = ch.unicode();
+        return code < ascii.size() ? containsAscii(code) : containsNonAscii();
+    }
+
+    std::bitset<128> ascii;
+    bool nonAscii = false;
+    bool any = false;
+    QVector<const ExternalContext *> unresolved;
+};
+
+} // namespace Qutepart
@@ -5,6 +5,8 @@
  */
 
 #include <QGuiApplication>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QStyleHints>
 
 #include "style.h"
@@ -16,18 +18,20 @@ static bool isDarkPalette() {
     return QGuiApplication::styleHints()->colorScheme() == Qt::ColorScheme::Dark;
 }
 
-auto static applyTheme(QTextCharFormat &format, const Theme *theme, QStringView defStyle) -> void {
+auto static applyTheme(QTextCharFormat &format,
+                       const QHash<QString, QHash<QString, QString>> &textStyles,
+                       QStringView defStyle) -> void {
     auto fixedName = defStyle.toString().mid(2);
-    if (!theme->getTextStyles().contains(fixedName)) {
+    if (!textStyles.contains(fixedName)) {
         return;
     }
 
 #if 0
     qDebug() << "Patching (context)" << fixedName
-        << "color:" << format.foreground().color().name(QColor::HexRgb) << " -> " << theme->textStyles[fixedName].value("text-color");
+        << "color:" << format.foreground().color().name(QColor::HexRgb) << " -> " << textStyles[fixedName].value("text-color");
 #endif
 
-    auto styleProperties = theme->getTextStyles()[fixedName];
+    auto styleProperties = textStyles[fixedName];
     for (auto it = styleProperties.constBegin(); it != styleProperties.constEnd(); ++it) {
         auto &key = it.key();
         auto &value = it.value();
@@ -65,14 +69,12 @@ auto static applyTheme(QTextCharFormat &format, const Theme *theme, QStringView
     }
 }
 
-QSharedPointer<QTextCharFormat> defaultFormat(const QString &style, QString &error) {
+QSharedPointer<QTextCharFormat> defaultFormat(const QString &style, bool dark, QString &error) {
     auto bold = false;
     auto underline = false;
     QString colorName;
     QString bgColorName;
 
-    const bool dark = isDarkPalette();
-
     if (style == "dsNormal") {
     } else if (style == "dsKeyword") {
         bold = true;
@@ -166,9 +168,9 @@ QSharedPointer<QTextCharFormat> defaultFormat(const QString &style, QString &err
 }
 
 QSharedPointer<QTextCharFormat> makeFormat(const QString &defStyle, const QString &color,
-                                           const QString & /*selColor*/,
-                                           const QHash<QString, bool> &flags, QString &error) {
-    auto format = defaultFormat(defStyle, error);
+                                           const QHash<QString, bool> &flags, bool dark,
+                                           QString &error) {
+    auto format = defaultFormat(defStyle, dark, error);
     if (!error.isNull()) {
         return {};
     }
@@ -224,43 +226,137 @@ char detectTextType(const QString &attribute, const QString &defStyleName) {
     return ' ';
 }
 
-Style makeStyle(const QString &defStyleName, const QString &color, const QString &selColor,
+namespace {
+
+// What the syntax file says about a style. Formats are made from it by StyleTable
+struct StyleDefinition {
+    QString defStyleName;
+    QString color;
+    QHash<QString, bool> flags;
+};
+
+QList<StyleDefinition> registeredStyles;
+QHash<QString, int> registeredStyleIds; // by styleKey()
+QReadWriteLock registeredStylesLock;
+
+QString styleKey(const QString &defStyleName, const QString &color,
+                 const QHash<QString, bool> &flags) {
+    QString key = defStyleName + '|' + color;
+    for (const auto &flagName : {"italic", "bold", "underline", "strikeout"}) {
+        key += '|';
+        if (flags.contains(flagName)) {
+            key += flags[flagName] ? '1' : '0';
+        }
+    }
+    return key;
+}
+
+int registerStyle(const QString &defStyleName, const QString &color,
+                  const QHash<QString, bool> &flags) {
+    auto key = styleKey(defStyleName, color, flags);
+    {
+        QReadLocker locker(&registeredStylesLock);
+        auto it = registeredStyleIds.constFind(key);
+        if (it != registeredStyleIds.constEnd()) {
+            return it.value();
+        }
+    }
+
+    QWriteLocker locker(&registeredStylesLock);
+    auto it = registeredStyleIds.constFind(key);
+    if (it != registeredStyleIds.constEnd()) {
+        return it.value();
+    }
+    int id = registeredStyles.size();
+    registeredStyles.append({defStyleName, color, flags});
+    registeredStyleIds.insert(key, id);
+    return id;
+}
+
+} // namespace
+
+Style makeStyle(const QString &defStyleName, const QString &color, const QString & /*selColor*/,
                 const QHash<QString, bool> &flags, QString &error) {
-    auto format = makeFormat(defStyleName, color, selColor, flags, error);
+    // Only validates the style, the formats are made for a theme by StyleTable
+    defaultFormat(defStyleName, false, error);
     if (!error.isNull()) {
         return Style();
     }
 
-    return Style(defStyleName, format);
+    return Style(registerStyle(defStyleName, color, flags), defStyleName);
 }
 
-Style::Style() : _textType(' ') {
-    // displayFormat = QSharedPointer<QTextCharFormat>(new QTextCharFormat());
-}
+Style::Style() : _textType(' ') {}
 
-Style::Style(const QString &defStyleName, QSharedPointer<QTextCharFormat> format)
-    : savedFormat(format), _textType(detectTextType(QString(), defStyleName)),
-      defStyleName(defStyleName) {
-    displayFormat = QSharedPointer<QTextCharFormat>(new QTextCharFormat());
-    *displayFormat = *savedFormat;
-}
+Style::Style(int id, const QString &defStyleName)
+    : _id(id), _textType(detectTextType(QString(), defStyleName)), defStyleName(defStyleName) {}
 
 void Style::updateTextType(const QString &attribute) {
     _textType = detectTextType(attribute, defStyleName);
 }
 
-void Style::setTheme(const Theme *newTheme) {
-    if (this->theme == newTheme) {
-        return;
+QSharedPointer<const StyleTable> StyleTable::get(const Theme *theme) {
+    // By content, not by the theme pointer: themes are reloaded in place, and freed
+    static QMutex tablesLock;
+    static QList<QWeakPointer<const StyleTable>> tables;
+
+    QHash<QString, QHash<QString, QString>> textStyles;
+    if (theme != nullptr) {
+        textStyles = theme->getTextStyles();
     }
-    this->theme = newTheme;
-    if (!displayFormat) {
-        return;
+    bool dark = isDarkPalette();
+
+    QMutexLocker locker(&tablesLock);
+    QSharedPointer<const StyleTable> result;
+    for (auto it = tables.begin(); it != tables.end();) {
+        auto table = it->toStrongRef();
+        if (table.isNull()) {
+            it = tables.erase(it);
+            continue;
+        }
+        if (result.isNull() && table->dark == dark && table->textStyles == textStyles) {
+            result = table;
+        }
+        ++it;
+    }
+
+    if (result.isNull()) {
+        result = QSharedPointer<const StyleTable>(new StyleTable(textStyles, dark));
+        tables.append(result);
     }
-    *displayFormat = *savedFormat;
-    if (newTheme) {
-        applyTheme(*displayFormat, newTheme, defStyleName);
+    return result;
+}
+
+StyleTable::StyleTable(const QHash<QString, QHash<QString, QString>> &textStyles, bool dark)
+    : textStyles(textStyles), dark(dark) {}
+
+const QTextCharFormat *StyleTable::format(int styleId) const {
+    if (styleId < 0) {
+        return nullptr;
+    }
+
+    {
+        QReadLocker locker(&lock);
+        if (size_t(styleId) < formats.size()) {
+            return &formats[styleId];
+        }
+    }
+
+    QWriteLocker locker(&lock);
+    QReadLocker registryLocker(&registeredStylesLock);
+    while (formats.size() < size_t(registeredStyles.size()) && formats.size() <= size_t(styleId)) {
+        const auto &definition = registeredStyles[formats.size()];
+        QString error;
+        auto format = makeFormat(definition.defStyleName, definition.color, definition.flags,
+                                 dark, error);
+        formats.push_back(format.isNull() ? QTextCharFormat() : *format);
+        applyTheme(formats.back(), textStyles, definition.defStyleName);
+    }
+
+    if (size_t(styleId) < formats.size()) {
+        return &formats[styleId];
     }
+    return nullptr;
 }
 
 } // namespace Qutepart
@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <deque>
+
+#include <QHash>
+#include <QReadWriteLock>
 #include <QSharedPointer>
 #include <QTextCharFormat>
 
@@ -13,33 +17,57 @@ namespace Qutepart {
 
 class Theme;
 
+/* Style of a context or a rule. Part of the grammar, so it does not depend on the theme.
+ * The format is looked up by id() in the StyleTable of the theme.
+ */
 class Style {
   public:
     Style();
-    Style(const QString &defStyleName, QSharedPointer<QTextCharFormat> format);
+    Style(int id, const QString &defStyleName);
 
     /* Called by some clients.
        If the style knows attribute it can better detect textType
      */
     void updateTextType(const QString &attribute);
 
+    // Index in StyleTable, -1 if the style has no format
+    inline int id() const { return _id; }
     inline char textType() const { return _textType; }
     inline const QStringView getDefStyle() const { return defStyleName; }
-    inline const QSharedPointer<QTextCharFormat> format() const { return displayFormat; }
-
-    void setTheme(const Theme *newTheme);
-    inline const Theme *getTheme() const { return theme; }
 
   private:
-    QSharedPointer<QTextCharFormat> savedFormat;
-    QSharedPointer<QTextCharFormat> displayFormat;
+    int _id = -1;
     char _textType;
 
     QString defStyleName;
-    const Theme *theme = nullptr;
 };
 
+// Registers the style. Equal styles of all the languages get the same id
 Style makeStyle(const QString &defStyleName, const QString &color, const QString & /*selColor*/,
                 const QHash<QString, bool> &flags, QString &error);
 
+/* Formats of all the registered styles, for the text styles of a theme and a palette (dark or
+ * light). Shared by all the documents using themes with the same text styles. Formats are made
+ * when first used. Thread safe, the returned pointers stay valid as long as the table.
+ */
+class StyleTable {
+  public:
+    /* The table of the current text styles of the theme and palette. nullptr for the default
+     * formats. A theme loaded again gets a new table, if the styles changed
+     */
+    static QSharedPointer<const StyleTable> get(const Theme *theme);
+
+    // nullptr for -1
+    const QTextCharFormat *format(int styleId) const;
+
+  private:
+    StyleTable(const QHash<QString, QHash<QString, QString>> &textStyles, bool dark);
+
+    QHash<QString, QHash<QString, QString>> textStyles;
+    bool dark;
+
+    mutable QReadWriteLock lock;
+    mutable std::deque<QTextCharFormat> formats; // not moved when growing
+};
+
 } // namespace Qutepart
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include <QDebug>
+#include <QResource>
+#include <QtEndian>
+
+#include "syntax_bundle.h"
+
+#ifdef QUTEPART_SYNTAX_BUNDLE
+// Q_INIT_RESOURCE() can't be used in a namespace
+static void initSyntaxBundleResource() { Q_INIT_RESOURCE(qutepart_syntax_files); }
+#endif
+
+namespace Qutepart {
+
+namespace {
+
+const quint32 HEADER_WORDS = 6;
+
+inline quint32 tokenType(const quint32 *token) { return *token & 0xff; }
+
+inline quint32 attributeCount(const quint32 *token) { return *token >> 8; }
+
+} // namespace
+
+QByteArray SyntaxBundle::compile(const QList<QPair<QString, QByteArray>> &xmlFiles,
+                                 QString &error) {
+    QList<quint32> strings;
+    QString pool;
+    QHash<QString, quint32> stringIds;
+
+    auto intern = [&](QStringView view) -> quint32 {
+        auto str = view.toString();
+        auto it = stringIds.constFind(str);
+        if (it != stringIds.constEnd()) {
+            return it.value();
+        }
+        quint32 id = strings.size() / 2;
+        strings << quint32(pool.size()) << quint32(str.size());
+        pool += str;
+        stringIds.insert(str, id);
+        return id;
+    };
+
+    auto sortedFiles = xmlFiles;
+    std::sort(sortedFiles.begin(), sortedFiles.end(),
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    QList<quint32> files;
+    QList<quint32> tokens;
+    for (const auto &[fileName, contents] : std::as_const(sortedFiles)) {
+        files << intern(fileName) << quint32(tokens.size());
+
+        /* Whitespace is kept only if it is the text of an element, as in <item> </item>,
+         * readElementText() returns it
+         */
+        QString pendingWhitespace;
+        bool inText = false;
+
+        QXmlStreamReader xmlReader(contents);
+        while (!xmlReader.atEnd()) {
+            switch (xmlReader.readNext()) {
+            case QXmlStreamReader::StartElement: {
+                auto attrs = xmlReader.attributes();
+                quint32 header = StartElement | (quint32(attrs.size()) << 8);
+                tokens << header << intern(xmlReader.name());
+                for (const auto &attr : std::as_const(attrs)) {
+                    tokens << intern(attr.name()) << intern(attr.value());
+                }
+                pendingWhitespace.clear();
+                inText = true;
+                break;
+            }
+            case QXmlStreamReader::Characters:
+                if (xmlReader.isWhitespace()) {
+                    if (inText) {
+                        pendingWhitespace += xmlReader.text();
+                    }
+                } else {
+                    tokens << Text << intern(pendingWhitespace + xmlReader.text());
+                    pendingWhitespace.clear();
+                }
+                break;
+            case QXmlStreamReader::EndElement:
+                if (!pendingWhitespace.isEmpty()) {
+                    tokens << Text << intern(pendingWhitespace);
+                    pendingWhitespace.clear();
+                }
+                tokens << EndElement << intern(xmlReader.name());
+                inText = false;
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (xmlReader.hasError()) {
+            error = QString("%1:%2: %3")
+                        .arg(fileName)
+                        .arg(xmlReader.lineNumber())
+                        .arg(xmlReader.errorString());
+            return QByteArray();
+        }
+
+        files << quint32(tokens.size()) - files.last();
+    }
+
+    QByteArray result;
+    auto appendWord = [&result](quint32 word) {
+        auto littleEndian = qToLittleEndian(word);
+        result.append(reinterpret_cast<const char *>(&littleEndian), sizeof(littleEndian));
+    };
+
+    appendWord(MAGIC);
+    appendWord(VERSION);
+    appendWord(strings.size() / 2);
+    appendWord(pool.size());
+    appendWord(files.size() / 3);
+    appendWord(tokens.size());
+    for (auto section : {&strings, &files, &tokens}) {
+        for (auto word : std::as_const(*section)) {
+            appendWord(word);
+        }
+    }
+    for (auto chr : std::as_const(pool)) {
+        auto littleEndian = qToLittleEndian(quint16(chr.unicode()));
+        result.append(reinterpret_cast<const char *>(&littleEndian), sizeof(littleEndian));
+    }
+    if (result.size() % 4 != 0) {
+        result.append(2, '\0');
+    }
+
+    return result;
+}
+
+const SyntaxBundle *SyntaxBundle::builtIn() {
+    static const SyntaxBundle *bundle = []() -> const SyntaxBundle * {
+#ifdef QUTEPART_SYNTAX_BUNDLE
+        initSyntaxBundleResource();
+#endif
+        QResource resource(":/qutepart/syntax.bundle");
+        if (!resource.isValid()) {
+            return nullptr;
+        }
+
+        static SyntaxBundle instance;
+        if (!instance.load(resource.uncompressedData())) {
+            qWarning() << "Ignoring syntax bundle of another version, loading XML syntax files";
+            return nullptr;
+        }
+        return &instance;
+    }();
+
+    return bundle;
+}
+
+bool SyntaxBundle::load(const QByteArray &newData) {
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    // The bundle is read in place
+    Q_UNUSED(newData);
+    return false;
+#else
+    fileIndex.clear();
+    data = newData;
+    // Not compressed resources are not copied, but might be not aligned
+    if (quintptr(data.constData()) % alignof(quint32) != 0) {
+        data = QByteArray(newData.constData(), newData.size());
+    }
+
+    auto words = reinterpret_cast<const quint32 *>(data.constData());
+    auto wordCount = quint64(data.size()) / sizeof(quint32);
+    if (wordCount < HEADER_WORDS || words[0] != MAGIC || words[1] != VERSION) {
+        return false;
+    }
+
+    quint64 stringCount = words[2];
+    quint64 poolSize = words[3];
+    quint64 fileCount = words[4];
+    quint64 tokenCount = words[5];
+    quint64 requiredWords =
+        HEADER_WORDS + stringCount * 2 + fileCount * 3 + tokenCount + (poolSize + 1) / 2;
+    if (wordCount < requiredWords) {
+        return false;
+    }
+
+    strings = words + HEADER_WORDS;
+    auto files = strings + stringCount * 2;
+    auto tokens = files + fileCount * 3;
+    pool = reinterpret_cast<const char16_t *>(tokens + tokenCount);
+
+    fileIndex.reserve(fileCount);
+    for (quint64 i = 0; i < fileCount; i++) {
+        auto fileWords = files + i * 3;
+        if (fileWords[0] >= stringCount || quint64(fileWords[1]) + fileWords[2] > tokenCount) {
+            fileIndex.clear();
+            return false;
+        }
+        File file;
+        file.tokens = tokens + fileWords[1];
+        file.tokensEnd = file.tokens + fileWords[2];
+        fileIndex.insert(string(fileWords[0]).toString(), file);
+    }
+
+    return true;
+#endif
+}
+
+SyntaxAttributes::SyntaxAttributes(const QXmlStreamAttributes &attrs) : xmlAttributes(attrs) {
+    for (const auto &attr : std::as_const(xmlAttributes)) {
+        append(attr.name(), attr.value());
+    }
+}
+
+void SyntaxAttributes::append(QStringView name, QStringView value) {
+    Attribute attr;
+    attr.nameView = name;
+    attr.valueView = value;
+    items.append(attr);
+}
+
+bool SyntaxAttributes::hasAttribute(const QString &name) const {
+    return std::any_of(items.begin(), items.end(),
+                       [&name](const Attribute &attr) { return attr.nameView == name; });
+}
+
+QStringView SyntaxAttributes::value(const QString &name) const {
+    for (const auto &attr : items) {
+        if (attr.nameView == name) {
+            return attr.valueView;
+        }
+    }
+    return QStringView();
+}
+
+SyntaxReader::SyntaxReader(QXmlStreamReader &xmlReader, const QString &fileName)
+    : xmlReader(&xmlReader), fileName(fileName) {}
+
+SyntaxReader::SyntaxReader(const SyntaxBundle &bundle, const QString &fileName)
+    : fileName(fileName), bundle(&bundle) {
+    auto file = bundle.file(fileName);
+    next = file.tokens;
+    tokensEnd = file.tokensEnd;
+}
+
+void SyntaxReader::readNextToken() {
+    if (next >= tokensEnd) {
+        token = tokensEnd;
+        return;
+    }
+
+    token = next;
+    if (tokenType(token) == SyntaxBundle::StartElement) {
+        next = token + 2 + attributeCount(token) * 2;
+    } else {
+        next = token + 2;
+    }
+}
+
+bool SyntaxReader::readNextStartElement() {
+    if (xmlReader) {
+        return xmlReader->readNextStartElement();
+    }
+
+    // The bundle has no comments, and text outside of elements is dropped
+    readNextToken();
+    while (!atEnd() && tokenType(token) == SyntaxBundle::Text) {
+        readNextToken();
+    }
+    return !atEnd() && tokenType(token) == SyntaxBundle::StartElement;
+}
+
+QString SyntaxReader::readElementText() {
+    if (xmlReader) {
+        return xmlReader->readElementText();
+    }
+
+    QString text;
+    int depth = 0;
+    for (readNextToken(); !atEnd(); readNextToken()) {
+        auto type = tokenType(token);
+        if (type == SyntaxBundle::Text && depth == 0) {
+            text += bundle->string(token[1]);
+        } else if (type == SyntaxBundle::StartElement) {
+            depth++;
+        } else if (type == SyntaxBundle::EndElement) {
+            if (depth == 0) {
+                break;
+            }
+            depth--;
+        }
+    }
+    return text;
+}
+
+bool SyntaxReader::atEnd() const {
+    if (xmlReader) {
+        return xmlReader->atEnd();
+    }
+    return token == tokensEnd;
+}
+
+bool SyntaxReader::isEndElement() const {
+    if (xmlReader) {
+        return xmlReader->isEndElement();
+    }
+    return token != nullptr && !atEnd() && tokenType(token) == SyntaxBundle::EndElement;
+}
+
+QStringView SyntaxReader::name() const {
+    if (xmlReader) {
+        return xmlReader->name();
+    }
+    if (token == nullptr || atEnd() || tokenType(token) == SyntaxBundle::Text) {
+        return QStringView();
+    }
+    return bundle->string(token[1]);
+}
+
+SyntaxAttributes SyntaxReader::attributes() const {
+    if (xmlReader) {
+        return SyntaxAttributes(xmlReader->attributes());
+    }
+
+    SyntaxAttributes attrs;
+    if (token != nullptr && !atEnd() && tokenType(token) == SyntaxBundle::StartElement) {
+        for (quint32 i = 0; i < attributeCount(token); i++) {
+            attrs.append(bundle->string(token[2 + i * 2]), bundle->string(token[3 + i * 2]));
+        }
+    }
+    return attrs;
+}
+
+QString SyntaxReader::location() const {
+    if (xmlReader) {
+        return QString("%1:%2").arg(fileName).arg(xmlReader->lineNumber());
+    }
+    return QString("%1 (syntax bundle)").arg(fileName);
+}
+
+} // namespace Qutepart
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QString>
+#include <QStringView>
+#include <QVarLengthArray>
+#include <QXmlStreamReader>
+
+namespace Qutepart {
+
+/* Precompiled syntax files.
+ *
+ * The XML of all syntax files is tokenized once at build time (see tools/syntax_compiler.cpp)
+ * into a binary bundle, embedded as :/qutepart/syntax.bundle. Loading a language from the
+ * bundle skips the XML parsing, entity decoding and the allocation of every attribute string.
+ *
+ * Layout, all the fields are little endian quint32, sections are 4 bytes aligned:
+ *
+ *     header       magic, version, string count, pool size, file count, token word count
+ *     strings      (offset, length) in the pool, for every string
+ *     files        (name string, first token word, token word count), sorted by name
+ *     tokens       the element tree of all the files, see SyntaxBundle::TokenType
+ *     pool         UTF-16 characters of all the strings. Every string is stored once
+ */
+class SyntaxBundle {
+  public:
+    static constexpr quint32 MAGIC = 0x42535051; // "QPSB"
+    static constexpr quint32 VERSION = 1;
+
+    /* Start element: type | attribute count << 8, name, (attribute name, value) * count
+     * Text: type, text. Whitespace only text between elements is dropped
+     * End element: type, name
+     */
+    enum TokenType : quint32 { StartElement = 1, Text = 2, EndElement = 3 };
+
+    struct File {
+        const quint32 *tokens = nullptr;
+        const quint32 *tokensEnd = nullptr;
+    };
+
+    /* Compile XML files, (file name, contents) pairs, to a bundle.
+     * Returns an empty array and sets error if a file is not valid XML
+     */
+    static QByteArray compile(const QList<QPair<QString, QByteArray>> &xmlFiles,
+                              QString &error);
+
+    /* The bundle built into the library, nullptr if it is not there or was built by another
+     * version
+     */
+    static const SyntaxBundle *builtIn();
+
+    SyntaxBundle() = default;
+
+    // false if data is not a bundle of this version. data must stay alive
+    bool load(const QByteArray &data);
+
+    bool isEmpty() const { return fileIndex.isEmpty(); }
+    bool contains(const QString &fileName) const { return fileIndex.contains(fileName); }
+    File file(const QString &fileName) const { return fileIndex.value(fileName); }
+
+    inline QStringView string(quint32 index) const {
+        return QStringView(pool + strings[index * 2], qsizetype(strings[index * 2 + 1]));
+    }
+
+  private:
+    QByteArray data;
+    const quint32 *strings = nullptr;
+    const char16_t *pool = nullptr;
+    QHash<QString, File> fileIndex;
+};
+
+/* Attributes of an element, the subset of QXmlStreamAttributes the loader uses */
+class SyntaxAttributes {
+  public:
+    SyntaxAttributes() = default;
+    SyntaxAttributes(const QXmlStreamAttributes &xmlAttributes);
+
+    void append(QStringView name, QStringView value);
+
+    bool hasAttribute(const QString &name) const;
+    // Null if not set
+    QStringView value(const QString &name) const;
+
+    class Attribute {
+      public:
+        QStringView name() const { return nameView; }
+        QStringView value() const { return valueView; }
+
+      private:
+        friend class SyntaxAttributes;
+        QStringView nameView;
+        QStringView valueView;
+    };
+
+    const Attribute *begin() const { return items.begin(); }
+    const Attribute *end() const { return items.end(); }
+
+  private:
+    // Keeps the strings of XML attributes alive, bundle strings live in the bundle
+    QXmlStreamAttributes xmlAttributes;
+    QVarLengthArray<Attribute, 8> items;
+};
+
+/* Reads a syntax file either from XML or from the bundle.
+ * Has the subset of the QXmlStreamReader API the loader uses, with the same semantics
+ */
+class SyntaxReader {
+  public:
+    SyntaxReader(QXmlStreamReader &xmlReader, const QString &fileName);
+    SyntaxReader(const SyntaxBundle &bundle, const QString &fileName);
+
+    bool readNextStartElement();
+    // Current token must be a start element. Reads to its end element
+    QString readElementText();
+
+    bool atEnd() const;
+    bool isEndElement() const;
+    QStringView name() const;
+    SyntaxAttributes attributes() const;
+
+    // File name and position, for diagnostics
+    QString location() const;
+
+  private:
+    QXmlStreamReader *xmlReader = nullptr;
+    QString fileName;
+
+    const SyntaxBundle *bundle = nullptr;
+    const quint32 *token = nullptr; // current token
+    const quint32 *next = nullptr;
+    const quint32 *tokensEnd = nullptr;
+
+    void readNextToken();
+};
+
+} // namespace Qutepart
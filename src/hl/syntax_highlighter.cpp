@@ -4,7 +4,11 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <algorithm>
+
+#include <QAtomicInt>
 #include <QTextLayout>
+#include <QThreadPool>
 #include <Qt>
 
 #include "language.h"
@@ -13,20 +17,376 @@
 
 namespace Qutepart {
 
+namespace {
+
+int newStyleGeneration() {
+    static QAtomicInt lastGeneration;
+    return lastGeneration.fetchAndAddRelaxed(1) + 1;
+}
+
+} // namespace
+
 SyntaxHighlighter::SyntaxHighlighter(QTextDocument *parent, QSharedPointer<Language> language)
-    : QSyntaxHighlighter(parent), language(language) {}
+    : QSyntaxHighlighter(parent), language(language) {
+    init();
+}
 
 SyntaxHighlighter::SyntaxHighlighter(QObject *parent, QSharedPointer<Language> language)
-    : QSyntaxHighlighter(parent), language(language) {}
+    : QSyntaxHighlighter(parent), language(language) {
+    init();
+}
+
+void SyntaxHighlighter::init() {
+    styles = StyleTable::get(nullptr);
+    firstStyleGeneration_ = styleGeneration_ = newStyleGeneration();
+    backgroundTimer_.setSingleShot(true);
+    backgroundTimer_.setInterval(0);
+    connect(&backgroundTimer_, &QTimer::timeout, this, &SyntaxHighlighter::onBackgroundSlice);
+}
+
+void SyntaxHighlighter::setTheme(const Theme *t) {
+    // Also for the same theme, it may have been loaded again
+    styles = StyleTable::get(t);
+    styleGeneration_ = newStyleGeneration();
+    if (document() == nullptr) {
+        return;
+    }
+
+    restyleNext_ = QTextCursor(document()->firstBlock());
+    restyleVisibleBlocks();
+    backgroundTimer_.start();
+}
+
+void SyntaxHighlighter::setTimeSliceBudget(int msec) {
+    timeSliceBudget_ = msec;
+    if (isHighlightingPending()) {
+        backgroundTimer_.start();
+    }
+}
+
+void SyntaxHighlighter::setVisibleBlocks(int firstBlockNumber, int lastBlockNumber) {
+    if (firstBlockNumber == firstVisibleBlock_ && lastBlockNumber == lastVisibleBlock_) {
+        return;
+    }
+
+    firstVisibleBlock_ = firstBlockNumber;
+    lastVisibleBlock_ = lastBlockNumber;
+    if (isHighlightingPending() || isRestylePending()) {
+        // the viewport moved, the slice in progress continues from the new visible blocks
+        visibleBlocksChanged_ = true;
+        backgroundTimer_.start();
+    }
+}
+
+bool SyntaxHighlighter::isHighlightingPending() const { return !pendingFirst_.isNull(); }
+
+int SyntaxHighlighter::pendingBlockCount() const {
+    if (!isHighlightingPending()) {
+        return 0;
+    }
+    return lastPendingBlock() - firstPendingBlock() + 1;
+}
 
 void SyntaxHighlighter::highlightBlock(const QString &) {
-    QVector<QTextLayout::FormatRange> formats;
+    auto block = currentBlock();
+    if (restyling_) {
+        // The state is not changed, QSyntaxHighlighter does not continue to the next block
+        auto data = static_cast<TextBlockUserData *>(block.userData());
+        for (const auto &run : std::as_const(data->styleRuns)) {
+            auto format = styles->format(run.styleId);
+            if (format != nullptr) {
+                setFormat(run.start, run.length, *format);
+            }
+        }
+        data->styleGeneration = styleGeneration_;
+        return;
+    }
+
+    auto blockNumber = block.blockNumber();
+    startRunIfNeeded(blockNumber);
+
+    // The start state is known, if the previous block is not pending
+    auto startStateKnown = !isHighlightingPending() || blockNumber <= firstPendingBlock() ||
+                           blockNumber > lastPendingBlock() + 1;
+
+    if (!isVisible(blockNumber) && !(startStateKnown && hasTimeLeft())) {
+        keepPreviousFormats(block);
+        markPending(block);
+        return;
+    }
 
-    auto state = language->highlightBlock(currentBlock(), formats);
-    for (auto &range : std::as_const(formats)) {
+    formats_.clear();
+    auto precomputed = precomputedLine(block);
+    auto state = precomputed != nullptr
+                     ? language->applyHighlightedLine(block, *precomputed, *styles, formats_)
+                     : language->highlightBlock(block, *styles, formats_);
+    for (auto &range : std::as_const(formats_)) {
         setFormat(range.start, range.length, range.format);
     }
     setCurrentBlockState(state);
+    static_cast<TextBlockUserData *>(block.userData())->styleGeneration = styleGeneration_;
+
+    if (startStateKnown) {
+        markHighlighted(block);
+    } else {
+        // visible block highlighted with a guessed start state, it is done again later
+        markPending(block);
+    }
+}
+
+void SyntaxHighlighter::onBackgroundSlice() {
+    if (document() == nullptr) {
+        return;
+    }
+
+    auto highlighting = isHighlightingPending();
+    inBackgroundSlice_ = true;
+    runTimer_.start();
+
+    if (visibleBlocksChanged_) {
+        visibleBlocksChanged_ = false;
+        restyleVisibleBlocks();
+        highlightVisibleBlocks();
+    }
+
+    restyleNextBlocks();
+    while (isHighlightingPending() && hasTimeLeft()) {
+        if (!highlightPendingInParallel()) {
+            rehighlightBlock(pendingFirst_.block());
+        }
+    }
+    inBackgroundSlice_ = false;
+
+    if (highlighting) {
+        auto totalBlocks = document()->blockCount();
+        emit highlightingProgress(totalBlocks - pendingBlockCount(), totalBlocks);
+        if (!isHighlightingPending()) {
+            emit highlightingFinished();
+        }
+    }
+
+    if (isHighlightingPending() || isRestylePending()) {
+        backgroundTimer_.start();
+    }
+}
+
+bool SyntaxHighlighter::hasTimeLeft() const {
+    return timeSliceBudget_ <= 0 || runTimer_.elapsed() < timeSliceBudget_;
+}
+
+/* QSyntaxHighlighter highlights consecutive blocks of the same document revision in one run.
+ * Anything else is a new run, with a new budget. Background slices set the budget themselves.
+ */
+void SyntaxHighlighter::startRunIfNeeded(int blockNumber) {
+    auto revision = document()->revision();
+    if (!inBackgroundSlice_ && (!runTimer_.isValid() || blockNumber != lastBlockNumber_ + 1 ||
+                                revision != lastRevision_)) {
+        runTimer_.start();
+    }
+    lastBlockNumber_ = blockNumber;
+    lastRevision_ = revision;
+}
+
+bool SyntaxHighlighter::isVisible(int blockNumber) const {
+    return blockNumber >= firstVisibleBlock_ && blockNumber <= lastVisibleBlock_;
+}
+
+/* QSyntaxHighlighter drops the formats of a block, which were not set while highlighting it.
+ * Set them again, so that the block does not flicker until the background slice reaches it.
+ * State is not changed, so QSyntaxHighlighter does not continue to the next block.
+ */
+void SyntaxHighlighter::keepPreviousFormats(const QTextBlock &block) {
+    const auto formats = block.layout()->formats();
+    for (const auto &range : formats) {
+        setFormat(range.start, range.length, range.format);
+    }
+}
+
+void SyntaxHighlighter::markPending(const QTextBlock &block) {
+    auto blockNumber = block.blockNumber();
+
+    if (!isHighlightingPending() || blockNumber < firstPendingBlock()) {
+        pendingFirst_ = QTextCursor(block);
+        pendingFirst_.setKeepPositionOnInsert(true);
+    }
+    if (pendingLast_.isNull() || blockNumber > lastPendingBlock()) {
+        pendingLast_ = QTextCursor(block);
+        pendingLast_.movePosition(QTextCursor::EndOfBlock);
+    }
+
+    if (!backgroundTimer_.isActive()) {
+        backgroundTimer_.start();
+    }
+}
+
+void SyntaxHighlighter::markHighlighted(const QTextBlock &block) {
+    if (!isHighlightingPending() || block.blockNumber() != firstPendingBlock()) {
+        return;
+    }
+
+    auto next = block.next();
+    if (!next.isValid() || block.blockNumber() >= lastPendingBlock()) {
+        pendingFirst_ = QTextCursor();
+        pendingLast_ = QTextCursor();
+        return;
+    }
+
+    pendingFirst_ = QTextCursor(next);
+    pendingFirst_.setKeepPositionOnInsert(true);
+}
+
+int SyntaxHighlighter::firstPendingBlock() const {
+    return isHighlightingPending() ? pendingFirst_.blockNumber() : -1;
+}
+
+int SyntaxHighlighter::lastPendingBlock() const {
+    if (!isHighlightingPending()) {
+        return -1;
+    }
+    // edits may move the end of the range before the beginning
+    return std::max(pendingFirst_.blockNumber(), pendingLast_.blockNumber());
+}
+
+void SyntaxHighlighter::highlightVisibleBlocks() {
+    auto blockNumber = std::max(firstVisibleBlock_, firstPendingBlock());
+    while (blockNumber <= lastVisibleBlock_ && isHighlightingPending()) {
+        if (blockNumber > lastPendingBlock()) {
+            break;
+        }
+        auto block = document()->findBlockByNumber(blockNumber);
+        if (!block.isValid()) {
+            break;
+        }
+        rehighlightBlock(block);
+        // QSyntaxHighlighter might have continued to the next blocks
+        blockNumber = std::max(blockNumber, lastBlockNumber_) + 1;
+    }
+}
+
+bool SyntaxHighlighter::needsRestyle(const QTextBlock &block) const {
+    auto data = static_cast<TextBlockUserData *>(block.userData());
+    return data != nullptr && data->styleGeneration >= firstStyleGeneration_ &&
+           data->styleGeneration < styleGeneration_;
+}
+
+void SyntaxHighlighter::restyleBlock(const QTextBlock &block) {
+    if (!needsRestyle(block)) {
+        return;
+    }
+    restyling_ = true;
+    rehighlightBlock(block);
+    restyling_ = false;
+}
+
+void SyntaxHighlighter::restyleVisibleBlocks() {
+    if (!isRestylePending()) {
+        return;
+    }
+    auto block = document()->findBlockByNumber(firstVisibleBlock_);
+    for (; block.isValid() && block.blockNumber() <= lastVisibleBlock_; block = block.next()) {
+        restyleBlock(block);
+    }
+}
+
+void SyntaxHighlighter::restyleNextBlocks() {
+    if (!isRestylePending()) {
+        return;
+    }
+    auto block = restyleNext_.block();
+    for (; block.isValid() && hasTimeLeft(); block = block.next()) {
+        restyleBlock(block);
+    }
+    restyleNext_ = block.isValid() ? QTextCursor(block) : QTextCursor();
+}
+
+/* Apply the lines of the batch to the pending blocks until the budget is spent. A new batch from
+ * the first pending block, which starts from a known state, is highlighted first if the previous
+ * one was applied or the document changed. Returns false if too few blocks are pending for a
+ * new batch.
+ */
+bool SyntaxHighlighter::highlightPendingInParallel() {
+    if (!hasParallelBatch()) {
+        clearParallelBatch();
+        if (parallelThreshold_ <= 0 || pendingBlockCount() < parallelThreshold_) {
+            return false;
+        }
+        highlightParallelBatch();
+    }
+
+    auto batchEnd = parallelFirstBlock_ + static_cast<int>(parallelLines_.size());
+    while (isHighlightingPending() && firstPendingBlock() < batchEnd && hasTimeLeft()) {
+        rehighlightBlock(pendingFirst_.block());
+    }
+    if (!hasParallelBatch()) {
+        clearParallelBatch();
+    }
+    return true;
+}
+
+// A batch is left, and the first pending block is in it
+bool SyntaxHighlighter::hasParallelBatch() const {
+    if (parallelFirstBlock_ < 0 || document()->revision() != parallelRevision_ ||
+        !isHighlightingPending()) {
+        return false;
+    }
+    auto index = firstPendingBlock() - parallelFirstBlock_;
+    return index >= 0 && index < parallelLines_.size();
+}
+
+void SyntaxHighlighter::highlightParallelBatch() {
+    QElapsedTimer batchTimer;
+    batchTimer.start();
+
+    auto first = pendingFirst_.block();
+    auto count = std::min(pendingBlockCount(), parallelBatchBlocks_);
+    QStringList texts;
+    texts.reserve(count);
+    auto block = first;
+    for (int i = 0; i < count && block.isValid(); i++, block = block.next()) {
+        texts.append(block.text());
+    }
+    QList<QStringView> lines(texts.cbegin(), texts.cend());
+
+    auto pool = QThreadPool::globalInstance();
+    auto chunkLines = std::max(256, static_cast<int>(lines.size()) /
+                                        std::max(1, 4 * pool->maxThreadCount()));
+    parallelStart_ = language->getContextStack(first);
+    parallelFirstBlock_ = first.blockNumber();
+    parallelRevision_ = document()->revision();
+    parallelLines_ = language->highlightLines(lines, chunkLines, nullptr, pool, parallelStart_);
+
+    // leave about half of the slice to apply the lines
+    auto elapsed = batchTimer.elapsed();
+    if (timeSliceBudget_ <= 0) {
+        return;
+    }
+    if (elapsed < timeSliceBudget_ / 4) {
+        parallelBatchBlocks_ = std::min(2 * parallelBatchBlocks_, MAX_PARALLEL_BATCH_BLOCKS);
+    } else if (elapsed > timeSliceBudget_ / 2) {
+        parallelBatchBlocks_ = std::max(parallelBatchBlocks_ / 2, MIN_PARALLEL_BATCH_BLOCKS);
+    }
+}
+
+void SyntaxHighlighter::clearParallelBatch() {
+    parallelLines_.clear();
+    parallelFirstBlock_ = -1;
+    parallelRevision_ = -1;
+    parallelStart_ = ContextStack();
+}
+
+// The line of the batch, if the block starts in the context the batch assumed
+const HighlightedLine *SyntaxHighlighter::precomputedLine(const QTextBlock &block) const {
+    auto index = block.blockNumber() - parallelFirstBlock_;
+    if (parallelFirstBlock_ < 0 || document()->revision() != parallelRevision_ || index < 0 ||
+        index >= parallelLines_.size()) {
+        return nullptr;
+    }
+
+    auto start = index == 0 ? parallelStart_ : parallelLines_[index - 1].endContextStack;
+    if (language->getContextStack(block) != start) {
+        return nullptr;
+    }
+    return &parallelLines_[index];
 }
 
 } // namespace Qutepart
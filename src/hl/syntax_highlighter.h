@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <QElapsedTimer>
 #include <QSyntaxHighlighter>
+#include <QTextCursor>
 #include <QTextDocument>
+#include <QTimer>
 
 #include "language.h"
 #include "text_block_user_data.h"
@@ -16,22 +19,131 @@ namespace Qutepart {
 
 class Theme;
 
+/* Highlighter with a background scheduler.
+ *
+ * Every highlighting run (an edit, rehighlight()) highlights blocks only until the time slice
+ * budget is spent. Blocks left over keep the formats they had (a block which was never
+ * highlighted renders plain), and are highlighted later from the event loop, one time slice at
+ * a time. Visible blocks are highlighted first, even if the budget is spent.
+ *
+ * The pending blocks are tracked as a range of the document, which follows edits.
+ *
+ * A theme change doesn't highlight. Blocks keep the style ids of their last highlighting, the
+ * formats are looked up again in the style table of the new theme, visible blocks first, the
+ * rest in the background slices.
+ *
+ * If many blocks are pending, i.e. a huge file was opened, a background slice highlights a batch
+ * of them on several threads with Language::highlightLines(), then applies the results block by
+ * block within the budget, the next slices apply the rest. The batch grows or shrinks so that
+ * highlighting it takes about half of the budget.
+ */
 class SyntaxHighlighter : public QSyntaxHighlighter {
     Q_OBJECT
 
   public:
+    static constexpr int DEFAULT_TIME_SLICE_BUDGET_MSEC = 20;
+    static constexpr int DEFAULT_PARALLEL_THRESHOLD_BLOCKS = 10000;
+
     SyntaxHighlighter(QObject *parent, QSharedPointer<Language> language);
     SyntaxHighlighter(QTextDocument *parent, QSharedPointer<Language> language);
 
     inline QSharedPointer<Language> getLanguage() const { return language; }
-    inline void setTheme(const Theme *t) {
-        language->setTheme(t);
-        rehighlight();
-    }
+    // The language is shared by all documents, the theme only selects the formats
+    void setTheme(const Theme *t);
+
+    /* Time one highlighting run or background slice may take.
+     * 0 or a negative value disables background highlighting, everything is done synchronously
+     */
+    void setTimeSliceBudget(int msec);
+    inline int timeSliceBudget() const { return timeSliceBudget_; }
+
+    /* Pending blocks, from which the background slices highlight on several threads.
+     * 0 or a negative value disables parallel highlighting
+     */
+    inline void setParallelThreshold(int blocks) { parallelThreshold_ = blocks; }
+    inline int parallelThreshold() const { return parallelThreshold_; }
+
+    /* Blocks shown in the viewport. Highlighting of pending visible blocks is scheduled at once,
+     * before the rest of the document.
+     */
+    void setVisibleBlocks(int firstBlockNumber, int lastBlockNumber);
+
+    bool isHighlightingPending() const;
+    int pendingBlockCount() const;
+    // Blocks not yet restyled after a theme change
+    inline bool isRestylePending() const { return !restyleNext_.isNull(); }
+
+  signals:
+    void highlightingProgress(int highlightedBlocks, int totalBlocks);
+    void highlightingFinished();
 
   protected:
     void highlightBlock(const QString &text) override;
     QSharedPointer<Language> language;
+    QSharedPointer<const StyleTable> styles;
+
+  private slots:
+    void onBackgroundSlice();
+
+  private:
+    void init();
+    bool hasTimeLeft() const;
+    void startRunIfNeeded(int blockNumber);
+    bool isVisible(int blockNumber) const;
+    void keepPreviousFormats(const QTextBlock &block);
+    void markPending(const QTextBlock &block);
+    void markHighlighted(const QTextBlock &block);
+    int firstPendingBlock() const;
+    int lastPendingBlock() const;
+    void highlightVisibleBlocks();
+    bool needsRestyle(const QTextBlock &block) const;
+    void restyleBlock(const QTextBlock &block);
+    void restyleVisibleBlocks();
+    void restyleNextBlocks();
+    bool highlightPendingInParallel();
+    bool hasParallelBatch() const;
+    void highlightParallelBatch();
+    void clearParallelBatch();
+    const HighlightedLine *precomputedLine(const QTextBlock &block) const;
+
+    int timeSliceBudget_ = DEFAULT_TIME_SLICE_BUDGET_MSEC;
+    QElapsedTimer runTimer_;
+    int lastBlockNumber_ = -1;
+    int lastRevision_ = -1;
+    bool inBackgroundSlice_ = false;
+
+    int firstVisibleBlock_ = 0;
+    int lastVisibleBlock_ = -1;
+    bool visibleBlocksChanged_ = false;
+
+    // Pending range. Both ends are inclusive, null cursors if nothing is pending
+    QTextCursor pendingFirst_;
+    QTextCursor pendingLast_;
+    QTimer backgroundTimer_;
+
+    /* Generations of the style tables, unique among all highlighters. A block was styled by this
+     * highlighter with an older table, if its generation is in [firstStyleGeneration_,
+     * styleGeneration_)
+     */
+    int firstStyleGeneration_ = 0;
+    int styleGeneration_ = 0;
+    bool restyling_ = false;
+    QTextCursor restyleNext_; // next block to restyle in the background, null if none
+
+    QVector<QTextLayout::FormatRange> formats_; // reused for every block
+
+    static constexpr int MIN_PARALLEL_BATCH_BLOCKS = 1024;
+    static constexpr int MAX_PARALLEL_BATCH_BLOCKS = 1 << 18;
+    int parallelThreshold_ = DEFAULT_PARALLEL_THRESHOLD_BLOCKS;
+    int parallelBatchBlocks_ = MIN_PARALLEL_BATCH_BLOCKS;
+
+    /* Lines of the batch being applied, highlighted in parallel starting from parallelStart_.
+     * Valid while the document is at parallelRevision_
+     */
+    QVector<HighlightedLine> parallelLines_;
+    int parallelFirstBlock_ = -1;
+    int parallelRevision_ = -1;
+    ContextStack parallelStart_;
 };
 
 } // namespace Qutepart
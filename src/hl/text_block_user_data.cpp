@@ -8,7 +8,6 @@
 
 namespace Qutepart {
 
-TextBlockUserData::TextBlockUserData(const QString &textTypeMap, const ContextStack &contexts)
-    : textTypeMap(textTypeMap), contexts(contexts) {}
+TextBlockUserData::TextBlockUserData(const ContextStack &contexts) : contexts(contexts) {}
 
 } // namespace Qutepart
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include "text_spans.h"
+
+namespace Qutepart {
+
+void TextSpans::reset(int length) {
+    spans_.clear();
+    length_ = length;
+}
+
+void TextSpans::append(int start, QChar textType, Language *language) {
+    if (!spans_.isEmpty() && spans_.last().textType == textType &&
+        spans_.last().language == language) {
+        return;
+    }
+    spans_.append({start, textType, language});
+}
+
+const TextSpans::Span *TextSpans::find(int column) const {
+    if (column < 0 || column >= length_ || spans_.isEmpty()) {
+        return nullptr;
+    }
+
+    // the last span starting at or before the column
+    auto it = std::upper_bound(spans_.cbegin(), spans_.cend(), column,
+                               [](int column, const Span &span) { return column < span.start; });
+    if (it == spans_.cbegin()) {
+        return nullptr;
+    }
+    return &*(it - 1);
+}
+
+QChar TextSpans::textTypeAt(int column) const {
+    auto span = find(column);
+    return span ? span->textType : QChar(' ');
+}
+
+Language *TextSpans::languageAt(int column) const {
+    auto span = find(column);
+    return span ? span->language : nullptr;
+}
+
+QString TextSpans::textTypeMap() const {
+    QString result(length_, ' ');
+    for (int i = 0; i < spans_.size(); i++) {
+        auto end = i + 1 < spans_.size() ? spans_[i + 1].start : length_;
+        for (auto column = spans_[i].start; column < end; column++) {
+            result[column] = spans_[i].textType;
+        }
+    }
+    return result;
+}
+
+} // namespace Qutepart
@@ -27,36 +27,127 @@ bool DeliminatorSet::contains(QChar ch) const {
     return nonAsciiChars_.contains(ch);
 }
 
-TextToMatch::TextToMatch(const QString &text, const QStringList &contextData)
-    : currentColumnIndex(0), wholeLineText(text), text(wholeLineText.left(wholeLineText.length())),
-      textLength(text.length()), firstNonSpace(true), // copy-paste from Py code
-      isWordStart(true),                              // copy-paste from Py code
-      contextData(&contextData) {}
-
 namespace {
-bool isWordChar(QChar ch) { return ch.isLetterOrNumber() || ch == '_'; }
+
+constexpr std::array<quint8, 128> makeAsciiClasses() {
+    std::array<quint8, 128> result{};
+    for (int code = 0; code < 128; code++) {
+        quint8 flags = 0;
+        if (code == ' ' || (code >= '\t' && code <= '\r')) {
+            flags |= LineCharClasses::Space;
+        }
+        if (code >= '0' && code <= '9') {
+            flags |= LineCharClasses::Digit | LineCharClasses::Word;
+        }
+        if ((code >= 'a' && code <= 'z') || (code >= 'A' && code <= 'Z')) {
+            flags |= LineCharClasses::Letter | LineCharClasses::Word;
+        }
+        if (code == '_') {
+            flags |= LineCharClasses::Word;
+        }
+        result[code] = flags;
+    }
+    return result;
+}
+
+constexpr std::array<quint8, 128> ASCII_CLASSES = makeAsciiClasses();
+
+quint8 classifyChar(QChar ch) {
+    auto code = ch.unicode();
+    if (code < ASCII_CLASSES.size()) {
+        return ASCII_CLASSES[code];
+    }
+
+    quint8 flags = 0;
+    if (ch.isSpace()) {
+        flags |= LineCharClasses::Space;
+    }
+    if (ch.isDigit()) {
+        flags |= LineCharClasses::Digit;
+    }
+    if (ch.isLetter()) {
+        flags |= LineCharClasses::Letter;
+    }
+    if (ch.isLetterOrNumber()) {
+        flags |= LineCharClasses::Word;
+    }
+    return flags;
+}
+
 } // namespace
 
-void TextToMatch::shiftOnce() {
-    QChar prevChar = text.at(0);
-    firstNonSpace = firstNonSpace && prevChar.isSpace();
-    isWordStart = (!isWordStart) && textLength > 1 && isWordChar(text.at(1));
+void LineCharClasses::classify(QStringView line) {
+    auto length = line.length();
+    flags.resize(length);
+    firstNonSpace = length;
+    for (auto &memo : wordMemo) {
+        memo = WordMemo();
+    }
+
+    for (qsizetype i = 0; i < length; i++) {
+        flags[i] = classifyChar(line.at(i));
+        if (firstNonSpace == length && (flags[i] & Space) == 0) {
+            firstNonSpace = i;
+        }
+    }
 
-    currentColumnIndex++;
-    text = text.right(text.length() - 1);
-    textLength--;
+    /* Kept as TextToMatch::shift() used to compute it: a column is a word start if the previous
+     * one is not, and its character is a word character
+     */
+    bool wordStart = true;
+    for (qsizetype i = 0; i < length; i++) {
+        if (wordStart) {
+            flags[i] |= WordStart;
+        }
+        wordStart = !wordStart && i + 1 < length && (flags[i + 1] & Word) != 0;
+    }
 }
 
-void TextToMatch::shift(int count) {
-    for (int i = 0; i < count; i++) {
-        QChar prevChar = text.at(i);
-        firstNonSpace = firstNonSpace && prevChar.isSpace();
-        isWordStart = (!isWordStart) && textLength > (i + 1) && isWordChar(text.at(i + 1));
+int LineCharClasses::count(int column, Flag flag) const {
+    int index = column;
+    while (index < flags.size() && (flags[index] & flag) != 0) {
+        index++;
+    }
+    return index - column;
+}
+
+int LineCharClasses::wordLength(QStringView line, int column,
+                                const DeliminatorSet &deliminators) const {
+    for (const auto &memo : wordMemo) {
+        if (memo.column == column &&
+            (memo.deliminators == &deliminators || *memo.deliminators == deliminators)) {
+            return memo.length;
+        }
+    }
+
+    int index = column;
+    while (index < line.length() && !deliminators.contains(line.at(index))) {
+        index++;
     }
 
+    wordMemo[nextWordMemo] = {column, &deliminators, index - column};
+    nextWordMemo = (nextWordMemo + 1) % wordMemo.size();
+    return index - column;
+}
+
+TextToMatch::TextToMatch(QStringView text, const QStringList &contextData,
+                         LineCharClasses &charClasses)
+    : currentColumnIndex(0), wholeLineText(text), text(text), textLength(text.length()),
+      firstNonSpace(true), // copy-paste from Py code
+      isWordStart(true),   // copy-paste from Py code
+      contextData(&contextData), charClasses(&charClasses) {
+    charClasses.classify(text);
+}
+
+void TextToMatch::shiftOnce() { shift(1); }
+
+void TextToMatch::shift(int count) {
     currentColumnIndex += count;
-    text = text.right(text.length() - count);
+    text = text.mid(count);
     textLength -= count;
+
+    firstNonSpace = currentColumnIndex <= charClasses->firstNonSpaceColumn();
+    isWordStart = charClasses->test(currentColumnIndex, LineCharClasses::WordStart);
 }
 
 bool TextToMatch::isEmpty() const { return text.isEmpty(); }
@@ -69,14 +160,9 @@ QStringView TextToMatch::word(const DeliminatorSet &deliminators) const {
         }
     }
 
-    int wordEndIndex = 0;
-    for (; wordEndIndex < text.length(); wordEndIndex++) {
-        if (deliminators.contains(text.at(wordEndIndex))) {
-            break;
-        }
-    }
-    if (wordEndIndex != 0) {
-        return text.left(wordEndIndex);
+    int wordLength = charClasses->wordLength(wholeLineText, currentColumnIndex, deliminators);
+    if (wordLength != 0) {
+        return text.left(wordLength);
     }
 
     return QStringView();
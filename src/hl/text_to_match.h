@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <array>
 #include <bitset>
 
 #include <QString>
+#include <QVector>
 
 namespace Qutepart {
 
@@ -24,17 +26,63 @@ class DeliminatorSet {
 
     bool contains(QChar ch) const;
 
+    bool operator==(const DeliminatorSet &other) const {
+        return asciiChars_ == other.asciiChars_ && nonAsciiChars_ == other.nonAsciiChars_;
+    }
+
   private:
     std::bitset<128> asciiChars_;
     QString nonAsciiChars_; // deliminators outside ASCII range; expected to be empty in practice
 };
 
+/* Classes of all characters of a line, computed once when the line highlighting starts.
+ * Shared by all TextToMatch objects of the line, and reused for the next line to avoid
+ * allocating memory.
+ */
+class LineCharClasses {
+  public:
+    enum Flag : quint8 {
+        Space = 0x01,  // QChar::isSpace()
+        Word = 0x02,   // letter, number or '_'
+        Digit = 0x04,  // QChar::isDigit()
+        Letter = 0x08, // QChar::isLetter()
+        WordStart = 0x10,
+    };
+
+    void classify(QStringView line);
+
+    inline bool test(int column, Flag flag) const {
+        return column < flags.size() && (flags[column] & flag) != 0;
+    }
+
+    // Count of characters with the flag starting at the column
+    int count(int column, Flag flag) const;
+
+    inline int firstNonSpaceColumn() const { return firstNonSpace; }
+
+    // Length of the word at the column. Memoised, rules of a context usually share deliminators
+    int wordLength(QStringView line, int column, const DeliminatorSet &deliminators) const;
+
+  private:
+    struct WordMemo {
+        int column = -1;
+        const DeliminatorSet *deliminators = nullptr;
+        int length = 0;
+    };
+
+    QVector<quint8> flags;
+    int firstNonSpace = 0;
+    mutable std::array<WordMemo, 4> wordMemo;
+    mutable int nextWordMemo = 0;
+};
+
 /* Peace of text, which shall be matched.
  * Contains pre-calculated and pre-checked data for performance optimization
  */
 class TextToMatch {
   public:
-    TextToMatch(const QString &text, const QStringList &contextData);
+    // The text is not copied, it must outlive the object. `charClasses` is filled for the text
+    TextToMatch(QStringView text, const QStringList &contextData, LineCharClasses &charClasses);
 
     void shiftOnce();
     void shift(int count);
@@ -43,13 +91,28 @@ class TextToMatch {
 
     QStringView word(const DeliminatorSet &deliminators) const;
 
+    // Count of characters of a class at the start of the text, or `offset` characters later
+    inline int countSpaces() const { return count(LineCharClasses::Space, 0); }
+    inline int countWordChars(int offset = 0) const { return count(LineCharClasses::Word, offset); }
+    inline int countDigits(int offset = 0) const { return count(LineCharClasses::Digit, offset); }
+    inline bool isLetter(int offset = 0) const {
+        return charClasses->test(currentColumnIndex + offset, LineCharClasses::Letter);
+    }
+
     int currentColumnIndex;
-    QString wholeLineText;
+    QStringView wholeLineText;
     QStringView text;
     int textLength;
     bool firstNonSpace;
     bool isWordStart;
     const QStringList *contextData;
+
+  private:
+    inline int count(LineCharClasses::Flag flag, int offset) const {
+        return charClasses->count(currentColumnIndex + offset, flag);
+    }
+
+    const LineCharClasses *charClasses;
 };
 
 } // namespace Qutepart
@@ -21,11 +21,8 @@ QChar getTextType(const QTextBlock &block, int column) {
     if (data == nullptr) {
         return ' ';
     } else {
-        // this may happen on empty files
-        if (column < 0 || data->textTypeMap.size() <= column) {
-            return ' ';
-        }
-        return data->textTypeMap[column];
+        // ' ' for columns out of the map, this may happen on empty files
+        return data->textSpans.textTypeAt(column);
     }
 }
 
@@ -37,7 +34,10 @@ QString textTypeMap(const QTextBlock &block) {
         return QString().fill(' ', block.text().length());
     }
 
-    return data->textTypeMap;
+    // the spans are shorter if the block has not been highlighted yet
+    auto result = data->textSpans.textTypeMap();
+    result.resize(block.text().length(), ' ');
+    return result;
 }
 
 bool isCode(const QTextBlock &block, int column) { return getTextType(block, column) == ' '; }
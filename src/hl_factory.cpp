@@ -4,7 +4,17 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <atomic>
+
+#include <QCoreApplication>
+#include <QPromise>
+#include <QThread>
+#include <QThreadPool>
+#include <QTimer>
+
+#include "hl/line_cache.h"
 #include "hl/loader.h"
+#include "hl/profiler.h"
 #include "hl/syntax_highlighter.h"
 #include "qutepart.h"
 
@@ -32,4 +42,77 @@ QSyntaxHighlighter *makeHighlighter(QTextDocument *parent, const QString &langua
     return nullptr;
 }
 
+void setHighlightingProfilerEnabled(bool enabled) { setProfilingEnabled(enabled); }
+
+void setHighlightingLineCache(int lines) { setLineCacheCapacity(lines); }
+
+namespace {
+
+/* One task per language. The task also loads the languages the language includes, which a
+ * highlighter otherwise loads when it reaches them. Every language is loaded once, the loader
+ * makes the other tasks wait for it.
+ */
+void startPreload(QStringList languageIds, QThreadPool *pool,
+                  QSharedPointer<QPromise<QString>> promise) {
+    languageIds.removeDuplicates();
+    languageIds.removeAll(QString());
+
+    promise->start();
+    promise->setProgressRange(0, languageIds.size());
+    if (languageIds.isEmpty()) {
+        promise->finish();
+        return;
+    }
+
+    auto remaining = QSharedPointer<std::atomic<int>>::create(languageIds.size());
+    for (const auto &languageId : std::as_const(languageIds)) {
+        pool->start([languageId, promise, remaining, total = languageIds.size()]() {
+            if (!promise->isCanceled()) {
+                auto language = loadLanguage(languageId);
+                if (!language.isNull()) {
+                    language->resolveExternalContexts();
+                    promise->addResult(languageId);
+                }
+            }
+            auto left = --*remaining;
+            promise->setProgressValue(total - left);
+            if (left == 0) {
+                promise->finish();
+            }
+        });
+    }
+}
+
+// Low priority, so preloading does not slow down the application
+QThreadPool *idleThreadPool() {
+    static QThreadPool pool;
+    static QThreadPool *configured = []() {
+        pool.setThreadPriority(QThread::LowestPriority);
+        pool.setMaxThreadCount(qMax(1, QThread::idealThreadCount() / 2));
+        return &pool;
+    }();
+    return configured;
+}
+
+} // namespace
+
+QFuture<QString> preloadLanguages(const QStringList &languageIds, QThreadPool *pool) {
+    auto promise = QSharedPointer<QPromise<QString>>::create();
+    auto future = promise->future();
+    startPreload(languageIds, pool ? pool : QThreadPool::globalInstance(), promise);
+    return future;
+}
+
+QFuture<QString> preloadLanguagesWhenIdle(const QStringList &languageIdsByUsage, int count) {
+    auto promise = QSharedPointer<QPromise<QString>>::create();
+    auto future = promise->future();
+    auto languageIds = languageIdsByUsage.mid(0, qMax(0, count));
+
+    // A zero timer fires after the events queued so far
+    QTimer::singleShot(0, QCoreApplication::instance(), [languageIds, promise]() {
+        startPreload(languageIds, idleThreadPool(), promise);
+    });
+    return future;
+}
+
 } // namespace Qutepart
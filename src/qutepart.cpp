@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <algorithm>
+
 #include <QAction>
 #include <QApplication>
 #include <QStyleHints>
@@ -11,10 +13,13 @@
 #include <QDebug>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <QJsonArray>
+#include <QJsonDocument>
 #include <QKeyEvent>
 #include <QPainter>
 #include <QScrollBar>
 #include <QStyle>
+#include <QTextStream>
 
 #include "bracket_highlighter.h"
 #include "completer.h"
@@ -23,6 +28,7 @@
 #include "text_block_flags.h"
 #include "text_block_utils.h"
 
+#include "hl/memory_usage.h"
 #include "hl/syntax_highlighter.h"
 #include "hl/text_type.h"
 #include "hl_factory.h"
@@ -40,6 +46,7 @@ Qutepart::Qutepart(QWidget *parent, const QString &text)
       brakcetsQutoEnclose(true), completionEnabled_(true), completionThreshold_(3),
       viewportMarginStart_(0) {
     extraCursorBlinkTimer_ = new QTimer(this);
+    highlightingTimeSlice_ = SyntaxHighlighter::DEFAULT_TIME_SLICE_BUDGET_MSEC;
     setBracketHighlightingEnabled(true);
     setLineNumbersVisible(true);
     setMinimapVisible(true);
@@ -77,6 +84,12 @@ Qutepart::Qutepart(QWidget *parent, const QString &text)
         }
     });
 
+    connect(this, &Qutepart::updateRequest, this, [this](const QRect &rect, int dy) {
+        if (dy != 0 || rect.contains(viewport()->rect())) {
+            updateHighlighterVisibleBlocks();
+        }
+    });
+
     setTheme(nullptr);
     QTimer::singleShot(0, this, [this]() { updateViewport(); });
 
@@ -141,6 +154,12 @@ void Qutepart::setHighlighter(const QString &languageId) {
     if (hl) {
         auto lang = hl->getLanguage();
         completer_->setKeywords(lang->allLanguageKeywords());
+        hl->setTimeSliceBudget(highlightingTimeSlice_);
+        connect(hl, &SyntaxHighlighter::highlightingProgress, this,
+                &Qutepart::highlightingProgress);
+        connect(hl, &SyntaxHighlighter::highlightingFinished, this,
+                &Qutepart::highlightingFinished);
+        updateHighlighterVisibleBlocks();
         hl->setTheme(theme);
     } else {
         completer_->setKeywords({});
@@ -153,6 +172,135 @@ void Qutepart::removeHighlighter() {
     completer_->setKeywords({});
 }
 
+void Qutepart::setHighlightingTimeSlice(int msec) {
+    highlightingTimeSlice_ = msec;
+    auto hl = dynamic_cast<SyntaxHighlighter *>(highlighter_);
+    if (hl) {
+        hl->setTimeSliceBudget(msec);
+    }
+}
+
+int Qutepart::highlightingTimeSlice() const { return highlightingTimeSlice_; }
+
+bool Qutepart::isHighlightingPending() const {
+    auto hl = dynamic_cast<SyntaxHighlighter *>(highlighter_);
+    return hl && hl->isHighlightingPending();
+}
+
+QSet<Language *> Qutepart::highlightedLanguages() const {
+    QSet<Language *> languages;
+    auto hl = dynamic_cast<SyntaxHighlighter *>(highlighter_);
+    if (hl) {
+        languages.insert(hl->getLanguage().data());
+    }
+
+    for (auto block = document()->begin(); block.isValid(); block = block.next()) {
+        auto data = static_cast<TextBlockUserData *>(block.userData());
+        if (data) {
+            for (const auto &span : data->textSpans.spans()) {
+                if (span.language) {
+                    languages.insert(span.language);
+                }
+            }
+        }
+    }
+    return languages;
+}
+
+QString Qutepart::highlightingProfile(bool json) const {
+    auto languages = highlightedLanguages().values();
+    std::sort(languages.begin(), languages.end(), [](const Language *a, const Language *b) {
+        return a->getName() < b->getName();
+    });
+
+    if (json) {
+        QJsonArray result;
+        for (auto language : std::as_const(languages)) {
+            result.append(language->profileJson());
+        }
+        return QString::fromUtf8(QJsonDocument(result).toJson());
+    }
+
+    QString result;
+    QTextStream out(&result);
+    for (auto language : std::as_const(languages)) {
+        language->printProfile(out);
+    }
+    return result;
+}
+
+void Qutepart::resetHighlightingProfile() {
+    for (auto language : highlightedLanguages()) {
+        language->resetProfile();
+    }
+}
+
+LineCacheStats Qutepart::lineCacheStats() const {
+    LineCacheStats result;
+    for (auto language : highlightedLanguages()) {
+        auto stats = language->lineCacheStats();
+        result.hits += stats.hits;
+        result.misses += stats.misses;
+    }
+    return result;
+}
+
+MemoryStats Qutepart::memoryStats() const {
+    MemoryStats stats;
+    QSet<const void *> regionStacks; // consecutive blocks share the stacks of the same regions
+
+    for (auto block = document()->begin(); block.isValid(); block = block.next()) {
+        auto layout = block.layout();
+        if (layout) {
+            stats.formatRanges += listMemoryUsage(layout->formats());
+        }
+
+        auto data = static_cast<TextBlockUserData *>(block.userData());
+        if (!data) {
+            continue;
+        }
+        stats.blockData += sizeof(TextBlockUserData) + stringMemoryUsage(data->metaData.message);
+        stats.textSpans += data->textSpans.memoryUsage();
+        stats.formatRanges += listMemoryUsage(data->styleRuns);
+
+        if (!data->regions.isEmpty() && !regionStacks.contains(data->regions.constData())) {
+            regionStacks.insert(data->regions.constData());
+            stats.regions += stringListMemoryUsage(data->regions);
+        }
+    }
+
+    stats.selections = listMemoryUsage(persitentSelections) + listMemoryUsage(extraSelections());
+    stats.completer = completer_->memoryUsage();
+
+    for (auto language : highlightedLanguages()) {
+        stats.grammars[language->getName()] = language->grammarMemoryUsage();
+        stats.contextStacks += language->contextStacksMemoryUsage();
+        stats.lineCaches += language->lineCacheMemoryUsage();
+    }
+
+    return stats;
+}
+
+void Qutepart::updateHighlighterVisibleBlocks() {
+    auto hl = dynamic_cast<SyntaxHighlighter *>(highlighter_);
+    if (!hl) {
+        return;
+    }
+
+    auto block = firstVisibleBlock();
+    auto firstBlockNumber = block.blockNumber();
+    auto lastBlockNumber = firstBlockNumber;
+    auto bottom = viewport()->rect().bottom();
+    for (; block.isValid(); block = block.next()) {
+        if (blockBoundingGeometry(block).translated(contentOffset()).top() > bottom) {
+            break;
+        }
+        lastBlockNumber = block.blockNumber();
+    }
+
+    hl->setVisibleBlocks(firstBlockNumber, lastBlockNumber);
+}
+
 void Qutepart::setIndentAlgorithm(IndentAlg indentAlg) { indenter_->setAlgorithm(indentAlg); }
 
 void Qutepart::setDefaultColors() {
@@ -173,7 +321,6 @@ void Qutepart::setTheme(const Theme *newTheme) {
     theme = newTheme;
     if (hl) {
         hl->setTheme(theme);
-        hl->rehighlight();
     }
 
     fixLineFlagColors();
@@ -528,7 +675,7 @@ void Qutepart::setLineMessage(int lineNumber, const QString &message) {
     auto block = document()->findBlockByNumber(lineNumber);
     auto blockData = static_cast<TextBlockUserData *>(block.userData());
     if (!blockData) {
-        blockData = new TextBlockUserData({}, {nullptr});
+        blockData = new TextBlockUserData(ContextStack());
         block.setUserData(blockData);
     }
     blockData->metaData.message = message;
@@ -2322,11 +2469,8 @@ void Qutepart::toggleComment() {
                 return;
             }
 
-            Language *language = nullptr;
             int relativePos = selectionStart - cursor.block().position();
-            if (relativePos >= 0 && relativePos < blockData->languageMap.size()) {
-                language = blockData->languageMap[relativePos];
-            }
+            Language *language = blockData->textSpans.languageAt(relativePos);
 
             if (language == nullptr) {
                 if (blockData->contexts.currentContext() &&
@@ -6,11 +6,15 @@
 
 #pragma once
 
+#include <memory>
+
 #include <QIcon>
 #include <QStack>
 #include <QTextBlockUserData>
 
 #include "context_stack.h"
+#include "highlighted_line.h"
+#include "text_spans.h"
 
 namespace Qutepart {
 
@@ -18,11 +22,16 @@ class Language;
 
 class TextBlockUserData : public QTextBlockUserData {
   public:
-    TextBlockUserData(const QString &textTypeMap, const ContextStack &contexts);
-    QString textTypeMap;
-    QVector<Language *> languageMap;
+    TextBlockUserData(const ContextStack &contexts);
+    TextSpans textSpans; // text types and languages
     ContextStack contexts;
     int state = 0;
+    // Keeps the block state of the highlighting remembered, see Language::blockState()
+    std::shared_ptr<const int> highlightState;
+
+    // Formats of the last highlighting, to switch the theme without highlighting again
+    QVector<HighlightedLine::FormatRun> styleRuns;
+    int styleGeneration = 0; // see SyntaxHighlighter::setTheme()
 
     struct {
         int level = 0;
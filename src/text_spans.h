@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <QString>
+#include <QVector>
+
+namespace Qutepart {
+
+class Language;
+
+/* Text types and languages of a highlighted block, stored as runs.
+ * A run starts where the text type or the language changes, so memory is proportional to the
+ * count of tokens, not to the count of characters.
+ */
+class TextSpans {
+  public:
+    struct Span {
+        int start;      // ends where the next span starts
+        QChar textType; // see detectTextType()
+        Language *language;
+    };
+
+    // Start filling the spans of a block of `length` characters. Keeps the allocated memory
+    void reset(int length);
+    // Spans shall be appended in order. A span equal to the last one extends it
+    void append(int start, QChar textType, Language *language);
+
+    // ' ' (code) if the column is out of the block
+    QChar textTypeAt(int column) const;
+    // nullptr if the column is out of the block
+    Language *languageAt(int column) const;
+
+    // One text type per character
+    QString textTypeMap() const;
+
+    inline int length() const { return length_; }
+    inline const QVector<Span> &spans() const { return spans_; }
+
+    // Heap memory held by the spans, in bytes
+    inline size_t memoryUsage() const { return spans_.capacity() * sizeof(Span); }
+
+  private:
+    const Span *find(int column) const;
+
+    QVector<Span> spans_;
+    int length_ = 0;
+};
+
+} // namespace Qutepart
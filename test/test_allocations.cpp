@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <atomic>
+#include <cstdlib>
+
+#include <QObject>
+#include <QTest>
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QTextLayout>
+
+#include "hl/language.h"
+#include "hl/loader.h"
+#include "hl/style.h"
+
+namespace {
+
+std::atomic<long> allocationCount{0};
+
+// C code matched by the rules of the language and by NativeRegExp only
+const QStringList LINES = {
+    "int main(int argc, char **argv) {",
+    "    int value = argc + 42;",
+    "    const char *s = \"text\\n\";",
+    "    long mask = 0x1F + 017 + 42UL;",
+    "    double ratio = 1.5e3 * .25f;",
+    "    if (value > 0x10) {",
+    "        return value * 2;",
+    "    }",
+    "    return 0;",
+    "}",
+};
+
+/* Comments and preprocessor lines try patterns only QRegularExpression matches: the Doxygen
+ * `//(!|(/(?=[^/]|$)))<?` for a comment, up to four preprocessor ones for a directive. Every
+ * attempt allocates the QRegularExpressionMatch, its offsets and the PCRE2 match data, so these
+ * lines average about 5 allocations
+ */
+const QStringList REGEXP_LINES = {
+    "#include <stdio.h>",
+    "// a comment",
+    "    value++; // a trailing comment",
+    "#define MAX 10",
+};
+const double REGEXP_LINE_ALLOCATIONS = 8;
+
+// Allocations of the editor per block: the text of the block, and a copy of the folding regions
+// on the lines which change them
+const double BLOCK_ALLOCATIONS = 4;
+
+// Average allocations of `pass`, which highlights `lines` lines, after a pass to warm up
+template <typename Pass> double allocationsPerLine(Pass pass, int lines) {
+    // intern the context stacks and grow the line buffers
+    pass();
+
+    const int passes = 10;
+    auto before = allocationCount.load();
+    for (int i = 0; i < passes; i++) {
+        pass();
+    }
+    return double(allocationCount.load() - before) / (passes * lines);
+}
+
+} // namespace
+
+#if defined(__GLIBC__)
+// Count all heap allocations, including the ones of Qt containers, which do not use operator new
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size) noexcept {
+    allocationCount++;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) noexcept {
+    allocationCount++;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) noexcept {
+    allocationCount++;
+    return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void initTestCase() { Q_INIT_RESOURCE(qutepart_syntax_files); }
+
+    void SteadyStateHighlightLine_data() {
+        QTest::addColumn<QStringList>("lines");
+        QTest::addColumn<double>("maxPerLine");
+
+        QTest::newRow("code") << LINES << 0.1;
+        QTest::newRow("comments and preprocessor") << REGEXP_LINES << REGEXP_LINE_ALLOCATIONS;
+    }
+
+    void SteadyStateHighlightLine() {
+#if !defined(__GLIBC__)
+        QSKIP("Allocations are counted with glibc only");
+#endif
+        QFETCH(QStringList, lines);
+        QFETCH(double, maxPerLine);
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        Qutepart::HighlightedLine line(0, language->getDefaultContextStack());
+        auto perLine = allocationsPerLine(
+            [&language, &line, &lines]() {
+                auto contextStack = language->getDefaultContextStack();
+                for (const auto &text : std::as_const(lines)) {
+                    language->highlightLine(text, contextStack, line);
+                    contextStack = line.endContextStack;
+                }
+            },
+            lines.size());
+
+        QVERIFY2(perLine < maxPerLine, qPrintable(QString("%1 allocations per line").arg(perLine)));
+    }
+
+    // The editor path: the spans, style runs and state of the blocks are updated in place
+    void SteadyStateHighlightBlock() {
+#if !defined(__GLIBC__)
+        QSKIP("Allocations are counted with glibc only");
+#endif
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+        auto styles = Qutepart::StyleTable::get(nullptr);
+
+        QTextDocument doc(LINES.join('\n'));
+        QVector<QTextLayout::FormatRange> formats;
+        auto perBlock = allocationsPerLine(
+            [&language, &styles, &doc, &formats]() {
+                for (auto block = doc.firstBlock(); block.isValid(); block = block.next()) {
+                    formats.clear();
+                    language->highlightBlock(block, *styles, formats);
+                }
+            },
+            doc.blockCount());
+
+        QVERIFY2(perBlock < BLOCK_ALLOCATIONS,
+                 qPrintable(QString("%1 allocations per block").arg(perBlock)));
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_allocations.moc"
@@ -9,6 +9,8 @@
 #include <QStyle>
 #include <QTest>
 
+#include "hl/language.h"
+#include "hl/loader.h"
 #include "qutepart/qutepart.h"
 #include "qutepart/theme.h"
 #include "text_block_user_data.h"
@@ -128,6 +130,53 @@ class Test : public QObject {
         QCOMPARE(foldedLines.size(), 1);
         QCOMPARE(foldedLines[0], 1);
     }
+
+    void MemoryStats() {
+        Q_INIT_RESOURCE(qutepart_syntax_files);
+
+        Qutepart::Qutepart qutepart;
+        qutepart.setPlainText("int a;");
+        QVERIFY(qutepart.memoryStats().grammars.isEmpty());
+
+        qutepart.setHighlightingTimeSlice(0);
+        qutepart.setHighlighter("cpp.xml");
+        auto small = qutepart.memoryStats();
+        QVERIFY(small.grammars.value("C++") > 0);
+        QVERIFY(small.textSpans > 0);
+        QVERIFY(small.total() > small.documentTotal());
+
+        QString text;
+        for (int i = 0; i < 1000; i++) {
+            text += "int a = 1; // comment\n";
+        }
+        qutepart.setPlainText(text);
+        auto large = qutepart.memoryStats();
+        QVERIFY(large.blockData > small.blockData);
+        QVERIFY(large.textSpans > small.textSpans);
+        QVERIFY(large.grammars.value("C++") < 2 * small.grammars.value("C++"));
+    }
+
+    void PreloadLanguages() {
+        Q_INIT_RESOURCE(qutepart_syntax_files);
+
+        auto future = Qutepart::preloadLanguages({"php.xml", "html.xml", "cpp.xml", "cpp.xml",
+                                                  "no-such-language.xml"});
+        future.waitForFinished();
+        auto loaded = future.results();
+        loaded.sort();
+        QCOMPARE(loaded, QStringList({"cpp.xml", "html.xml", "php.xml"}));
+
+        // included languages are loaded too, not by the first highlighting
+        auto included = Qutepart::loadLanguage("html.xml")->loadedExternalLanguages();
+        QVERIFY(included.contains("css.xml"));
+        QVERIFY(included.contains("javascript.xml"));
+
+        auto idle = Qutepart::preloadLanguagesWhenIdle({"python.xml", "ruby.xml", "perl.xml"}, 2);
+        QTRY_VERIFY(idle.isFinished());
+        loaded = idle.results();
+        loaded.sort();
+        QCOMPARE(loaded, QStringList({"python.xml", "ruby.xml"}));
+    }
 };
 
 QTEST_MAIN(Test)
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTextLayout>
+
+#include "hl/loader.h"
+#include "hl/syntax_highlighter.h"
+#include "theme.h"
+
+namespace {
+
+QString makeText(int lines) {
+    QStringList result;
+    for (int i = 0; i < lines; i++) {
+        switch (i % 4) {
+        case 0:
+            result << "int value = 42; // comment";
+            break;
+        case 1:
+            result << "/* multi line";
+            break;
+        case 2:
+            result << "   comment */ const char *s = \"string\";";
+            break;
+        default:
+            result << "void function(int a) { return; }";
+            break;
+        }
+    }
+    return result.join('\n');
+}
+
+QVector<int> referenceStates(const QString &text) {
+    QTextDocument doc(text);
+    Qutepart::SyntaxHighlighter hl(&doc, Qutepart::loadLanguage("cpp.xml"));
+    hl.setTimeSliceBudget(0);
+    hl.rehighlight();
+
+    QVector<int> states;
+    for (auto block = doc.firstBlock(); block.isValid(); block = block.next()) {
+        states.append(block.userState());
+    }
+    return states;
+}
+
+QVector<int> states(const QTextDocument &doc) {
+    QVector<int> result;
+    for (auto block = doc.firstBlock(); block.isValid(); block = block.next()) {
+        result.append(block.userState());
+    }
+    return result;
+}
+
+QList<QColor> foregrounds(const QTextDocument &doc) {
+    QList<QColor> result;
+    for (auto block = doc.firstBlock(); block.isValid(); block = block.next()) {
+        for (const auto &range : block.layout()->formats()) {
+            result.append(range.format.foreground().color());
+        }
+    }
+    return result;
+}
+
+quint64 totalAttempts(const QList<Qutepart::ProfileEntry> &entries) {
+    quint64 result = 0;
+    for (const auto &entry : entries) {
+        result += entry.counters.attempts;
+    }
+    return result;
+}
+
+} // namespace
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void initTestCase() {
+        Q_INIT_RESOURCE(qutepart_syntax_files);
+        Q_INIT_RESOURCE(qutepart_theme_data);
+    }
+
+    void cleanup() { Qutepart::setProfilingEnabled(false); }
+
+    void Synchronous() {
+        QTextDocument doc(makeText(2000));
+        Qutepart::SyntaxHighlighter hl(&doc, Qutepart::loadLanguage("cpp.xml"));
+        hl.setTimeSliceBudget(0);
+        hl.rehighlight();
+
+        QVERIFY(!hl.isHighlightingPending());
+        QCOMPARE(states(doc), referenceStates(doc.toPlainText()));
+    }
+
+    void BackgroundReachesEnd() {
+        QTextDocument doc(makeText(20000));
+        Qutepart::SyntaxHighlighter hl(&doc, Qutepart::loadLanguage("cpp.xml"));
+        hl.setTimeSliceBudget(1);
+        QSignalSpy progress(&hl, &Qutepart::SyntaxHighlighter::highlightingProgress);
+        QSignalSpy finished(&hl, &Qutepart::SyntaxHighlighter::highlightingFinished);
+        hl.rehighlight();
+
+        QVERIFY(finished.wait(30000));
+        QVERIFY(!hl.isHighlightingPending());
+        QVERIFY(!progress.isEmpty());
+        QCOMPARE(progress.last().at(0).toInt(), doc.blockCount());
+        QCOMPARE(states(doc), referenceStates(doc.toPlainText()));
+    }
+
+    void VisibleBlocksFirst() {
+        QTextDocument doc(makeText(20000));
+        Qutepart::SyntaxHighlighter hl(&doc, Qutepart::loadLanguage("cpp.xml"));
+        hl.setTimeSliceBudget(1);
+        hl.rehighlight();
+        hl.setVisibleBlocks(15000, 15040);
+
+        QTRY_VERIFY(doc.findBlockByNumber(15040).userState() != -1);
+        for (int i = 15000; i <= 15040; i++) {
+            QVERIFY(doc.findBlockByNumber(i).userState() != -1);
+        }
+    }
+
+    // Batches highlighted on several threads equal highlighting block by block
+    void ParallelBatches() {
+        QTextDocument reference(makeText(5000));
+        Qutepart::SyntaxHighlighter referenceHl(&reference, Qutepart::loadLanguage("cpp.xml"));
+        referenceHl.setTimeSliceBudget(0);
+        referenceHl.rehighlight();
+
+        QTextDocument doc(reference.toPlainText());
+        Qutepart::SyntaxHighlighter hl(&doc, Qutepart::loadLanguage("cpp.xml"));
+        hl.setTimeSliceBudget(1);
+        hl.setParallelThreshold(100);
+        QSignalSpy finished(&hl, &Qutepart::SyntaxHighlighter::highlightingFinished);
+        hl.rehighlight();
+        QVERIFY(finished.wait(30000));
+
+        QCOMPARE(states(doc), states(reference));
+        QCOMPARE(foregrounds(doc), foregrounds(reference));
+
+        // a comment opened in the middle of a batch
+        QTextCursor cursor(doc.findBlockByNumber(1000));
+        cursor.insertText("/* ");
+        QTextCursor referenceCursor(reference.findBlockByNumber(1000));
+        referenceCursor.insertText("/* ");
+        QTRY_VERIFY(!hl.isHighlightingPending());
+        QCOMPARE(states(doc), states(reference));
+        QCOMPARE(foregrounds(doc), foregrounds(reference));
+    }
+
+    void EditRestartsHighlighting() {
+        QTextDocument doc(makeText(20000));
+        Qutepart::SyntaxHighlighter hl(&doc, Qutepart::loadLanguage("cpp.xml"));
+        hl.setTimeSliceBudget(1);
+        QSignalSpy finished(&hl, &Qutepart::SyntaxHighlighter::highlightingFinished);
+        hl.rehighlight();
+        QVERIFY(finished.wait(30000));
+
+        // opens a comment, which changes the rest of the document
+        QTextCursor cursor(doc.findBlockByNumber(10));
+        cursor.insertText("/* ");
+        QVERIFY(finished.wait(30000));
+
+        QVERIFY(!hl.isHighlightingPending());
+        QCOMPARE(states(doc), referenceStates(doc.toPlainText()));
+    }
+
+    // A theme change looks up the formats of the style ids again, the rules are not matched
+    void ThemeChangeRestyles() {
+#ifdef QUTEPART_NO_PROFILER
+        QSKIP("The profiler is compiled out");
+#endif
+        QTextDocument doc(makeText(2000));
+        auto language = Qutepart::loadLanguage("cpp.xml");
+        Qutepart::SyntaxHighlighter hl(&doc, language);
+        hl.setTimeSliceBudget(0);
+        hl.rehighlight();
+        auto statesBefore = states(doc);
+        auto colorsBefore = foregrounds(doc);
+
+        language->resetProfile();
+        Qutepart::setProfilingEnabled(true);
+        Qutepart::Theme theme;
+        QVERIFY(theme.loadTheme(":/qutepart/themes/atom-one-dark.theme"));
+        hl.setVisibleBlocks(0, 40);
+        hl.setTheme(&theme);
+        QVERIFY(hl.isRestylePending());
+        QVERIFY(foregrounds(doc) != colorsBefore); // the visible blocks at once
+
+        QTRY_VERIFY(!hl.isRestylePending());
+        QCOMPARE(totalAttempts(language->profile()), quint64(0));
+        QCOMPARE(states(doc), statesBefore);
+        auto colorsAfter = foregrounds(doc);
+        QCOMPARE(colorsAfter.size(), colorsBefore.size());
+        QVERIFY(colorsAfter != colorsBefore);
+
+        // the same theme object, loaded again with other colors
+        QVERIFY(theme.loadTheme(":/qutepart/themes/github-light.theme"));
+        hl.setTheme(&theme);
+        QTRY_VERIFY(!hl.isRestylePending());
+        QVERIFY(foregrounds(doc) != colorsAfter);
+
+        // back to the default theme
+        hl.setTheme(nullptr);
+        QTRY_VERIFY(!hl.isRestylePending());
+        QCOMPARE(foregrounds(doc), colorsBefore);
+        QCOMPARE(totalAttempts(language->profile()), quint64(0));
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_background_highlighting.moc"
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include <QObject>
+#include <QRegularExpression>
+#include <QTest>
+
+#include "hl/compiled_contexts.h"
+#include "hl/language.h"
+#include "hl/loader.h"
+
+namespace {
+
+// The highlighting of the lines, formats and the end context of every line
+QStringList highlight(const Qutepart::Language &language, const QStringList &lines) {
+    QStringList result;
+    auto contextStack = language.getDefaultContextStack();
+    for (const auto &line : lines) {
+        auto highlighted = language.highlightLine(line, contextStack);
+        QString formats;
+        for (const auto &run : std::as_const(highlighted.formats)) {
+            formats += QString(" %1:%2:%3").arg(run.start).arg(run.length).arg(run.styleId);
+        }
+        contextStack = highlighted.endContextStack;
+        result << highlighted.textTypeMap() + formats + " " +
+                      contextStack.currentContext()->name();
+    }
+    return result;
+}
+
+} // namespace
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void initTestCase() { Q_INIT_RESOURCE(qutepart_syntax_files); }
+
+    void cleanup() { Qutepart::setCompiledMatchersEnabled(true); }
+
+    void Sorted() {
+        QVERIFY(std::is_sorted(
+            Qutepart::compiledContexts.begin(), Qutepart::compiledContexts.end(),
+            [](const Qutepart::CompiledContext &a, const Qutepart::CompiledContext &b) {
+                return QLatin1String(a.fileName) < QLatin1String(b.fileName);
+            }));
+    }
+
+    void SameAsInterpreted_data() {
+        QTest::addColumn<QString>("xmlFileName");
+        QTest::addColumn<QStringList>("lines");
+
+        QTest::newRow("cpp") << "cpp.xml"
+                             << QStringList{"#include <vector> // comment",
+                                            "#define MAX(a, b) \\",
+                                            "    ((a) > (b) ? (a) : (b))",
+                                            "template <typename T> auto f(T t) -> T {",
+                                            "    /* block */ auto s = R\"x(raw)x\" u8\"str\\n\";",
+                                            "    char c = '\\''; int i = 0x1F'00 + 1.5e3f;",
+                                            "    /* unterminated",
+                                            "    comment */ return t;",
+                                            "}"};
+        QTest::newRow("python") << "python.xml"
+                                << QStringList{"import os  # comment",
+                                               "@decorator",
+                                               "def f(a, *args, **kwargs) -> int:",
+                                               "    s = f'{a!r} {b:>10}' + r'\\d' + b\"x\"",
+                                               "    \"\"\"doc",
+                                               "    string\"\"\"",
+                                               "    return 0x1f + 1_000 + 1.5j"};
+        QTest::newRow("json") << "json.xml"
+                              << QStringList{"{", "  \"key\": [1, -2.5e3, true, null],",
+                                             "  \"s\": \"esc\\\"aped\\u0041\"", "}"};
+        QTest::newRow("yaml") << "yaml.xml"
+                              << QStringList{"---", "key: value  # comment",
+                                             "list:", "  - &anchor {a: 1, b: [x, 'y']}",
+                                             "  - *anchor", "text: |", "  literal \"text\""};
+        QTest::newRow("cmake") << "cmake.xml"
+                               << QStringList{"cmake_minimum_required(VERSION 3.16)",
+                                              "# comment",
+                                              "set(FOO \"${BAR}/baz\" $ENV{HOME})",
+                                              "if (NOT FOO AND $<CONFIG:Debug>)",
+                                              "  message(STATUS [=[bracket]=])",
+                                              "endif()"};
+        QTest::newRow("markdown") << "markdown.xml"
+                                  << QStringList{"# Title", "",
+                                                 "Some *emphasis*, **bold** and `code`.",
+                                                 "* item [link](http://example.com)",
+                                                 "> quote", "", "```cpp", "int a = 1;",
+                                                 "```"};
+    }
+
+    // The generated matchers find the same rules as the interpreter
+    void SameAsInterpreted() {
+        QFETCH(QString, xmlFileName);
+        QFETCH(QStringList, lines);
+        QTest::failOnWarning(QRegularExpression("Compiled context"));
+
+        auto language = Qutepart::loadLanguage(xmlFileName);
+        QVERIFY(!language.isNull());
+
+        auto compiled = highlight(*language, lines);
+        Qutepart::setCompiledMatchersEnabled(false);
+        auto interpreted = highlight(*language, lines);
+        QCOMPARE(compiled, interpreted);
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_compiled_contexts.moc"
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <vector>
+
+#include <QObject>
+#include <QSet>
+#include <QTest>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QThreadPool>
+
+#include "hl/language.h"
+#include "hl/loader.h"
+#include "hl/syntax_highlighter.h"
+
+namespace {
+
+const QStringList LINES = {
+    "int main() {",
+    "    /* block",
+    "       comment */ const char *s = \"string\";",
+    "#if 0",
+    "    disabled();",
+    "#endif",
+    "}",
+};
+
+Qutepart::ContextStack highlightAll(const Qutepart::Language &language,
+                                    Qutepart::ContextStack contextStack) {
+    for (const auto &line : LINES) {
+        contextStack = language.highlightLine(line, contextStack).endContextStack;
+    }
+    return contextStack;
+}
+
+class CountingHighlighter : public Qutepart::SyntaxHighlighter {
+  public:
+    using SyntaxHighlighter::SyntaxHighlighter;
+    int highlightedBlocks = 0;
+
+  protected:
+    void highlightBlock(const QString &text) override {
+        highlightedBlocks++;
+        SyntaxHighlighter::highlightBlock(text);
+    }
+};
+
+} // namespace
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void initTestCase() { Q_INIT_RESOURCE(qutepart_syntax_files); }
+
+    void Interned() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        auto start = language->getDefaultContextStack();
+        auto inComment = language->highlightLine(LINES[1], start).endContextStack;
+        auto inCommentAgain = language->highlightLine(LINES[1], start).endContextStack;
+        QVERIFY(inComment != start);
+        QVERIFY(inComment == inCommentAgain);
+        QCOMPARE(inComment.id(), inCommentAgain.id());
+        QCOMPARE(qHash(inComment), qHash(inCommentAgain));
+        QCOMPARE(inComment.depth(), start.depth() + 1);
+    }
+
+    void NoGrowthOnRehighlight() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        auto end = highlightAll(*language, language->getDefaultContextStack());
+        QVERIFY(end == language->getDefaultContextStack());
+
+        auto size = language->getContextStackTable().size();
+        for (int i = 0; i < 10; i++) {
+            QVERIFY(highlightAll(*language, end) == end);
+        }
+        QCOMPARE(language->getContextStackTable().size(), size);
+    }
+
+    void BlockState() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        auto start = language->getDefaultContextStack();
+        auto inComment = language->highlightLine(LINES[1], start).endContextStack;
+
+        QStack<QString> noRegions;
+        QStack<QString> regions;
+        regions.push("Brace1");
+
+        auto state = *language->blockState(start, noRegions);
+        QCOMPARE(*language->blockState(start, noRegions), state);
+        QVERIFY(*language->blockState(inComment, noRegions) != state);
+        QVERIFY(*language->blockState(start, regions) != state);
+        QVERIFY(*language->blockState(inComment, regions) != *language->blockState(start, regions));
+    }
+
+    // States no block keeps are forgotten, and not reused for other stacks
+    void BlockStatesBounded() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        auto start = language->getDefaultContextStack();
+        QStack<QString> kept;
+        kept.push("kept");
+        auto keptState = language->blockState(start, kept);
+
+        QSet<int> states = {*keptState};
+        for (int i = 0; i < Qutepart::Language::MAX_BLOCK_STATES + 10; i++) {
+            QStack<QString> regions;
+            regions.push(QString::number(i));
+            states.insert(*language->blockState(start, regions));
+        }
+        QCOMPARE(states.size(), Qutepart::Language::MAX_BLOCK_STATES + 11);
+        QCOMPARE(language->blockState(start, kept), keptState);
+        QVERIFY(language->contextStacksMemoryUsage() < 1024 * 1024 * 16);
+    }
+
+    // Crossing the limit doesn't change the states of the blocks, an edit highlights one block
+    void BlockStatesOfDocumentKept() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        QStringList lines;
+        for (int i = 0; i < 100; i++) {
+            lines << LINES;
+        }
+        QTextDocument doc(lines.join('\n'));
+        CountingHighlighter hl(&doc, language);
+        hl.setTimeSliceBudget(0);
+        hl.rehighlight();
+
+        auto start = language->getDefaultContextStack();
+        for (int i = 0; i < Qutepart::Language::MAX_BLOCK_STATES + 10; i++) {
+            QStack<QString> regions;
+            regions.push(QString::number(i));
+            language->blockState(start, regions);
+        }
+
+        hl.highlightedBlocks = 0;
+        QTextCursor cursor(doc.findBlockByNumber(LINES.size() * 50)); // "int main() {"
+        cursor.insertText("x");
+        QCOMPARE(hl.highlightedBlocks, 1);
+    }
+
+    // Stacks with data are deleted with the last stack referring to them, none loses its data
+    void DataStacksNotBounded() {
+        auto language = Qutepart::loadLanguage("bash.xml");
+        QVERIFY(!language.isNull());
+
+        auto start = language->getDefaultContextStack();
+        for (int i = 0; i < Qutepart::ContextStackTable::DATA_STACKS_SWEEP_SIZE + 10; i++) {
+            auto delimiter = QString("END%1").arg(i);
+            auto inHeredoc = language->highlightLine("cat <<" + delimiter, start).endContextStack;
+            QVERIFY(inHeredoc != start);
+            inHeredoc = language->highlightLine("text", inHeredoc).endContextStack;
+            QVERIFY(inHeredoc != start);
+            QVERIFY(language->highlightLine(delimiter, inHeredoc).endContextStack == start);
+        }
+        QVERIFY(language->getContextStackTable().size() <
+                Qutepart::ContextStackTable::DATA_STACKS_SWEEP_SIZE + 1000);
+    }
+
+    // Interning from several threads at once gives the same stacks
+    void ConcurrentInterning() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+        auto expected = language->highlightLine(LINES[1], language->getDefaultContextStack());
+
+        const int jobs = 8;
+        std::vector<Qutepart::ContextStack> results(jobs);
+        QThreadPool pool;
+        for (int i = 0; i < jobs; i++) {
+            pool.start([&language, &results, i]() {
+                for (int j = 0; j < 1000; j++) {
+                    results[i] = highlightAll(*language, language->getDefaultContextStack());
+                }
+            });
+        }
+        pool.waitForDone();
+        for (const auto &result : results) {
+            QVERIFY(result == language->getDefaultContextStack());
+        }
+        QVERIFY(expected.endContextStack ==
+                language->highlightLine(LINES[1], language->getDefaultContextStack())
+                    .endContextStack);
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_context_stack.moc"
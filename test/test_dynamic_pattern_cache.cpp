@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "hl/dynamic_pattern_cache.h"
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void Reuse() {
+        Qutepart::DynamicPatternCache<QString> cache;
+        int made = 0;
+        auto make = [&made](const QStringList &data) {
+            made++;
+            return data.join('|');
+        };
+
+        QCOMPARE(cache.get({"EOF"}, make), QString("EOF"));
+        QCOMPARE(cache.get({"EOF"}, make), QString("EOF"));
+        QCOMPARE(cache.get({"END", "x"}, make), QString("END|x"));
+        QCOMPARE(cache.get({"EOF"}, make), QString("EOF"));
+        QCOMPARE(made, 2);
+        QCOMPARE(cache.size(), 2);
+    }
+
+    void Bounded() {
+        using Cache = Qutepart::DynamicPatternCache<QString>;
+        Cache cache;
+        int made = 0;
+        auto make = [&made](const QStringList &data) {
+            made++;
+            return data.first();
+        };
+
+        for (int i = 0; i < Cache::CAPACITY * 3; i++) {
+            cache.get({QString::number(i)}, make);
+        }
+        QCOMPARE(cache.size(), Cache::CAPACITY);
+        QCOMPARE(made, Cache::CAPACITY * 3);
+
+        // the most recent entry is still there, the first one was dropped
+        cache.get({QString::number(Cache::CAPACITY * 3 - 1)}, make);
+        QCOMPARE(made, Cache::CAPACITY * 3);
+        cache.get({"0"}, make);
+        QCOMPARE(made, Cache::CAPACITY * 3 + 1);
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_dynamic_pattern_cache.moc"
@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <vector>
+
+#include <QObject>
+#include <QTest>
+#include <QThreadPool>
+
+#include "hl/language.h"
+#include "hl/line_cache.h"
+#include "hl/loader.h"
+#include "hl/profiler.h"
+#include "hl/style.h"
+#include "theme.h"
+
+namespace {
+
+const QStringList LINES = {
+    "int main() {",
+    "    int a = 1; // comment",
+    "    /* block",
+    "       comment */ const char *s = \"string\";",
+    "}",
+};
+
+QStringList textTypeMaps(const Qutepart::Language &language, const QStringList &lines) {
+    QStringList result;
+    auto contextStack = language.getDefaultContextStack();
+    for (const auto &line : lines) {
+        auto highlighted = language.highlightLine(line, contextStack);
+        result << highlighted.textTypeMap();
+        contextStack = highlighted.endContextStack;
+    }
+    return result;
+}
+
+} // namespace
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void initTestCase() {
+        Q_INIT_RESOURCE(qutepart_syntax_files);
+        Q_INIT_RESOURCE(qutepart_theme_data);
+    }
+
+    void TextTypes() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        auto maps = textTypeMaps(*language, LINES);
+        QCOMPARE(maps.size(), LINES.size());
+        for (int i = 0; i < LINES.size(); i++) {
+            QCOMPARE(maps[i].length(), LINES[i].length());
+        }
+
+        QCOMPARE(maps[1].at(4), QChar(' '));                   // int
+        QVERIFY(maps[1].at(LINES[1].indexOf("//")) != ' ');    // comment
+        QVERIFY(maps[2].at(LINES[2].indexOf("block")) != ' '); // block comment
+        QVERIFY(maps[3].at(0) != ' ');                         // still in the comment
+        QCOMPARE(maps[3].at(LINES[3].indexOf("const")), QChar(' '));
+        QCOMPARE(maps[3].at(LINES[3].indexOf("string")), QChar('s'));
+    }
+
+    void FormatsAndRegions() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        auto first = language->highlightLine(LINES[0], language->getDefaultContextStack());
+        QVERIFY(!first.formats.isEmpty());
+        for (const auto &run : std::as_const(first.formats)) {
+            QVERIFY(run.styleId != -1);
+            QVERIFY(run.start >= 0 && run.start + run.length <= LINES[0].length());
+        }
+        QCOMPARE(first.regionChanges.size(), 1);
+        QCOMPARE(first.regionChanges[0].kind, Qutepart::HighlightedLine::RegionChange::Begin);
+
+        auto last = language->highlightLine(LINES[4], first.endContextStack);
+        QCOMPARE(last.regionChanges.size(), 1);
+        QCOMPARE(last.regionChanges[0].kind, Qutepart::HighlightedLine::RegionChange::End);
+
+        QStack<QString> regions;
+        first.applyRegionChanges(regions);
+        QCOMPARE(regions.size(), 1);
+        last.applyRegionChanges(regions);
+        QVERIFY(regions.isEmpty());
+    }
+
+    void Spans() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        Qutepart::TextSpans spans;
+        auto contextStack = language->getDefaultContextStack();
+        for (const auto &text : LINES) {
+            auto line = language->highlightLine(text, contextStack);
+            contextStack = line.endContextStack;
+
+            line.writeSpans(spans);
+            QCOMPARE(spans.textTypeMap(), line.textTypeMap());
+            QVERIFY(spans.spans().size() <= line.textTypes.size() + line.languages.size());
+
+            auto languageMap = line.languageMap();
+            for (int column = 0; column < text.length(); column++) {
+                QCOMPARE(spans.textTypeAt(column), line.textTypeMap().at(column));
+                QCOMPARE(spans.languageAt(column), languageMap[column]);
+            }
+            QCOMPARE(spans.textTypeAt(text.length()), QChar(' '));
+            QCOMPARE(spans.languageAt(-1), nullptr);
+        }
+    }
+
+    void WorkerThreads() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        QStringList lines;
+        for (int i = 0; i < 200; i++) {
+            lines << LINES;
+        }
+        auto expected = textTypeMaps(*language, lines);
+
+        const int jobs = 16;
+        std::vector<QStringList> results(jobs);
+        QThreadPool pool;
+        for (int i = 0; i < jobs; i++) {
+            pool.start([&language, &lines, &results, i]() {
+                results[i] = textTypeMaps(*language, lines);
+            });
+        }
+        pool.waitForDone();
+
+        for (const auto &result : results) {
+            QCOMPARE(result, expected);
+        }
+    }
+
+    // Chunks highlighted in parallel from a guessed context are fixed to the real context
+    void ParallelChunks() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        QStringList lines;
+        for (int i = 0; i < 100; i++) {
+            lines << LINES;
+        }
+        QList<QStringView> views(lines.cbegin(), lines.cend());
+        auto expected = textTypeMaps(*language, lines);
+
+        Qutepart::ParallelHighlightStats stats;
+        auto highlighted = language->highlightLines(views, 7, &stats);
+        QCOMPARE(highlighted.size(), lines.size());
+        QStringList maps;
+        for (const auto &line : std::as_const(highlighted)) {
+            maps << line.textTypeMap();
+        }
+        QCOMPARE(maps, expected);
+
+        // Chunks start in the block comment on the 4th line of LINES, and end it on that line
+        QCOMPARE(stats.chunks, 72);
+        QVERIFY(stats.rehighlightedChunks > 0);
+        QCOMPARE(stats.rehighlightedLines, stats.rehighlightedChunks);
+    }
+
+    // Repeated lines starting in the same context are taken from the cache
+    void CachedLines() {
+        Qutepart::clearLanguageCache();
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+
+        QStringList lines;
+        for (int i = 0; i < 20; i++) {
+            lines << LINES;
+        }
+        auto expected = textTypeMaps(*language, lines);
+        QCOMPARE(language->lineCacheStats().hits, quint64(0));
+
+        Qutepart::setLineCacheCapacity(100);
+        auto cached = textTypeMaps(*language, lines);
+        Qutepart::setLineCacheCapacity(0);
+        QCOMPARE(cached, expected);
+
+        auto stats = language->lineCacheStats();
+        QCOMPARE(stats.misses, quint64(LINES.size()));
+        QCOMPARE(stats.hits, quint64(lines.size() - LINES.size()));
+        QVERIFY(language->lineCacheMemoryUsage() > 0);
+
+        // Dropped when a line is highlighted with the cache disabled
+        textTypeMaps(*language, LINES);
+        QCOMPARE(language->lineCacheMemoryUsage(), size_t(0));
+    }
+
+    // Simple rules are matched by the context from their records. The profiler calls the rules
+    void RuleRecordsSameAsRules() {
+#ifdef QUTEPART_NO_PROFILER
+        QSKIP("The profiler is compiled out");
+#endif
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+        QStringList lines = LINES;
+        lines << "#define MAX(a, b) \\" << "    ((a) > (b) ? (a) : (b))"
+              << "char c = '\\n'; int i = 0x1F + 017 + 1.5e3;";
+
+        auto expected = textTypeMaps(*language, lines);
+        Qutepart::setProfilingEnabled(true);
+        auto byRules = textTypeMaps(*language, lines);
+        Qutepart::setProfilingEnabled(false);
+        QCOMPARE(byRules, expected);
+    }
+
+    // Languages are loaded once and shared, also when loaded by several threads at once
+    void SharedLanguage() {
+        Qutepart::clearLanguageCache();
+
+        const int jobs = 8;
+        std::vector<QSharedPointer<Qutepart::Language>> results(jobs);
+        QThreadPool pool;
+        for (int i = 0; i < jobs; i++) {
+            pool.start([&results, i]() {
+                results[i] = Qutepart::loadLanguage(i % 2 ? "php.xml" : "html.xml");
+            });
+        }
+        pool.waitForDone();
+
+        auto php = Qutepart::loadLanguage("php.xml");
+        auto html = Qutepart::loadLanguage("html.xml");
+        QVERIFY(!php.isNull());
+        QVERIFY(!html.isNull());
+        for (int i = 0; i < jobs; i++) {
+            QCOMPARE(results[i], i % 2 ? php : html);
+        }
+    }
+
+    // Included languages are loaded when highlighting reaches them
+    void ExternalContexts() {
+        Qutepart::clearLanguageCache();
+        auto html = Qutepart::loadLanguage("html.xml");
+        QVERIFY(!html.isNull());
+        QCOMPARE(html->loadedExternalLanguages(), QStringList());
+
+        auto contextStack = html->getDefaultContextStack();
+        for (const auto &text : {"<p>text</p>", "<style>", "p { color: red; }", "</style>"}) {
+            auto line = html->highlightLine(QString(text), contextStack);
+            contextStack = line.endContextStack;
+        }
+        QCOMPARE(html->loadedExternalLanguages(), QStringList{"css.xml"});
+    }
+
+    // The theme selects the formats, the language is not modified
+    void StyleTables() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+        auto line = language->highlightLine(LINES[1], language->getDefaultContextStack());
+        int commentStyle = -1;
+        for (const auto &run : std::as_const(line.formats)) {
+            if (run.start == LINES[1].indexOf("//")) {
+                commentStyle = run.styleId;
+            }
+        }
+        QVERIFY(commentStyle != -1);
+
+        Qutepart::Theme theme;
+        QVERIFY(theme.loadTheme(":/qutepart/themes/atom-one-dark.theme"));
+        auto defaultStyles = Qutepart::StyleTable::get(nullptr);
+        auto themeStyles = Qutepart::StyleTable::get(&theme);
+        QCOMPARE(Qutepart::StyleTable::get(&theme), themeStyles);
+        QVERIFY(defaultStyles != themeStyles);
+
+        auto defaultFormat = defaultStyles->format(commentStyle);
+        auto themeFormat = themeStyles->format(commentStyle);
+        QVERIFY(defaultFormat != nullptr);
+        QVERIFY(themeFormat != nullptr);
+        QVERIFY(defaultFormat->foreground() != themeFormat->foreground());
+        QCOMPARE(defaultStyles->format(-1), nullptr);
+
+        auto again = language->highlightLine(LINES[1], language->getDefaultContextStack());
+        QCOMPARE(again.formats.size(), line.formats.size());
+    }
+
+    // Tables are shared by the text styles, not by the theme object
+    void StyleTablesByContent() {
+        Qutepart::Theme theme;
+        QVERIFY(theme.loadTheme(":/qutepart/themes/atom-one-dark.theme"));
+        auto styles = Qutepart::StyleTable::get(&theme);
+
+        Qutepart::Theme sameTheme;
+        QVERIFY(sameTheme.loadTheme(":/qutepart/themes/atom-one-dark.theme"));
+        QCOMPARE(Qutepart::StyleTable::get(&sameTheme), styles);
+
+        QVERIFY(theme.loadTheme(":/qutepart/themes/github-light.theme"));
+        auto reloaded = Qutepart::StyleTable::get(&theme);
+        QVERIFY(reloaded != styles);
+        QCOMPARE(Qutepart::StyleTable::get(&sameTheme), styles);
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_highlight_line.moc"
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "hl/keyword_set.h"
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void CaseSensitive() {
+        Qutepart::KeywordSet keywords({"select", "from", "where", "from"}, true);
+
+        QCOMPARE(keywords.size(), 3);
+        QVERIFY(keywords.contains(u"select"));
+        QVERIFY(keywords.contains(u"from"));
+        QVERIFY(!keywords.contains(u"SELECT"));
+        QVERIFY(!keywords.contains(u"wher"));
+        QVERIFY(!keywords.contains(u"wherever"));
+        QVERIFY(!keywords.contains(u""));
+    }
+
+    void CaseInsensitive() {
+        Qutepart::KeywordSet keywords({"begin", "end", "procedure"}, false);
+
+        QVERIFY(keywords.contains(u"BEGIN"));
+        QVERIFY(keywords.contains(u"End"));
+        QVERIFY(keywords.contains(u"proCEDure"));
+        QVERIFY(!keywords.contains(u"ending"));
+
+        QVERIFY(keywords.startChars().contains('B'));
+        QVERIFY(keywords.startChars().contains('e'));
+        QVERIFY(!keywords.startChars().contains('x'));
+    }
+
+    void SubstringOfLine() {
+        QString line = "if (x) return y;";
+        Qutepart::KeywordSet keywords({"if", "return"}, true);
+
+        QVERIFY(keywords.contains(QStringView(line).mid(0, 2)));
+        QVERIFY(keywords.contains(QStringView(line).mid(7, 6)));
+        QVERIFY(!keywords.contains(QStringView(line).mid(7, 5)));
+    }
+
+    void ManyWords() {
+        QStringList words;
+        for (int i = 0; i < 5000; i++) {
+            words << QString("kw%1").arg(i);
+        }
+        Qutepart::KeywordSet keywords(words, true);
+
+        for (int i = 0; i < 5000; i++) {
+            QVERIFY(keywords.contains(QString("kw%1").arg(i)));
+        }
+        QVERIFY(!keywords.contains(u"kw5000"));
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_keyword_set.moc"
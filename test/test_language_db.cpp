@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include <QObject>
+#include <QRegularExpression>
+#include <QTest>
+
+#include "hl/language_db.h"
+#include "qutepart/qutepart.h"
+
+namespace {
+
+struct Glob {
+    QString pattern;
+    QString value;
+    int rank;
+};
+
+// The file name globs as they are in the syntax files, up to case, sorted by rank
+QList<Glob> allFileNameGlobs() {
+    QList<Glob> globs;
+    for (const auto &glob : Qutepart::fileNameGlobs) {
+        globs.append({QString(glob.pattern), glob.value, glob.rank});
+    }
+    for (const auto &glob : Qutepart::fileNameSuffixGlobs) {
+        auto literal = QString(glob.pattern);
+        std::reverse(literal.begin(), literal.end());
+        globs.append({"*" + literal, glob.value, glob.rank});
+    }
+    for (const auto &glob : Qutepart::fileNamePrefixGlobs) {
+        globs.append({QString(glob.pattern) + "*", glob.value, glob.rank});
+    }
+    for (const auto &glob : Qutepart::residualFileNameGlobs) {
+        globs.append({QString(glob.pattern), glob.value, glob.rank});
+    }
+    std::sort(globs.begin(), globs.end(),
+              [](const Glob &a, const Glob &b) { return a.rank < b.rank; });
+    return globs;
+}
+
+// Every glob matched as a regular expression, as the language DB did before it was split
+QString referenceSearch(const QList<Glob> &globs, const QString &fileName) {
+    for (const auto &glob : globs) {
+        QString wildcardExp = QRegularExpression::wildcardToRegularExpression(glob.pattern);
+        QRegularExpression re(QRegularExpression::anchoredPattern(wildcardExp),
+                              QRegularExpression::CaseInsensitiveOption);
+        if (re.match(fileName).hasMatch()) {
+            return glob.value;
+        }
+    }
+    return QString();
+}
+
+template <typename T> bool isSorted(const Qutepart::LanguageDbTable<T> &table) {
+    return std::is_sorted(table.begin(), table.end(), [](const T &a, const T &b) {
+        return QLatin1String(a.key) < QLatin1String(b.key);
+    });
+}
+
+} // namespace
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void SortedTables() {
+        QVERIFY(isSorted(Qutepart::languageNameToXmlFileName));
+        QVERIFY(isSorted(Qutepart::mimeTypeToXmlFileName));
+        QVERIFY(isSorted(Qutepart::xmlFileNameToIndenter));
+        QVERIFY(isSorted(Qutepart::xmlFileNameToLanguageNames));
+    }
+
+    void ChooseLanguage_data() {
+        QTest::addColumn<QString>("mimeType");
+        QTest::addColumn<QString>("languageName");
+        QTest::addColumn<QString>("filePath");
+        QTest::addColumn<QString>("firstLine");
+        QTest::addColumn<QString>("id");
+
+        QTest::newRow("mime") << "text/x-c++src" << QString() << QString() << QString()
+                              << "cpp.xml";
+        QTest::newRow("name") << QString() << "Python" << QString() << QString() << "python.xml";
+        QTest::newRow("extension") << QString() << QString() << "/src/main.cpp" << QString()
+                                   << "cpp.xml";
+        QTest::newRow("extension case") << QString() << QString() << "MAIN.CPP" << QString()
+                                        << "cpp.xml";
+        QTest::newRow("file name") << QString() << QString() << "/src/CMakeLists.txt" << QString()
+                                   << "cmake.xml";
+        QTest::newRow("prefix") << QString() << QString() << "Makefile.am" << QString()
+                                << "makefile.xml";
+        QTest::newRow("first line") << QString() << QString() << "script" << "<?php echo 1;"
+                                    << "html-php.xml";
+        QTest::newRow("unknown") << QString() << QString() << "file.no-such-extension"
+                                 << QString() << QString();
+    }
+
+    void ChooseLanguage() {
+        QFETCH(QString, mimeType);
+        QFETCH(QString, languageName);
+        QFETCH(QString, filePath);
+        QFETCH(QString, firstLine);
+        QFETCH(QString, id);
+
+        auto langInfo = Qutepart::chooseLanguage(mimeType, languageName, filePath, firstLine);
+        QCOMPARE(langInfo.id, id);
+    }
+
+    void LanguageNames() {
+        auto langInfo = Qutepart::chooseLanguage(QString(), QString(), "main.cpp");
+        QVERIFY(langInfo.names.contains("C++"));
+        QCOMPARE(langInfo.indentAlg, Qutepart::INDENT_ALG_CSTYLE);
+
+        langInfo = Qutepart::chooseLanguage(QString(), QString(), "README.md");
+        QCOMPARE(langInfo.indentAlg, Qutepart::INDENT_ALG_MARKDOWN);
+    }
+
+    void SameAsGlobSearch() {
+        const auto globs = allFileNameGlobs();
+        QStringList fileNames = {"foo.tar.gz", "x.log.1", "a.F", "a.f", "noext", ".hidden"};
+        for (const auto &glob : globs) {
+            for (const auto &wildcard : {"", "x", "a.b"}) {
+                QString fileName = glob.pattern;
+                fileName.replace('*', wildcard).replace('?', 'q');
+                if (fileName.contains('/')) {
+                    continue; // only the file name of a path is matched
+                }
+                fileNames << fileName << fileName.toUpper() << "pre" + fileName
+                          << fileName + ".bak";
+            }
+        }
+
+        for (const auto &fileName : std::as_const(fileNames)) {
+            auto langInfo = Qutepart::chooseLanguage(QString(), QString(), fileName);
+            QCOMPARE(langInfo.id, referenceSearch(globs, fileName));
+        }
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_language_db.moc"
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <utility>
+
+#include <QJsonArray>
+#include <QObject>
+#include <QTest>
+
+#include "hl/language.h"
+#include "hl/loader.h"
+#include "hl/profiler.h"
+
+namespace {
+
+const QStringList LINES = {
+    "#include <stdio.h>",
+    "/* comment",
+    "   end */ int main() {",
+    "    return 0x10; // done",
+    "}",
+};
+
+quint64 totalAttempts(const QList<Qutepart::ProfileEntry> &entries) {
+    quint64 result = 0;
+    for (const auto &entry : entries) {
+        result += entry.counters.attempts;
+    }
+    return result;
+}
+
+} // namespace
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private:
+    void highlight(const QSharedPointer<Qutepart::Language> &language) {
+        auto contextStack = language->getDefaultContextStack();
+        for (const auto &text : LINES) {
+            auto line = language->highlightLine(text, contextStack);
+            contextStack = line.endContextStack;
+        }
+    }
+
+  private slots:
+    void initTestCase() { Q_INIT_RESOURCE(qutepart_syntax_files); }
+
+    void cleanup() { Qutepart::setProfilingEnabled(false); }
+
+    void Disabled() {
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+        language->resetProfile();
+
+        highlight(language);
+        QCOMPARE(totalAttempts(language->profile()), quint64(0));
+    }
+
+    void Counters() {
+#ifdef QUTEPART_NO_PROFILER
+        QSKIP("The profiler is compiled out");
+#endif
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+        language->resetProfile();
+
+        Qutepart::setProfilingEnabled(true);
+        highlight(language);
+
+        auto entries = language->profile();
+        QVERIFY(totalAttempts(entries) > 0);
+
+        quint64 switches = 0;
+        bool ruleHit = false;
+        for (const auto &entry : std::as_const(entries)) {
+            QVERIFY(entry.counters.hits <= entry.counters.attempts);
+            switches += entry.counters.contextSwitches;
+            if (entry.ruleIndex != -1 && entry.counters.hits > 0) {
+                QVERIFY(!entry.rule.isEmpty());
+                ruleHit = true;
+            }
+        }
+        QVERIFY(ruleHit);
+        // preprocessor, comment start and end, line end of the preprocessor and line comment
+        QVERIFY(switches >= 4);
+
+        auto json = language->profileJson();
+        QCOMPARE(json["language"].toString(), language->getName());
+        QVERIFY(!json["rules"].toArray().isEmpty());
+
+        QString table;
+        QTextStream out(&table);
+        language->printProfile(out);
+        QVERIFY(table.startsWith("Language " + language->getName()));
+
+        language->resetProfile();
+        QCOMPARE(totalAttempts(language->profile()), quint64(0));
+    }
+
+    // The text of a comment no rule can start at is skipped, the rules are not tried on it
+    void SkipsCommentText() {
+#ifdef QUTEPART_NO_PROFILER
+        QSKIP("The profiler is compiled out");
+#endif
+        auto language = Qutepart::loadLanguage("c.xml");
+        QVERIFY(!language.isNull());
+        const QString text = QString("lorem ipsum dolor sit amet, ").repeated(100);
+        const QStringList lines = {"/* " + text, text + "*/ int a;"};
+
+        auto highlight = [&language, &lines]() {
+            QList<Qutepart::HighlightedLine> result;
+            auto contextStack = language->getDefaultContextStack();
+            for (const auto &line : lines) {
+                result << language->highlightLine(line, contextStack);
+                contextStack = result.last().endContextStack;
+            }
+            return result;
+        };
+        highlight(); // loads the alerts language included by the comment
+
+        language->resetProfile();
+        Qutepart::setProfilingEnabled(true);
+        auto highlighted = highlight();
+        Qutepart::setProfilingEnabled(false);
+
+        quint64 commentAttempts = 0;
+        for (const auto &entry : language->profile()) {
+            if (entry.context == "Commentar 2" && entry.ruleIndex == -1) {
+                commentAttempts = entry.counters.attempts;
+            }
+        }
+        // after "/*", at the start of the second line and at "*/"
+        QCOMPARE(commentAttempts, quint64(3));
+
+        QCOMPARE(highlighted[0].formats.size(), 1);
+        QCOMPARE(highlighted[0].formats[0].length, lines[0].length());
+        QCOMPARE(highlighted[1].textTypeMap().left(text.length() + 2),
+                 QString(text.length() + 2, 'c'));
+        QVERIFY(highlighted[1].endContextStack.currentContext()->name() == "Normal");
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_profiler.moc"
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2018-2023 Andrei Kopats
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <QObject>
+#include <QRegularExpression>
+#include <QTest>
+
+#include "hl/regexp_analysis.h"
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private:
+    static QString asciiChars(const Qutepart::StartCharSet &chars) {
+        QString result;
+        for (ushort code = 0; code < chars.ascii.size(); code++) {
+            if (chars.ascii.test(code)) {
+                result += QChar(code);
+            }
+        }
+        return result;
+    }
+
+  private slots:
+    void StartChars_data() {
+        QTest::addColumn<QString>("pattern");
+        QTest::addColumn<bool>("insensitive");
+        QTest::addColumn<bool>("derived");
+        QTest::addColumn<QString>("expected");
+
+        QTest::newRow("literal") << "include" << false << true << "i";
+        QTest::newRow("optional prefix") << "a?b*c" << false << true << "abc";
+        QTest::newRow("alternation") << "(foo|bar)x" << false << true << "bf";
+        QTest::newRow("optional group") << "(?:x|y{0,3})z" << false << true << "xyz";
+        QTest::newRow("class") << "[A-Z_][0-9]" << false << true
+                               << "ABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+        QTest::newRow("escaped") << "\\$\\{" << false << true << "$";
+        QTest::newRow("word start") << "\\bfoo" << false << true << "f";
+        QTest::newRow("line start") << "^#" << false << true << "#";
+        QTest::newRow("insensitive") << "x" << true << true << "Xx";
+        QTest::newRow("negated class") << "[^a]" << false << false << "";
+        QTest::newRow("any char") << ".*" << false << false << "";
+        QTest::newRow("lookahead") << "(?=x)y" << false << false << "";
+        QTest::newRow("back reference") << "(a)\\1" << false << true << "a";
+        QTest::newRow("unbalanced") << "(a" << false << false << "";
+    }
+
+    void StartChars() {
+        QFETCH(QString, pattern);
+        QFETCH(bool, insensitive);
+        QFETCH(bool, derived);
+        QFETCH(QString, expected);
+
+        Qutepart::StartCharSet chars;
+        QCOMPARE(Qutepart::regExpStartChars(pattern, insensitive, chars), derived);
+        if (derived) {
+            QCOMPARE(asciiChars(chars), expected);
+        }
+    }
+
+    void LiteralPrefix_data() {
+        QTest::addColumn<QString>("pattern");
+        QTest::addColumn<QString>("expected");
+
+        QTest::newRow("literal") << "include" << "include";
+        QTest::newRow("optional tail") << "#\\s*include" << "#";
+        QTest::newRow("word start") << "\\bdef\\b" << "def";
+        QTest::newRow("escaped") << "\\.\\.\\." << "...";
+        QTest::newRow("optional char") << "ab?c" << "a";
+        QTest::newRow("repeated char") << "abc+d" << "abc";
+        QTest::newRow("alternation") << "abc|abd" << "";
+        QTest::newRow("group") << "(abc)" << "";
+        QTest::newRow("class") << "[ab]cd" << "";
+    }
+
+    void LiteralPrefix() {
+        QFETCH(QString, pattern);
+        QFETCH(QString, expected);
+
+        QCOMPARE(Qutepart::regExpLiteralPrefix(pattern), expected);
+    }
+
+    void NativeMatch_data() {
+        QTest::addColumn<QString>("pattern");
+        QTest::addColumn<bool>("insensitive");
+        QTest::addColumn<bool>("native");
+
+        QTest::newRow("identifier") << "[A-Za-z_]\\w*" << false << true;
+        QTest::newRow("hex") << "0[xX][0-9a-fA-F]+" << false << true;
+        QTest::newRow("word") << "\\b\\w+\\b" << false << true;
+        QTest::newRow("include") << "#\\s*include" << true << true;
+        QTest::newRow("string") << "[^\"]*" << false << true;
+        QTest::newRow("trailing space") << "\\s+$" << false << true;
+        QTest::newRow("comment") << "//.*$" << false << true;
+        QTest::newRow("signed") << "[-+]?\\d+" << false << true;
+        QTest::newRow("backtracking") << "a*a" << false << false;
+        QTest::newRow("class backtracking") << "[a-c]*b" << false << false;
+        QTest::newRow("kelvin") << "k+" << true << false;
+        QTest::newRow("boundary after non word") << "[\\w.]+\\b" << false << false;
+        QTest::newRow("alternation") << "ab|cd" << false << false;
+        QTest::newRow("counted") << "a{2}" << false << false;
+    }
+
+    void NativeMatch() {
+        QFETCH(QString, pattern);
+        QFETCH(bool, insensitive);
+        QFETCH(bool, native);
+
+        Qutepart::NativeRegExp nativeRegExp;
+        QCOMPARE(nativeRegExp.compile(pattern, insensitive, false), native);
+        if (!native) {
+            return;
+        }
+
+        QRegularExpression regExp(pattern, insensitive ? QRegularExpression::CaseInsensitiveOption
+                                                       : QRegularExpression::NoPatternOption);
+        const QStringList texts = {"",          "abc",    "ABC_1 x", "0x1fG",   "0X",
+                                   "#include",  "# Include", "\"str\"", "  \t",    "  x",
+                                   "// c\n",     "-12",    "+",       "k\u212a", "a.b",
+                                   "\u00e9t\u00e9", "x\n"};
+        for (const auto &text : texts) {
+            auto match = regExp.matchView(text, 0, QRegularExpression::NormalMatch,
+                                          QRegularExpression::AnchorAtOffsetMatchOption);
+            int expected = match.hasMatch() ? match.capturedLength() : -1;
+            QCOMPARE(nativeRegExp.match(text), expected);
+        }
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_regexp_analysis.moc"
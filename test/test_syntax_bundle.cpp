@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <QDir>
+#include <QFile>
+#include <QObject>
+#include <QTest>
+
+#include "hl/language.h"
+#include "hl/loader.h"
+#include "hl/syntax_bundle.h"
+
+namespace {
+
+const QString SYNTAX_DIR = ":/qutepart/syntax/";
+
+const QStringList PHP_LINES = {
+    "<html><body>",
+    "<?php /* comment */",
+    "  $x = \"string $y\" . 0x10; // done",
+    "?>",
+    "<p style=\"color: red\">text</p>",
+};
+
+// Everything the loader reads, in the order it reads it
+void dumpElements(Qutepart::SyntaxReader &reader, QStringList &out, int depth = 0) {
+    while (reader.readNextStartElement()) {
+        QString line = QString(depth * 2, ' ') + reader.name().toString();
+        for (const auto &attr : reader.attributes()) {
+            line += QString(" %1=\"%2\"").arg(attr.name(), attr.value());
+        }
+        if (reader.name() == QLatin1String("item")) {
+            line += " text=\"" + reader.readElementText() + "\"";
+            out << line;
+            QVERIFY(reader.isEndElement());
+        } else {
+            out << line;
+            dumpElements(reader, out, depth + 1);
+        }
+        out << QString(depth * 2, ' ') + "/" + reader.name().toString();
+    }
+}
+
+QByteArray readSyntaxFile(const QString &fileName) {
+    QFile file(SYNTAX_DIR + fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    return file.readAll();
+}
+
+} // namespace
+
+class Test : public QObject {
+    Q_OBJECT
+
+    Qutepart::SyntaxBundle bundle;
+    QByteArray bundleData;
+
+    QSharedPointer<Qutepart::Language> parse(const QString &fileName, bool fromBundle) {
+        Qutepart::clearLanguageCache();
+        QString error;
+        if (fromBundle) {
+            Qutepart::SyntaxReader reader(bundle, fileName);
+            return Qutepart::parseXmlFile(fileName, reader, error);
+        }
+
+        QXmlStreamReader xmlReader(readSyntaxFile(fileName));
+        Qutepart::SyntaxReader reader(xmlReader, fileName);
+        return Qutepart::parseXmlFile(fileName, reader, error);
+    }
+
+  private slots:
+    void initTestCase() {
+        Q_INIT_RESOURCE(qutepart_syntax_files);
+
+        QList<QPair<QString, QByteArray>> xmlFiles;
+        const auto fileNames = QDir(SYNTAX_DIR).entryList(QDir::Files, QDir::Name);
+        for (const auto &fileName : fileNames) {
+            xmlFiles.append({fileName, readSyntaxFile(fileName)});
+        }
+
+        QString error;
+        bundleData = Qutepart::SyntaxBundle::compile(xmlFiles, error);
+        QVERIFY2(error.isNull(), qPrintable(error));
+        QVERIFY(bundle.load(bundleData));
+    }
+
+    void Header() {
+        QVERIFY(bundle.contains("cpp.xml"));
+        QVERIFY(!bundle.contains("no-such-language.xml"));
+
+        auto otherVersion = bundleData;
+        otherVersion[4] = char(Qutepart::SyntaxBundle::VERSION + 1);
+        Qutepart::SyntaxBundle other;
+        QVERIFY(!other.load(otherVersion));
+        QVERIFY(!other.load(bundleData.left(bundleData.size() / 2)));
+    }
+
+    void SameElements_data() {
+        QTest::addColumn<QString>("fileName");
+        const auto fileNames = QDir(SYNTAX_DIR).entryList(QDir::Files, QDir::Name);
+        for (const auto &fileName : fileNames) {
+            QTest::newRow(qPrintable(fileName)) << fileName;
+        }
+    }
+
+    void SameElements() {
+        QFETCH(QString, fileName);
+
+        QStringList fromXml;
+        QXmlStreamReader xmlReader(readSyntaxFile(fileName));
+        Qutepart::SyntaxReader reader(xmlReader, fileName);
+        dumpElements(reader, fromXml);
+
+        QStringList fromBundle;
+        Qutepart::SyntaxReader bundleReader(bundle, fileName);
+        dumpElements(bundleReader, fromBundle);
+
+        QVERIFY(!fromXml.isEmpty());
+        QCOMPARE(fromBundle, fromXml);
+    }
+
+    void SameHighlighting() {
+        auto xmlLanguage = parse("php.xml", false);
+        auto bundleLanguage = parse("php.xml", true);
+        QVERIFY(!xmlLanguage.isNull());
+        QVERIFY(!bundleLanguage.isNull());
+        QCOMPARE(bundleLanguage->getName(), xmlLanguage->getName());
+
+        auto xmlStack = xmlLanguage->getDefaultContextStack();
+        auto bundleStack = bundleLanguage->getDefaultContextStack();
+        for (const auto &text : PHP_LINES) {
+            auto xmlLine = xmlLanguage->highlightLine(text, xmlStack);
+            auto bundleLine = bundleLanguage->highlightLine(text, bundleStack);
+            QCOMPARE(bundleLine.textTypeMap(), xmlLine.textTypeMap());
+            QCOMPARE(bundleLine.formats.size(), xmlLine.formats.size());
+            xmlStack = xmlLine.endContextStack;
+            bundleStack = bundleLine.endContextStack;
+        }
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_syntax_bundle.moc"
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "hl/text_to_match.h"
+
+class Test : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void Shift() {
+        QString line = "  foo(12)";
+        QStringList data;
+        Qutepart::LineCharClasses charClasses;
+        Qutepart::TextToMatch textToMatch(line, data, charClasses);
+
+        QVERIFY(textToMatch.firstNonSpace);
+        QCOMPARE(textToMatch.countSpaces(), 2);
+
+        textToMatch.shift(2);
+        QVERIFY(textToMatch.firstNonSpace);
+        QVERIFY(textToMatch.isLetter());
+        QCOMPARE(textToMatch.countWordChars(), 3);
+
+        textToMatch.shiftOnce();
+        QVERIFY(!textToMatch.firstNonSpace);
+        QCOMPARE(textToMatch.text, QStringView(line).mid(3));
+
+        textToMatch.shift(3);
+        QCOMPARE(textToMatch.countDigits(), 2);
+        QCOMPARE(textToMatch.countDigits(1), 1);
+        QCOMPARE(textToMatch.countDigits(2), 0);
+
+        textToMatch.shift(3);
+        QVERIFY(textToMatch.isEmpty());
+        QVERIFY(!textToMatch.isWordStart);
+        QCOMPARE(textToMatch.countDigits(), 0);
+    }
+
+    void Word() {
+        QString line = "foo bar.baz";
+        QStringList data;
+        Qutepart::LineCharClasses charClasses;
+        Qutepart::TextToMatch textToMatch(line, data, charClasses);
+
+        // equal sets share the memoised word
+        Qutepart::DeliminatorSet spaces(" ");
+        Qutepart::DeliminatorSet sameSpaces(" ");
+        Qutepart::DeliminatorSet spacesAndDots(" .");
+
+        QCOMPARE(textToMatch.word(spaces), QStringView(u"foo"));
+        QCOMPARE(textToMatch.word(sameSpaces), QStringView(u"foo"));
+
+        textToMatch.shift(4);
+        QCOMPARE(textToMatch.word(spaces), QStringView(u"bar.baz"));
+        QCOMPARE(textToMatch.word(spacesAndDots), QStringView(u"bar"));
+
+        // not after a deliminator
+        textToMatch.shiftOnce();
+        QVERIFY(textToMatch.word(spaces).isNull());
+    }
+};
+
+QTEST_MAIN(Test)
+#include "test_text_to_match.moc"
@@ -0,0 +1,468 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Headless batch highlighter.
+ *
+ * Highlights files with the Language engine, without QTextDocument or widgets. Files are
+ * highlighted in parallel, one file per task. The output is written in the order of the files.
+ * With --chunk-lines the lines of every file are highlighted in parallel too, for huge files.
+ *
+ * Usage: qutepart-highlight [--format ansi|html|json|none] [--output-dir DIR]
+ *                           [--chunk-lines N] [--line-cache N] file|dir...
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QFont>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QTextStream>
+#include <QThreadPool>
+
+#include <atomic>
+#include <utility>
+
+#include "hl/language.h"
+#include "hl/line_cache.h"
+#include "hl/loader.h"
+#include "hl/profiler.h"
+#include "hl/style.h"
+#include "qutepart/qutepart.h"
+#include "qutepart/theme.h"
+
+namespace {
+
+enum class Format { Ansi, Html, Json, None };
+
+struct Options {
+    Format format = Format::Ansi;
+    QString outputDir; // empty for stdout
+    QString languageId;
+    int chunkLines = 0; // 0 to highlight the lines of a file in order
+    QSharedPointer<const Qutepart::StyleTable> styles;
+};
+
+struct FileResult {
+    QByteArray output;
+    int lines = 0;
+    Qutepart::ParallelHighlightStats chunks;
+    bool ok = false;
+};
+
+/* Languages used by the tasks, to print their profile. Loading is thread safe and done once,
+ * highlighting with a loaded language is thread safe.
+ */
+class LanguageCache {
+  public:
+    QSharedPointer<Qutepart::Language> get(const QString &languageId) {
+        auto language = Qutepart::loadLanguage(languageId);
+        QMutexLocker locker(&mutex);
+        languages[languageId] = language;
+        return language;
+    }
+
+    QList<QSharedPointer<Qutepart::Language>> loaded() {
+        QMutexLocker locker(&mutex);
+        QList<QSharedPointer<Qutepart::Language>> result;
+        for (const auto &language : std::as_const(languages)) {
+            if (!language.isNull()) {
+                result.append(language);
+            }
+        }
+        return result;
+    }
+
+  private:
+    QMutex mutex;
+    QHash<QString, QSharedPointer<Qutepart::Language>> languages;
+};
+
+QString colorName(const QTextCharFormat &format) {
+    if (format.foreground().style() == Qt::NoBrush) {
+        return QString();
+    }
+    return format.foreground().color().name();
+}
+
+QByteArray ansiStyle(const QTextCharFormat &format) {
+    QByteArray codes;
+    auto color = colorName(format);
+    if (!color.isEmpty()) {
+        QColor rgb(color);
+        codes += QString("38;2;%1;%2;%3;")
+                     .arg(rgb.red())
+                     .arg(rgb.green())
+                     .arg(rgb.blue())
+                     .toLatin1();
+    }
+    if (format.fontWeight() >= QFont::Bold) {
+        codes += "1;";
+    }
+    if (format.fontItalic()) {
+        codes += "3;";
+    }
+    if (format.fontUnderline()) {
+        codes += "4;";
+    }
+    if (codes.isEmpty()) {
+        return QByteArray();
+    }
+    codes.chop(1);
+    return "\x1b[" + codes + "m";
+}
+
+QString htmlStyle(const QTextCharFormat &format) {
+    QString style;
+    auto color = colorName(format);
+    if (!color.isEmpty()) {
+        style += "color:" + color + ";";
+    }
+    if (format.background().style() != Qt::NoBrush) {
+        style += "background-color:" + format.background().color().name() + ";";
+    }
+    if (format.fontWeight() >= QFont::Bold) {
+        style += "font-weight:bold;";
+    }
+    if (format.fontItalic()) {
+        style += "font-style:italic;";
+    }
+    if (format.fontUnderline()) {
+        style += "text-decoration:underline;";
+    }
+    return style;
+}
+
+void writeAnsiLine(QStringView text, const Qutepart::HighlightedLine &line,
+                   const Qutepart::StyleTable &styles, QByteArray &out) {
+    int column = 0;
+    for (const auto &run : line.formats) {
+        out += text.mid(column, run.start - column).toUtf8();
+        auto style = ansiStyle(*styles.format(run.styleId));
+        out += style;
+        out += text.mid(run.start, run.length).toUtf8();
+        if (!style.isEmpty()) {
+            out += "\x1b[0m";
+        }
+        column = run.start + run.length;
+    }
+    out += text.mid(column).toUtf8();
+    out += '\n';
+}
+
+void writeHtmlLine(QStringView text, const Qutepart::HighlightedLine &line,
+                   const Qutepart::StyleTable &styles, QByteArray &out) {
+    int column = 0;
+    for (const auto &run : line.formats) {
+        out += text.mid(column, run.start - column).toString().toHtmlEscaped().toUtf8();
+        auto style = htmlStyle(*styles.format(run.styleId));
+        auto runText = text.mid(run.start, run.length).toString().toHtmlEscaped().toUtf8();
+        if (style.isEmpty()) {
+            out += runText;
+        } else {
+            out += "<span style=\"" + style.toUtf8() + "\">" + runText + "</span>";
+        }
+        column = run.start + run.length;
+    }
+    out += text.mid(column).toString().toHtmlEscaped().toUtf8();
+    out += '\n';
+}
+
+QJsonArray jsonSpans(const Qutepart::HighlightedLine &line, const Qutepart::StyleTable &styles) {
+    QJsonArray spans;
+    for (const auto &run : line.formats) {
+        QJsonObject span;
+        span["start"] = run.start;
+        span["length"] = run.length;
+        auto format = styles.format(run.styleId);
+        auto color = colorName(*format);
+        if (!color.isEmpty()) {
+            span["color"] = color;
+        }
+        if (format->fontWeight() >= QFont::Bold) {
+            span["bold"] = true;
+        }
+        if (format->fontItalic()) {
+            span["italic"] = true;
+        }
+        spans.append(span);
+    }
+    return spans;
+}
+
+FileResult highlightFile(const QString &path, const Options &options, LanguageCache &cache) {
+    FileResult result;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        result.output = QString("Failed to open %1\n").arg(path).toUtf8();
+        return result;
+    }
+    auto text = QString::fromUtf8(file.readAll());
+    auto lines = QStringView(text).split(u'\n');
+    if (!lines.isEmpty() && lines.last().isEmpty()) {
+        lines.removeLast();
+    }
+
+    auto languageId = options.languageId;
+    if (languageId.isEmpty()) {
+        auto firstLine = lines.isEmpty() ? QString() : lines.first().toString();
+        languageId = Qutepart::chooseLanguage(QString(), QString(), path, firstLine).id;
+    }
+    QSharedPointer<Qutepart::Language> language;
+    if (!languageId.isEmpty()) {
+        language = cache.get(languageId);
+    }
+    if (language.isNull()) {
+        result.output = QString("No language for %1\n").arg(path).toUtf8();
+        return result;
+    }
+
+    for (auto &lineText : lines) {
+        if (lineText.endsWith(u'\r')) {
+            lineText.chop(1);
+        }
+    }
+
+    QJsonArray jsonLines;
+    if (options.format == Format::Html) {
+        result.output += "<pre>\n";
+    }
+
+    auto writeLine = [&](QStringView lineText, const Qutepart::HighlightedLine &line) {
+        switch (options.format) {
+        case Format::Ansi:
+            writeAnsiLine(lineText, line, *options.styles, result.output);
+            break;
+        case Format::Html:
+            writeHtmlLine(lineText, line, *options.styles, result.output);
+            break;
+        case Format::Json:
+            jsonLines.append(jsonSpans(line, *options.styles));
+            break;
+        case Format::None:
+            break;
+        }
+    };
+
+    if (options.chunkLines > 0) {
+        auto highlighted = language->highlightLines(lines, options.chunkLines, &result.chunks);
+        for (int i = 0; i < lines.size(); i++) {
+            writeLine(lines[i], highlighted[i]);
+        }
+    } else {
+        auto contextStack = language->getDefaultContextStack();
+        Qutepart::HighlightedLine line(0, contextStack);
+        for (const auto &lineText : std::as_const(lines)) {
+            language->highlightLine(lineText, contextStack, line);
+            contextStack = line.endContextStack;
+            writeLine(lineText, line);
+        }
+    }
+
+    if (options.format == Format::Html) {
+        result.output += "</pre>\n";
+    } else if (options.format == Format::Json) {
+        QJsonObject object;
+        object["file"] = path;
+        object["language"] = language->getName();
+        object["lines"] = jsonLines;
+        result.output = QJsonDocument(object).toJson(QJsonDocument::Compact) + "\n";
+    }
+
+    result.lines = lines.size();
+    result.ok = true;
+    return result;
+}
+
+QString outputExtension(Format format) {
+    switch (format) {
+    case Format::Html:
+        return ".html";
+    case Format::Json:
+        return ".json";
+    default:
+        return ".txt";
+    }
+}
+
+// Input path flattened to a file name, so files with the same name in different dirs don't clash
+QString outputFileName(const QString &path, Format format) {
+    QString name = QDir::cleanPath(path);
+    name.replace('/', '_');
+    return name + outputExtension(format);
+}
+
+QStringList collectFiles(const QStringList &paths) {
+    QStringList result;
+    for (const auto &path : paths) {
+        if (QFileInfo(path).isDir()) {
+            QDirIterator it(path, QDir::Files, QDirIterator::Subdirectories);
+            QStringList dirFiles;
+            while (it.hasNext()) {
+                dirFiles.append(it.next());
+            }
+            dirFiles.sort();
+            result += dirFiles;
+        } else {
+            result.append(path);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    QCoreApplication app(argc, argv);
+    Q_INIT_RESOURCE(qutepart_syntax_files);
+    Q_INIT_RESOURCE(qutepart_theme_data);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Highlight files without a GUI");
+    parser.addHelpOption();
+    QCommandLineOption formatOption("format", "Output format: ansi, html, json or none", "format",
+                                    "ansi");
+    QCommandLineOption outputOption("output-dir", "Write one output file per input file", "dir");
+    QCommandLineOption languageOption("language", "Language file, i.e. cpp.xml", "id");
+    QCommandLineOption themeOption("theme", "Theme file, i.e. :/qutepart/themes/breeze-dark.theme",
+                                   "file");
+    QCommandLineOption threadsOption("threads", "Count of worker threads", "count");
+    QCommandLineOption chunkLinesOption(
+        "chunk-lines", "Highlight the lines of a file in parallel, in chunks of N lines", "N");
+    QCommandLineOption lineCacheOption(
+        "line-cache", "Cache up to N highlighted lines per language, for repeated lines", "N");
+    QCommandLineOption profileOption("profile", "Print the rule profile of the languages");
+    parser.addOptions({formatOption, outputOption, languageOption, themeOption, threadsOption,
+                       chunkLinesOption, lineCacheOption, profileOption});
+    parser.addPositionalArgument("path", "Files or directories to highlight");
+    parser.process(app);
+
+    Options options;
+    const QHash<QString, Format> formats = {{"ansi", Format::Ansi},
+                                            {"html", Format::Html},
+                                            {"json", Format::Json},
+                                            {"none", Format::None}};
+    if (!formats.contains(parser.value(formatOption))) {
+        qCritical() << "Unknown format" << parser.value(formatOption);
+        return 1;
+    }
+    options.format = formats[parser.value(formatOption)];
+    options.outputDir = parser.value(outputOption);
+    options.languageId = parser.value(languageOption);
+    options.chunkLines = parser.value(chunkLinesOption).toInt();
+
+    Qutepart::Theme theme;
+    if (parser.isSet(themeOption) && !theme.loadTheme(parser.value(themeOption))) {
+        qCritical() << "Failed to load theme" << parser.value(themeOption);
+        return 1;
+    }
+    options.styles = Qutepart::StyleTable::get(parser.isSet(themeOption) ? &theme : nullptr);
+
+    if (!options.outputDir.isEmpty() && !QDir().mkpath(options.outputDir)) {
+        qCritical() << "Failed to create" << options.outputDir;
+        return 1;
+    }
+
+    if (parser.isSet(threadsOption)) {
+        QThreadPool::globalInstance()->setMaxThreadCount(parser.value(threadsOption).toInt());
+    }
+    Qutepart::setProfilingEnabled(parser.isSet(profileOption));
+    Qutepart::setLineCacheCapacity(parser.value(lineCacheOption).toInt());
+
+    auto files = collectFiles(parser.positionalArguments());
+    if (files.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    LanguageCache cache;
+    QVector<FileResult> results(files.size());
+    auto resultsData = results.data(); // written by the tasks, one element each
+    std::atomic<qint64> totalLines{0};
+    std::atomic<int> totalChunks{0};
+    std::atomic<int> rehighlightedChunks{0};
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < files.size(); i++) {
+        QThreadPool::globalInstance()->start([&, i]() {
+            auto result = highlightFile(files[i], options, cache);
+            totalLines += result.lines;
+            totalChunks += result.chunks.chunks;
+            rehighlightedChunks += result.chunks.rehighlightedChunks;
+            if (result.ok && !options.outputDir.isEmpty()) {
+                QFile out(
+                    QDir(options.outputDir).filePath(outputFileName(files[i], options.format)));
+                if (out.open(QIODevice::WriteOnly)) {
+                    out.write(result.output);
+                }
+                result.output.clear();
+            }
+            resultsData[i] = std::move(result);
+        });
+    }
+    QThreadPool::globalInstance()->waitForDone();
+    auto elapsed = timer.nsecsElapsed() / 1e9;
+
+    QFile out;
+    if (!out.open(stdout, QIODevice::WriteOnly)) {
+        return 1;
+    }
+    QFile err;
+    if (!err.open(stderr, QIODevice::WriteOnly)) {
+        return 1;
+    }
+
+    int failed = 0;
+    for (const auto &result : std::as_const(results)) {
+        if (result.ok) {
+            out.write(result.output);
+        } else {
+            err.write(result.output);
+            failed++;
+        }
+    }
+    out.flush();
+
+    QTextStream stats(&err);
+    stats << files.size() - failed << " files, " << totalLines.load() << " lines in "
+          << QString::number(elapsed, 'f', 3) << " s: "
+          << QString::number((files.size() - failed) / elapsed, 'f', 1) << " files/s, "
+          << QString::number(totalLines.load() / elapsed, 'f', 0) << " lines/s, "
+          << QThreadPool::globalInstance()->maxThreadCount() << " threads\n";
+    if (options.chunkLines > 0) {
+        stats << rehighlightedChunks.load() << " of " << totalChunks.load()
+              << " chunks highlighted again from the real start context\n";
+    }
+    if (Qutepart::getLineCacheCapacity() > 0) {
+        quint64 hits = 0;
+        quint64 misses = 0;
+        for (const auto &language : cache.loaded()) {
+            auto lineCacheStats = language->lineCacheStats();
+            hits += lineCacheStats.hits;
+            misses += lineCacheStats.misses;
+        }
+        stats << "Line cache: " << hits << " hits, " << misses << " misses, "
+              << QString::number(hits + misses ? 100.0 * hits / (hits + misses) : 0, 'f', 1)
+              << "% hit rate\n";
+    }
+
+    if (parser.isSet(profileOption)) {
+        for (const auto &language : cache.loaded()) {
+            language->printProfile(stats);
+        }
+    }
+
+    return failed == 0 ? 0 : 2;
+}
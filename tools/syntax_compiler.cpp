@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2023-...  Diego Iastrubni <diegoiast@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Build step: compiles the syntax files to the binary bundle which is embedded in the library,
+ * see src/hl/syntax_bundle.h
+ *
+ * Usage: qutepart-syntax-compiler SYNTAX_DIR OUTPUT_FILE
+ */
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+
+#include "hl/syntax_bundle.h"
+
+int main(int argc, char **argv) {
+    QCoreApplication app(argc, argv);
+
+    auto args = app.arguments();
+    if (args.size() != 3) {
+        qCritical() << "Usage: qutepart-syntax-compiler SYNTAX_DIR OUTPUT_FILE";
+        return 1;
+    }
+
+    QDir syntaxDir(args[1]);
+    QList<QPair<QString, QByteArray>> xmlFiles;
+    const auto fileNames = syntaxDir.entryList({"*.xml"}, QDir::Files, QDir::Name);
+    for (const auto &fileName : fileNames) {
+        QFile file(syntaxDir.filePath(fileName));
+        if (!file.open(QIODevice::ReadOnly)) {
+            qCritical() << "Failed to open" << file.fileName();
+            return 1;
+        }
+        xmlFiles.append({fileName, file.readAll()});
+    }
+
+    if (xmlFiles.isEmpty()) {
+        qCritical() << "No syntax files found in" << args[1];
+        return 1;
+    }
+
+    QString error;
+    auto bundle = Qutepart::SyntaxBundle::compile(xmlFiles, error);
+    if (!error.isNull()) {
+        qCritical() << "Failed to compile the syntax files:" << error;
+        return 1;
+    }
+
+    QSaveFile output(args[2]);
+    if (!output.open(QIODevice::WriteOnly) || output.write(bundle) != bundle.size() ||
+        !output.commit()) {
+        qCritical() << "Failed to write" << args[2];
+        return 1;
+    }
+
+    return 0;
+}